@@ -0,0 +1,62 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "execution-context.hpp"
+#include "random.hpp"
+
+namespace nfd {
+
+ExecutionContext::ExecutionContext()
+  : m_scheduler(nullptr)
+{
+}
+
+ExecutionContext::ExecutionContext(uint32_t rngSeed)
+  : m_scheduler(nullptr)
+  , m_rng(make_unique<std::mt19937>(rngSeed))
+{
+}
+
+ExecutionContext::ExecutionContext(scheduler::Scheduler& scheduler, uint32_t rngSeed)
+  : m_scheduler(&scheduler)
+  , m_rng(make_unique<std::mt19937>(rngSeed))
+{
+}
+
+std::mt19937&
+ExecutionContext::getRng()
+{
+  return m_rng != nullptr ? *m_rng : getGlobalRng();
+}
+
+ExecutionContext&
+getGlobalExecutionContext()
+{
+  // stateless apart from its fallbacks, which are themselves thread-specific
+  static ExecutionContext context;
+  return context;
+}
+
+} // namespace nfd
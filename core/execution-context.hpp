@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_EXECUTION_CONTEXT_HPP
+#define NFD_CORE_EXECUTION_CONTEXT_HPP
+
+#include "common.hpp"
+#include "scheduler.hpp"
+
+#include <random>
+
+namespace nfd {
+
+/** \brief per-node execution context
+ *
+ *  ExecutionContext bundles the scheduler and the random number generator
+ *  used by one Forwarder and everything it owns (tables, strategies, link services).
+ *  When many nodes are simulated in one process, giving each node its own context keeps
+ *  their RNG streams independent and reproducible, and lets a node's timers be driven
+ *  separately from the thread-wide scheduler.
+ *
+ *  A context that is not given a scheduler or RNG falls back to the thread-wide instance
+ *  (scheduler::getGlobalScheduler, getGlobalRng), resolved at the time of each call so that
+ *  it survives scheduler::resetGlobalScheduler.
+ */
+class ExecutionContext : noncopyable
+{
+public:
+  /** \brief construct a context that delegates everything to the thread-wide instances
+   */
+  ExecutionContext();
+
+  /** \brief construct a context with its own RNG seeded by \p rngSeed
+   *
+   *  The scheduler is the thread-wide instance.
+   */
+  explicit
+  ExecutionContext(uint32_t rngSeed);
+
+  /** \brief construct a context with its own scheduler and RNG
+   *  \param scheduler scheduler for timers; must outlive the context
+   *  \param rngSeed seed of the context's RNG
+   */
+  ExecutionContext(scheduler::Scheduler& scheduler, uint32_t rngSeed);
+
+  scheduler::Scheduler&
+  getScheduler() const
+  {
+    return m_scheduler != nullptr ? *m_scheduler : scheduler::getGlobalScheduler();
+  }
+
+  std::mt19937&
+  getRng();
+
+  /** \brief schedule an event on this context's scheduler
+   */
+  scheduler::EventId
+  schedule(time::nanoseconds after, const scheduler::EventCallback& event)
+  {
+    return this->getScheduler().scheduleEvent(after, event);
+  }
+
+private:
+  scheduler::Scheduler* m_scheduler;
+  unique_ptr<std::mt19937> m_rng;
+};
+
+/** \return the execution context that delegates to the thread-wide scheduler and RNG
+ *
+ *  This is the default for tables and link services that are not owned by a Forwarder.
+ */
+ExecutionContext&
+getGlobalExecutionContext();
+
+} // namespace nfd
+
+#endif // NFD_CORE_EXECUTION_CONTEXT_HPP
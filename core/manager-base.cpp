@@ -25,6 +25,8 @@
 
 #include "manager-base.hpp"
 
+#include <algorithm>
+
 namespace nfd {
 
 using ndn::mgmt::ValidateParameters;
@@ -53,6 +55,45 @@ ManagerBase::registerNotificationStream(const std::string& verb)
   return m_dispatcher.addNotificationStream(makeRelPrefix(verb));
 }
 
+/** \brief parses a table version written as a decimal number
+ */
+static optional<uint64_t>
+parseVersion(const name::Component& component)
+{
+  std::string str(reinterpret_cast<const char*>(component.value()), component.value_size());
+  if (str.empty() || str.size() > std::numeric_limits<uint64_t>::digits10 ||
+      !std::all_of(str.begin(), str.end(), [] (char c) { return c >= '0' && c <= '9'; })) {
+    return nullopt;
+  }
+  return std::stoull(str);
+}
+
+void
+ManagerBase::registerChangeDatasetHandler(const std::string& verb,
+                                          const std::function<uint64_t()>& getVersion,
+                                          const ChangeDatasetHandler& handler)
+{
+  registerStatusDatasetHandler(verb,
+    [=] (const Name& topPrefix, const Interest& interest, ndn::mgmt::StatusDatasetContext& context) {
+      const Name& name = interest.getName();
+      size_t versionIndex = topPrefix.size() + 2; // after module and verb
+      context.setPrefix(Name(name).appendVersion(getVersion()));
+
+      if (name.size() <= versionIndex) {
+        return context.end();
+      }
+
+      optional<uint64_t> since = parseVersion(name[versionIndex]);
+      if (!since) {
+        return context.reject(ControlResponse(400, "Malformed version"));
+      }
+      if (!handler(*since, context)) {
+        return context.reject(ControlResponse(410, "Changes since version " + to_string(*since) +
+                                                   " are not available"));
+      }
+    });
+}
+
 void
 ManagerBase::extractRequester(const Interest& interest,
                               ndn::mgmt::AcceptContinuation accept)
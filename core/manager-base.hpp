@@ -89,6 +89,27 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED: // registrations to the dispatcher
   ndn::mgmt::PostNotification
   registerNotificationStream(const std::string& verb);
 
+  /** @brief appends the changes to a table after version @p since to @p context, and ends it
+   *  @return false without appending anything if those changes are no longer available
+   */
+  using ChangeDatasetHandler = std::function<bool(uint64_t since,
+                                                  ndn::mgmt::StatusDatasetContext& context)>;
+
+  /**
+   * @brief register a dataset of the changes to a table after a given table version
+   *
+   * A request is the dataset prefix followed by the version as a decimal number. The response
+   * name carries the current version, which the requester should ask for next time. A request
+   * without a version is answered with an empty dataset, so that a requester can learn the
+   * current version before it fetches the full table.
+   *
+   * @param getVersion returns the current table version
+   */
+  void
+  registerChangeDatasetHandler(const std::string& verb,
+                               const std::function<uint64_t()>& getVersion,
+                               const ChangeDatasetHandler& handler);
+
 PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   /**
    * @brief extract a requester from a ControlCommand request
@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "packet-trace.hpp"
+#include "city-hash.hpp"
+
+#include <cstring>
+#include <ostream>
+
+namespace nfd {
+namespace trace {
+
+const char FILE_MAGIC[8] = {'N', 'F', 'D', 'T', 'R', 'A', 'C', 'E'};
+
+const size_t PacketTracer::DEFAULT_CAPACITY = 65536;
+
+std::ostream&
+operator<<(std::ostream& os, Event event)
+{
+  switch (event) {
+    case Event::NONE:
+      return os << "none";
+    case Event::INCOMING_INTEREST:
+      return os << "in-interest";
+    case Event::INTEREST_LOOP:
+      return os << "interest-loop";
+    case Event::CS_HIT:
+      return os << "cs-hit";
+    case Event::CS_MISS:
+      return os << "cs-miss";
+    case Event::OUTGOING_INTEREST:
+      return os << "out-interest";
+    case Event::INTEREST_FINALIZE_SATISFIED:
+      return os << "finalize-satisfied";
+    case Event::INTEREST_FINALIZE_UNSATISFIED:
+      return os << "finalize-unsatisfied";
+    case Event::INCOMING_DATA:
+      return os << "in-data";
+    case Event::DATA_UNSOLICITED:
+      return os << "data-unsolicited";
+    case Event::EMERGENCY_DATA:
+      return os << "emergency-data";
+    case Event::OUTGOING_DATA:
+      return os << "out-data";
+    case Event::INCOMING_NACK:
+      return os << "in-nack";
+    case Event::OUTGOING_NACK:
+      return os << "out-nack";
+    case Event::PIT_INSERT:
+      return os << "pit-insert";
+    case Event::PIT_EXPIRY_SET:
+      return os << "pit-expiry-set";
+    case Event::RELAY_INTEREST_SCHEDULED:
+      return os << "relay-interest-scheduled";
+    case Event::RELAY_INTEREST_CANCELED:
+      return os << "relay-interest-canceled";
+    case Event::RETX_INTEREST_SCHEDULED:
+      return os << "retx-interest-scheduled";
+    case Event::RETX_INTEREST_CANCELED:
+      return os << "retx-interest-canceled";
+    case Event::RELAY_DATA_SCHEDULED:
+      return os << "relay-data-scheduled";
+    case Event::RELAY_DATA_CANCELED:
+      return os << "relay-data-canceled";
+    case Event::PIT_QUOTA_EXCEEDED:
+      return os << "pit-quota-exceeded";
+    case Event::EVENT_MAX:
+      break;
+  }
+  return os << "unknown(" << static_cast<unsigned>(event) << ")";
+}
+
+uint64_t
+computeNameHash(const Name& name)
+{
+  const Block& wire = name.wireEncode();
+  return CityHash64(reinterpret_cast<const char*>(wire.value()), wire.value_size());
+}
+
+PacketTracer::PacketTracer(const std::string& filename, size_t capacity)
+  : m_ring(capacity)
+  , m_os(filename, std::ios::binary | std::ios::trunc)
+  , m_nDropped(0)
+{
+  if (!m_os) {
+    BOOST_THROW_EXCEPTION(Error("Cannot open packet trace file " + filename));
+  }
+
+  FileHeader header;
+  std::memcpy(header.magic, FILE_MAGIC, sizeof(header.magic));
+  header.version = FILE_VERSION;
+  header.recordSize = sizeof(Record);
+  m_os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+PacketTracer::~PacketTracer()
+{
+  this->flush();
+}
+
+void
+PacketTracer::record(Event event, uint64_t faceId, const Name& name, uint32_t nonce, uint32_t arg)
+{
+  Record record{};
+  record.timestamp = static_cast<uint64_t>(time::duration_cast<time::nanoseconds>(
+                       time::steady_clock::now().time_since_epoch()).count());
+  record.nameHash = computeNameHash(name);
+  record.faceId = static_cast<uint32_t>(faceId);
+  record.nonce = nonce;
+  record.arg = arg;
+  record.event = static_cast<uint8_t>(event);
+
+  if (!m_ring.push(record)) {
+    this->flush();
+    if (!m_ring.push(record)) {
+      ++m_nDropped;
+    }
+  }
+}
+
+void
+PacketTracer::flush()
+{
+  Record buffer[256];
+  size_t n = 0;
+  while ((n = m_ring.pop(buffer, sizeof(buffer) / sizeof(buffer[0]))) > 0) {
+    m_os.write(reinterpret_cast<const char*>(buffer), n * sizeof(Record));
+    if (!m_os) {
+      m_nDropped += n;
+    }
+  }
+  m_os.flush();
+}
+
+} // namespace trace
+} // namespace nfd
@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_PACKET_TRACE_HPP
+#define NFD_CORE_PACKET_TRACE_HPP
+
+#include "common.hpp"
+#include "spsc-ring.hpp"
+
+#include <fstream>
+#include <iosfwd>
+
+namespace nfd {
+namespace trace {
+
+/** \brief pipeline events recorded in a packet trace
+ *  \note Values are persisted in trace files; new events must be appended.
+ */
+enum class Event : uint8_t {
+  NONE                          = 0,
+  INCOMING_INTEREST             = 1,
+  INTEREST_LOOP                 = 2,
+  CS_HIT                        = 3,
+  CS_MISS                       = 4,
+  OUTGOING_INTEREST             = 5,
+  INTEREST_FINALIZE_SATISFIED   = 6,
+  INTEREST_FINALIZE_UNSATISFIED = 7,
+  INCOMING_DATA                 = 8,
+  DATA_UNSOLICITED              = 9,
+  EMERGENCY_DATA                = 10,
+  OUTGOING_DATA                 = 11,
+  INCOMING_NACK                 = 12,
+  OUTGOING_NACK                 = 13,
+  PIT_INSERT                    = 14,
+  PIT_EXPIRY_SET                = 15,
+  RELAY_INTEREST_SCHEDULED      = 16,
+  RELAY_INTEREST_CANCELED       = 17,
+  RETX_INTEREST_SCHEDULED       = 18,
+  RETX_INTEREST_CANCELED        = 19,
+  RELAY_DATA_SCHEDULED          = 20,
+  RELAY_DATA_CANCELED           = 21,
+  PIT_QUOTA_EXCEEDED            = 22,
+  EVENT_MAX                     = 23
+};
+
+std::ostream&
+operator<<(std::ostream& os, Event event);
+
+/** \brief a fixed-size packet trace record
+ *
+ *  Records are written to trace files in host byte order, following a FileHeader.
+ */
+struct Record
+{
+  uint64_t timestamp; ///< nanoseconds since steady clock epoch (simulation time in ndnSIM)
+  uint64_t nameHash;  ///< hash of the packet name, see computeNameHash
+  uint32_t faceId;    ///< incoming or outgoing FaceId, or 0 if not applicable
+  uint32_t nonce;     ///< Interest or Data Nonce, or 0 if not applicable
+  uint32_t arg;       ///< event specific argument, e.g. timer delay in microseconds
+  uint8_t event;      ///< an Event
+  uint8_t reserved[3];
+};
+
+static_assert(sizeof(Record) == 32, "trace::Record must be 32 octets");
+
+/** \brief header at the beginning of a trace file
+ */
+struct FileHeader
+{
+  char magic[8];       ///< FILE_MAGIC
+  uint32_t version;    ///< FILE_VERSION
+  uint32_t recordSize; ///< sizeof(Record)
+};
+
+static_assert(sizeof(FileHeader) == 16, "trace::FileHeader must be 16 octets");
+
+extern const char FILE_MAGIC[8];
+const uint32_t FILE_VERSION = 1;
+
+/** \return a 64-bit hash of \p name, stable across processes
+ */
+uint64_t
+computeNameHash(const Name& name);
+
+/** \brief a lock-free ring of trace records
+ *
+ *  The producer is the thread that runs the forwarding pipelines; the consumer may be the same
+ *  thread or a separate flushing thread.
+ */
+using RecordRing = SpscRing<Record>;
+
+/** \brief writes packet-event records of one forwarder to a binary trace file
+ *
+ *  Records are buffered in a RecordRing. When the ring is full, it is flushed to the file
+ *  before the new record is appended, so records are only lost if the file cannot be written.
+ */
+class PacketTracer : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /** \throw Error the trace file cannot be opened
+   */
+  explicit
+  PacketTracer(const std::string& filename, size_t capacity = DEFAULT_CAPACITY);
+
+  ~PacketTracer();
+
+  void
+  record(Event event, uint64_t faceId, const Name& name, uint32_t nonce, uint32_t arg = 0);
+
+  /** \brief writes all buffered records to the trace file
+   */
+  void
+  flush();
+
+  /** \return number of records that could not be written
+   */
+  uint64_t
+  getNDropped() const
+  {
+    return m_nDropped;
+  }
+
+public:
+  static const size_t DEFAULT_CAPACITY;
+
+private:
+  RecordRing m_ring;
+  std::ofstream m_os;
+  uint64_t m_nDropped;
+};
+
+} // namespace trace
+} // namespace nfd
+
+#endif // NFD_CORE_PACKET_TRACE_HPP
@@ -67,6 +67,22 @@ public:
   Duration
   computeRto() const;
 
+  /** \return smoothed RTT, or getInitialRtt() if no measurement has been added
+   */
+  Duration
+  getSmoothedRtt() const
+  {
+    return Duration(static_cast<Duration::rep>(m_rtt));
+  }
+
+  /** \return whether at least one measurement has been added
+   */
+  bool
+  hasSamples() const
+  {
+    return m_nSamples > 0;
+  }
+
 private:
   uint16_t m_maxMultiplier;
   double m_minRto;
@@ -51,6 +51,11 @@ cancel(EventId eventId)
   eventId.cancel();
 }
 
+/** \return the scheduler of the calling thread
+ */
+Scheduler&
+getGlobalScheduler();
+
 void
 resetGlobalScheduler();
 
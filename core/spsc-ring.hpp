@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_SPSC_RING_HPP
+#define NFD_CORE_SPSC_RING_HPP
+
+#include "common.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace nfd {
+
+/** \brief a bounded lock-free single-producer single-consumer ring
+ *  \tparam T element type, must be default constructible and move assignable
+ *
+ *  push() may only be called from one thread at a time, and pop() may only be called from
+ *  one (possibly different) thread at a time.
+ */
+template<typename T>
+class SpscRing : noncopyable
+{
+public:
+  /** \param capacity minimum number of elements; rounded up to a power of two
+   */
+  explicit
+  SpscRing(size_t capacity)
+    : m_mask(roundUpToPowerOfTwo(std::max<size_t>(capacity, 2)) - 1)
+    , m_elements(new T[m_mask + 1])
+    , m_head(0)
+    , m_tail(0)
+  {
+  }
+
+  size_t
+  capacity() const
+  {
+    return m_mask + 1;
+  }
+
+  size_t
+  size() const
+  {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+  }
+
+  bool
+  empty() const
+  {
+    return this->size() == 0;
+  }
+
+  /** \brief appends an element (producer side)
+   *  \return false if the ring is full, in which case \p element is left unchanged
+   */
+  bool
+  push(T&& element)
+  {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) > m_mask) {
+      return false;
+    }
+    m_elements[tail & m_mask] = std::move(element);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool
+  push(const T& element)
+  {
+    T copy(element);
+    return this->push(std::move(copy));
+  }
+
+  /** \brief removes up to \p n elements into \p out (consumer side)
+   *  \return number of elements removed
+   */
+  size_t
+  pop(T* out, size_t n)
+  {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t available = m_tail.load(std::memory_order_acquire) - head;
+    n = std::min(n, available);
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = std::move(m_elements[(head + i) & m_mask]);
+    }
+    m_head.store(head + n, std::memory_order_release);
+    return n;
+  }
+
+private:
+  static size_t
+  roundUpToPowerOfTwo(size_t n)
+  {
+    size_t p = 1;
+    while (p < n) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+private:
+  const size_t m_mask;
+  std::unique_ptr<T[]> m_elements;
+  std::atomic<size_t> m_head; ///< next element to pop, written by consumer
+  std::atomic<size_t> m_tail; ///< next slot to push, written by producer
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_SPSC_RING_HPP
@@ -0,0 +1,165 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_STATUS_DATASET_CACHE_HPP
+#define NFD_CORE_STATUS_DATASET_CACHE_HPP
+
+#include "common.hpp"
+
+#include <ndn-cxx/mgmt/status-dataset-context.hpp>
+
+#include <algorithm>
+#include <deque>
+
+namespace nfd {
+
+/** \brief records a version number for a table, and the items changed at recent versions
+ *
+ *  The version starts at 0 and is incremented by every recorded change. Only the most recent
+ *  \p capacity changes are kept, so a consumer that lags too far behind must start over
+ *  from the full dataset.
+ *
+ *  \tparam Item identifies what has changed, e.g. an entry prefix or an encoded event
+ */
+template<typename Item>
+class TableChangeLog : noncopyable
+{
+public:
+  explicit
+  TableChangeLog(size_t capacity = DEFAULT_CAPACITY)
+    : m_capacity(capacity)
+    , m_version(0)
+  {
+    BOOST_ASSERT(m_capacity > 0);
+  }
+
+  uint64_t
+  getVersion() const
+  {
+    return m_version;
+  }
+
+  /** \brief increments the version, and records \p item as changed at the new version
+   */
+  void
+  record(Item item)
+  {
+    ++m_version;
+    if (m_changes.size() == m_capacity) {
+      m_changes.pop_front();
+    }
+    m_changes.push_back(std::move(item));
+  }
+
+  /** \brief invokes \p f on each item changed after \p version, oldest first
+   *  \return false without invoking \p f if \p version is newer than the current version,
+   *          or if some changes after \p version are no longer kept
+   */
+  template<typename F>
+  bool
+  forEachSince(uint64_t version, const F& f) const
+  {
+    if (version > m_version || m_version - version > m_changes.size()) {
+      return false;
+    }
+    std::for_each(m_changes.end() - (m_version - version), m_changes.end(), f);
+    return true;
+  }
+
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+private:
+  size_t m_capacity;
+  uint64_t m_version;
+  std::deque<Item> m_changes;
+};
+
+template<typename Item>
+constexpr size_t TableChangeLog<Item>::DEFAULT_CAPACITY;
+
+/** \brief caches the encoded elements of a status dataset for one table version
+ *
+ *  Repeated requests for a dataset whose table has not changed are answered from the cache
+ *  instead of walking and encoding the table again.
+ */
+class StatusDatasetCache : noncopyable
+{
+public:
+  typedef std::function<void(std::vector<Block>&)> Encoder;
+
+  /** \param maxAge how long a cached dataset may be served even if the table version is
+   *                unchanged; this bounds the staleness of fields that change without
+   *                changing the version, such as counters
+   */
+  explicit
+  StatusDatasetCache(time::nanoseconds maxAge = time::nanoseconds::max())
+    : m_maxAge(maxAge)
+  {
+  }
+
+  /** \brief appends the dataset of table \p version to \p context, and ends the dataset
+   *
+   *  \p encode is invoked to refill the cache when it does not hold \p version, or when
+   *  the cached dataset is older than maxAge.
+   */
+  void
+  serve(uint64_t version, ndn::mgmt::StatusDatasetContext& context, const Encoder& encode)
+  {
+    auto now = time::steady_clock::now();
+    if (!m_isValid || m_version != version || now - m_encodedAt > m_maxAge) {
+      m_elements.clear();
+      encode(m_elements);
+      m_isValid = true;
+      m_version = version;
+      m_encodedAt = now;
+    }
+
+    for (const Block& element : m_elements) {
+      context.append(element);
+    }
+    context.end();
+  }
+
+  /** \brief drops the cached dataset, e.g. after a change that does not affect the version
+   */
+  void
+  invalidate()
+  {
+    m_isValid = false;
+    m_elements.clear();
+  }
+
+private:
+  time::nanoseconds m_maxAge;
+  bool m_isValid = false;
+  uint64_t m_version = 0;
+  time::steady_clock::TimePoint m_encodedAt;
+  std::vector<Block> m_elements;
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_STATUS_DATASET_CACHE_HPP
@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "datagram-batch.hpp"
+
+#include <algorithm>
+#include <cerrno>
+
+#include <sys/uio.h>
+
+namespace nfd {
+namespace face {
+
+struct DatagramBatch::Impl
+{
+  explicit
+  Impl(size_t batchSize)
+    : buffers(batchSize * ndn::MAX_NDN_PACKET_SIZE)
+    , payloadSizes(batchSize)
+    , senders(batchSize)
+    , senderSizes(batchSize)
+    , recvIovs(batchSize)
+    , sendIovs(batchSize)
+#ifdef __linux__
+    , recvMsgs(batchSize)
+    , sendMsgs(batchSize)
+#endif
+  {
+    for (size_t i = 0; i < batchSize; ++i) {
+      recvIovs[i].iov_base = &buffers[i * ndn::MAX_NDN_PACKET_SIZE];
+      recvIovs[i].iov_len = ndn::MAX_NDN_PACKET_SIZE;
+    }
+  }
+
+  std::vector<uint8_t> buffers;
+  std::vector<size_t> payloadSizes;
+  std::vector<sockaddr_storage> senders;
+  std::vector<socklen_t> senderSizes;
+  std::vector<iovec> recvIovs;
+  std::vector<iovec> sendIovs;
+#ifdef __linux__
+  std::vector<mmsghdr> recvMsgs;
+  std::vector<mmsghdr> sendMsgs;
+#endif
+};
+
+DatagramBatch::DatagramBatch(size_t batchSize)
+  : m_batchSize(batchSize)
+  , m_impl(make_unique<Impl>(batchSize))
+{
+  BOOST_ASSERT(batchSize > 0);
+}
+
+DatagramBatch::~DatagramBatch() = default;
+
+ssize_t
+DatagramBatch::receive(int fd)
+{
+  Impl& impl = *m_impl;
+
+#ifdef __linux__
+  for (size_t i = 0; i < m_batchSize; ++i) {
+    msghdr& hdr = impl.recvMsgs[i].msg_hdr;
+    hdr = {};
+    hdr.msg_name = &impl.senders[i];
+    hdr.msg_namelen = sizeof(sockaddr_storage);
+    hdr.msg_iov = &impl.recvIovs[i];
+    hdr.msg_iovlen = 1;
+    impl.recvMsgs[i].msg_len = 0;
+  }
+
+  int nReceived = ::recvmmsg(fd, impl.recvMsgs.data(), static_cast<unsigned>(m_batchSize),
+                             MSG_DONTWAIT, nullptr);
+  if (nReceived < 0) {
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+  }
+
+  for (int i = 0; i < nReceived; ++i) {
+    impl.payloadSizes[i] = impl.recvMsgs[i].msg_len;
+    impl.senderSizes[i] = impl.recvMsgs[i].msg_hdr.msg_namelen;
+  }
+  return nReceived;
+#else
+  impl.senderSizes[0] = sizeof(sockaddr_storage);
+  ssize_t nBytes = ::recvfrom(fd, impl.recvIovs[0].iov_base, impl.recvIovs[0].iov_len, MSG_DONTWAIT,
+                              reinterpret_cast<sockaddr*>(&impl.senders[0]), &impl.senderSizes[0]);
+  if (nBytes < 0) {
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+  }
+  impl.payloadSizes[0] = static_cast<size_t>(nBytes);
+  return 1;
+#endif
+}
+
+const uint8_t*
+DatagramBatch::getPayload(size_t i) const
+{
+  return &m_impl->buffers[i * ndn::MAX_NDN_PACKET_SIZE];
+}
+
+size_t
+DatagramBatch::getPayloadSize(size_t i) const
+{
+  return m_impl->payloadSizes[i];
+}
+
+const sockaddr*
+DatagramBatch::getSender(size_t i) const
+{
+  return reinterpret_cast<const sockaddr*>(&m_impl->senders[i]);
+}
+
+socklen_t
+DatagramBatch::getSenderSize(size_t i) const
+{
+  return m_impl->senderSizes[i];
+}
+
+ssize_t
+DatagramBatch::send(int fd, const std::deque<Block>& packets)
+{
+  Impl& impl = *m_impl;
+  size_t nPackets = std::min(m_batchSize, packets.size());
+  if (nPackets == 0) {
+    return 0;
+  }
+
+  for (size_t i = 0; i < nPackets; ++i) {
+    // sendmsg does not modify the payload
+    impl.sendIovs[i].iov_base = const_cast<uint8_t*>(packets[i].wire());
+    impl.sendIovs[i].iov_len = packets[i].size();
+  }
+
+#ifdef __linux__
+  for (size_t i = 0; i < nPackets; ++i) {
+    msghdr& hdr = impl.sendMsgs[i].msg_hdr;
+    hdr = {};
+    hdr.msg_iov = &impl.sendIovs[i];
+    hdr.msg_iovlen = 1;
+  }
+  return ::sendmmsg(fd, impl.sendMsgs.data(), static_cast<unsigned>(nPackets), MSG_DONTWAIT);
+#else
+  ssize_t nBytes = ::send(fd, impl.sendIovs[0].iov_base, impl.sendIovs[0].iov_len, MSG_DONTWAIT);
+  return nBytes < 0 ? -1 : 1;
+#endif
+}
+
+} // namespace face
+} // namespace nfd
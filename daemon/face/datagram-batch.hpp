@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_DATAGRAM_BATCH_HPP
+#define NFD_DAEMON_FACE_DATAGRAM_BATCH_HPP
+
+#include "core/common.hpp"
+
+#include <deque>
+
+#include <sys/socket.h>
+
+namespace nfd {
+namespace face {
+
+/** \brief moves batches of datagrams between a socket and a pool of buffers
+ *
+ *  On Linux, recvmmsg(2) and sendmmsg(2) move a whole batch in one system call.
+ *  On other platforms, each call moves a single datagram.
+ *  All operations are non-blocking, and are meant to be invoked after the socket
+ *  has been reported readable or writable by the event loop.
+ */
+class DatagramBatch : noncopyable
+{
+public:
+  /** \param batchSize maximum number of datagrams moved in one call, at least 1
+   */
+  explicit
+  DatagramBatch(size_t batchSize);
+
+  ~DatagramBatch();
+
+  size_t
+  getBatchSize() const
+  {
+    return m_batchSize;
+  }
+
+  /** \brief receive up to getBatchSize() datagrams queued on socket \p fd into the buffer pool
+   *  \return number of datagrams received, which is 0 if none is queued;
+   *          -1 on error, with errno set
+   *
+   *  Received datagrams are valid until the next call to receive().
+   */
+  ssize_t
+  receive(int fd);
+
+  /** \return payload of the i-th datagram received by the last receive()
+   */
+  const uint8_t*
+  getPayload(size_t i) const;
+
+  size_t
+  getPayloadSize(size_t i) const;
+
+  /** \return source address of the i-th datagram received by the last receive()
+   */
+  const sockaddr*
+  getSender(size_t i) const;
+
+  socklen_t
+  getSenderSize(size_t i) const;
+
+  /** \brief send up to getBatchSize() packets from the front of \p packets on connected socket \p fd
+   *  \return number of datagrams sent, which may be less than requested;
+   *          -1 on error, with errno set (EAGAIN or EWOULDBLOCK if the socket buffer is full)
+   */
+  ssize_t
+  send(int fd, const std::deque<Block>& packets);
+
+private:
+  struct Impl;
+
+  const size_t m_batchSize;
+  unique_ptr<Impl> m_impl;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_DATAGRAM_BATCH_HPP
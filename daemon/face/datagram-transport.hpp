@@ -27,10 +27,13 @@
 #define NFD_DAEMON_FACE_DATAGRAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "datagram-batch.hpp"
 #include "socket-utils.hpp"
 #include "core/global-io.hpp"
 
 #include <array>
+#include <cerrno>
+#include <cstring>
 
 namespace nfd {
 namespace face {
@@ -51,9 +54,13 @@ public:
   /** \brief Construct datagram transport.
    *
    *  \param socket Protocol-specific socket for the created transport
+   *  \param ioBatchSize maximum number of datagrams moved by one system call;
+   *                     if greater than 1, datagrams are received in bursts from a pool of
+   *                     buffers, and packets sent during one event loop iteration are coalesced
+   *                     into as few system calls as possible (see DatagramBatch)
    */
   explicit
-  DatagramTransport(typename protocol::socket&& socket);
+  DatagramTransport(typename protocol::socket&& socket, size_t ioBatchSize = 1);
 
   ssize_t
   getSendQueueLength() override;
@@ -65,6 +72,9 @@ public:
                   const boost::system::error_code& error);
 
 protected:
+  bool
+  canSendSeparateHeader() const override;
+
   void
   doClose() override;
 
@@ -74,6 +84,15 @@ protected:
   void
   handleSend(const boost::system::error_code& error, size_t nBytesSent);
 
+  void
+  waitForBatch();
+
+  void
+  handleBatchReceive(const boost::system::error_code& error);
+
+  void
+  flushSendQueue();
+
   void
   handleReceive(const boost::system::error_code& error, size_t nBytesReceived);
 
@@ -98,11 +117,18 @@ protected:
 private:
   std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
   bool m_hasRecentlyReceived;
+
+  unique_ptr<DatagramBatch> m_batch; ///< used only in batched mode
+  std::deque<Block> m_sendQueue; ///< packets waiting for flushSendQueue in batched mode
+  size_t m_sendQueueBytes = 0;
+  /// expires when the transport is destroyed; checked by flushes posted in batched mode
+  shared_ptr<bool> m_flushGuard = make_shared<bool>();
 };
 
 
 template<class T, class U>
-DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol::socket&& socket)
+DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol::socket&& socket,
+                                           size_t ioBatchSize)
   : m_socket(std::move(socket))
   , m_hasRecentlyReceived(false)
 {
@@ -117,6 +143,12 @@ DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol:
     this->setSendQueueCapacity(sendBufferSizeOption.value());
   }
 
+  if (ioBatchSize > 1) {
+    m_batch = make_unique<DatagramBatch>(ioBatchSize);
+    waitForBatch();
+    return;
+  }
+
   m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
                               [this] (auto&&... args) {
                                 this->handleReceive(std::forward<decltype(args)>(args)...);
@@ -131,6 +163,9 @@ DatagramTransport<T, U>::getSendQueueLength()
   if (queueLength == QUEUE_ERROR) {
     NFD_LOG_FACE_WARN("Failed to obtain send queue length from socket: " << std::strerror(errno));
   }
+  else if (queueLength != QUEUE_UNSUPPORTED) {
+    queueLength += m_sendQueueBytes;
+  }
   return queueLength;
 }
 
@@ -155,15 +190,44 @@ DatagramTransport<T, U>::doClose()
   });
 }
 
+template<class T, class U>
+bool
+DatagramTransport<T, U>::canSendSeparateHeader() const
+{
+  return true;
+}
+
 template<class T, class U>
 void
 DatagramTransport<T, U>::doSend(Transport::Packet&& packet)
 {
   NFD_LOG_FACE_TRACE(__func__);
 
-  m_socket.async_send(boost::asio::buffer(packet.packet),
-                      // packet.packet is copied into the lambda to retain the underlying Buffer
-                      [this, p = packet.packet] (auto&&... args) {
+  if (m_batch) {
+    // DatagramBatch sends each datagram from a single buffer
+    packet.join();
+    m_sendQueueBytes += packet.packet.size();
+    m_sendQueue.push_back(std::move(packet.packet));
+    if (m_sendQueue.size() == 1) {
+      // flush after the current event loop iteration, so that packets sent meanwhile are coalesced;
+      // the face may be destroyed before the flush runs
+      getGlobalIoService().post([this, guard = weak_ptr<bool>(m_flushGuard)] {
+        if (!guard.expired()) {
+          this->flushSendQueue();
+        }
+      });
+    }
+    return;
+  }
+
+  std::array<boost::asio::const_buffer, 2> buffers{{{}, boost::asio::buffer(packet.packet)}};
+  if (packet.header != nullptr) {
+    buffers[0] = boost::asio::buffer(packet.header->data(), packet.header->size());
+  }
+
+  m_socket.async_send(buffers,
+                      // header and packet are copied into the lambda to retain the underlying Buffers
+                      [this, h = packet.header, p = packet.packet] (auto&&... args) {
                         this->handleSend(std::forward<decltype(args)>(args)...);
                       });
 }
@@ -221,6 +285,81 @@ DatagramTransport<T, U>::handleSend(const boost::system::error_code& error, size
   NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
 }
 
+template<class T, class U>
+void
+DatagramTransport<T, U>::waitForBatch()
+{
+  m_socket.async_receive(boost::asio::null_buffers(),
+                         [this] (const boost::system::error_code& error, size_t) {
+                           this->handleBatchReceive(error);
+                         });
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::handleBatchReceive(const boost::system::error_code& error)
+{
+  if (error)
+    return processErrorCode(error);
+
+  ssize_t nReceived = m_batch->receive(m_socket.native_handle());
+  if (nReceived < 0)
+    return processErrorCode(boost::system::error_code(errno, boost::system::system_category()));
+
+  for (ssize_t i = 0; i < nReceived && m_socket.is_open(); ++i) {
+    socklen_t senderSize = m_batch->getSenderSize(i);
+    if (senderSize > 0 && senderSize <= m_sender.capacity()) {
+      m_sender.resize(senderSize);
+      std::memcpy(m_sender.data(), m_batch->getSender(i), senderSize);
+    }
+    receiveDatagram(m_batch->getPayload(i), m_batch->getPayloadSize(i), {});
+  }
+
+  if (m_socket.is_open())
+    waitForBatch();
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::flushSendQueue()
+{
+  if (!m_socket.is_open()) {
+    m_sendQueue.clear();
+    m_sendQueueBytes = 0;
+    return;
+  }
+
+  while (!m_sendQueue.empty()) {
+    ssize_t nSent = m_batch->send(m_socket.native_handle(), m_sendQueue);
+    if (nSent < 0) {
+      int errorNo = errno;
+      if (errorNo == EAGAIN || errorNo == EWOULDBLOCK) {
+        // socket buffer is full, resume when the socket becomes writable
+        m_socket.async_send(boost::asio::null_buffers(),
+                            [this, guard = weak_ptr<bool>(m_flushGuard)] (const boost::system::error_code& error,
+                                                                          size_t) {
+                              if (guard.expired())
+                                return;
+                              if (error)
+                                return processErrorCode(error);
+                              this->flushSendQueue();
+                            });
+        return;
+      }
+
+      m_sendQueue.clear();
+      m_sendQueueBytes = 0;
+      return processErrorCode(boost::system::error_code(errorNo, boost::system::system_category()));
+    }
+
+    NFD_LOG_FACE_TRACE("Successfully sent: " << nSent << " datagrams");
+    for (ssize_t i = 0; i < nSent; ++i) {
+      m_sendQueueBytes -= m_sendQueue.front().size();
+      m_sendQueue.pop_front();
+    }
+  }
+}
+
 template<class T, class U>
 void
 DatagramTransport<T, U>::processErrorCode(const boost::system::error_code& error)
@@ -38,12 +38,14 @@ namespace face {
 NFD_LOG_INIT(EthernetChannel);
 
 EthernetChannel::EthernetChannel(shared_ptr<const ndn::net::NetworkInterface> localEndpoint,
-                                 time::nanoseconds idleTimeout)
+                                 time::nanoseconds idleTimeout,
+                                 const EthernetPacketRing::Options& ringOptions)
   : m_localEndpoint(std::move(localEndpoint))
   , m_isListening(false)
   , m_socket(getGlobalIoService())
   , m_pcap(m_localEndpoint->getName())
   , m_idleFaceTimeout(idleTimeout)
+  , m_ringOptions(ringOptions)
 #ifdef _DEBUG
   , m_nDropped(0)
 #endif
@@ -204,7 +206,7 @@ EthernetChannel::createFace(const ethernet::Address& remoteEndpoint,
   auto linkService = make_unique<GenericLinkService>(options);
   auto transport = make_unique<UnicastEthernetTransport>(*m_localEndpoint, remoteEndpoint,
                                                          params.persistency, m_idleFaceTimeout,
-                                                         params.mtu);
+                                                         params.mtu, m_ringOptions);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_channelFaces[remoteEndpoint] = face;
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FACE_ETHERNET_CHANNEL_HPP
 
 #include "channel.hpp"
+#include "ethernet-packet-ring.hpp"
 #include "ethernet-protocol.hpp"
 #include "pcap-helper.hpp"
 #include <ndn-cxx/net/network-interface.hpp>
@@ -58,9 +59,13 @@ public:
    *
    * To enable creation of faces upon incoming connections,
    * one needs to explicitly call EthernetChannel::listen method.
+   *
+   * \param ringOptions packet ring options of the unicast faces created by this channel;
+   *                    the channel itself always listens through libpcap
    */
   EthernetChannel(shared_ptr<const ndn::net::NetworkInterface> localEndpoint,
-                  time::nanoseconds idleTimeout);
+                  time::nanoseconds idleTimeout,
+                  const EthernetPacketRing::Options& ringOptions = {});
 
   bool
   isListening() const override
@@ -129,6 +134,7 @@ private:
   PcapHelper m_pcap;
   std::map<ethernet::Address, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
+  const EthernetPacketRing::Options m_ringOptions; ///< Packet ring options of new faces
 
 #ifdef _DEBUG
   /// number of frames dropped by the kernel, as reported by libpcap
@@ -63,6 +63,9 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
   //   mcast yes
   //   mcast_group 01:00:5E:00:17:AA
   //   mcast_ad_hoc no
+  //   packet_ring no
+  //   packet_ring_blocks 16
+  //   packet_ring_tx_frames 256
   //   whitelist
   //   {
   //     *
@@ -74,6 +77,7 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
 
   UnicastConfig unicastConfig;
   MulticastConfig mcastConfig;
+  EthernetPacketRing::Options ringOptions;
 
   if (configSection) {
     // listen and mcast default to 'yes' but only if face_system.ether section is present
@@ -108,6 +112,23 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
         bool wantAdHoc = ConfigFile::parseYesNo(pair, "face_system.ether");
         mcastConfig.linkType = wantAdHoc ? ndn::nfd::LINK_TYPE_AD_HOC : ndn::nfd::LINK_TYPE_MULTI_ACCESS;
       }
+      else if (key == "packet_ring") {
+        ringOptions.isEnabled = ConfigFile::parseYesNo(pair, "face_system.ether");
+      }
+      else if (key == "packet_ring_blocks") {
+        ringOptions.nRxBlocks = ConfigFile::parseNumber<size_t>(pair, "face_system.ether");
+        if (ringOptions.nRxBlocks == 0 || ringOptions.nRxBlocks > 1024) {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("face_system.ether.packet_ring_blocks must be "
+                                                  "between 1 and 1024"));
+        }
+      }
+      else if (key == "packet_ring_tx_frames") {
+        ringOptions.nTxFrames = ConfigFile::parseNumber<size_t>(pair, "face_system.ether");
+        if (ringOptions.nTxFrames == 0 || ringOptions.nTxFrames > 65536) {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("face_system.ether.packet_ring_tx_frames must be "
+                                                  "between 1 and 65536"));
+        }
+      }
       else if (key == "whitelist") {
         mcastConfig.netifPredicate.parseWhitelist(value);
       }
@@ -120,6 +141,12 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
     }
   }
 
+#ifndef __linux__
+  if (ringOptions.isEnabled) {
+    BOOST_THROW_EXCEPTION(ConfigFile::Error("face_system.ether.packet_ring is only supported on Linux"));
+  }
+#endif
+
   if (context.isDryRun) {
     return;
   }
@@ -157,10 +184,19 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
     }
   }
 
+  if (m_ringOptions.isEnabled != ringOptions.isEnabled ||
+      m_ringOptions.nRxBlocks != ringOptions.nRxBlocks ||
+      m_ringOptions.nTxFrames != ringOptions.nTxFrames) {
+    if (!m_channels.empty() || !m_mcastFaces.empty()) {
+      NFD_LOG_WARN("Packet ring settings apply to new Ethernet channels and faces only");
+    }
+  }
+
   // Even if there's no configuration change, we still need to re-apply configuration because
   // netifs may have changed.
   m_unicastConfig = unicastConfig;
   m_mcastConfig = mcastConfig;
+  m_ringOptions = ringOptions;
   this->applyConfig(context);
 }
 
@@ -217,13 +253,14 @@ EthernetFactory::doCreateFace(const CreateFaceRequest& req,
 
 shared_ptr<EthernetChannel>
 EthernetFactory::createChannel(const shared_ptr<const ndn::net::NetworkInterface>& localEndpoint,
-                               time::nanoseconds idleTimeout)
+                               time::nanoseconds idleTimeout,
+                               const EthernetPacketRing::Options& ringOptions)
 {
   auto it = m_channels.find(localEndpoint->getName());
   if (it != m_channels.end())
     return it->second;
 
-  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout);
+  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout, ringOptions);
   m_channels[localEndpoint->getName()] = channel;
   return channel;
 }
@@ -251,7 +288,8 @@ EthernetFactory::createMulticastFace(const ndn::net::NetworkInterface& netif,
   opts.allowReassembly = true;
 
   auto linkService = make_unique<GenericLinkService>(opts);
-  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType);
+  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType,
+                                                          m_ringOptions);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_mcastFaces[key] = face;
@@ -282,7 +320,7 @@ EthernetFactory::applyUnicastConfigToNetif(const shared_ptr<const ndn::net::Netw
     return nullptr;
   }
 
-  auto channel = this->createChannel(netif, m_unicastConfig.idleTimeout);
+  auto channel = this->createChannel(netif, m_unicastConfig.idleTimeout, m_ringOptions);
   if (m_unicastConfig.wantListen && !channel->isListening()) {
     try {
       channel->listen(this->addFace, nullptr);
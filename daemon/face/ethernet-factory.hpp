@@ -51,11 +51,13 @@ public:
    *
    * \return always a valid pointer to a EthernetChannel object, an exception
    *         is thrown if it cannot be created.
+   * \param ringOptions packet ring options of the unicast faces created by the channel
    * \throw PcapHelper::Error channel creation failed
    */
   shared_ptr<EthernetChannel>
   createChannel(const shared_ptr<const ndn::net::NetworkInterface>& localEndpoint,
-                time::nanoseconds idleTimeout);
+                time::nanoseconds idleTimeout,
+                const EthernetPacketRing::Options& ringOptions = {});
 
   /**
    * \brief Create a face to communicate on the given Ethernet multicast group
@@ -122,6 +124,9 @@ private:
   };
   MulticastConfig m_mcastConfig;
 
+  /// packet ring options of new unicast and multicast faces
+  EthernetPacketRing::Options m_ringOptions;
+
   /// (ifname, group) => face
   std::map<std::pair<std::string, ethernet::Address>, shared_ptr<Face>> m_mcastFaces;
 
@@ -0,0 +1,382 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ethernet-packet-ring.hpp"
+#include "ethernet-protocol.hpp"
+
+#include <pcap/pcap.h>
+
+#include <algorithm>
+#include <cerrno>  // for errno
+#include <cstring> // for strerror()
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/filter.h>   // for struct sock_fprog
+#include <linux/if_packet.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+
+#include <boost/endian/conversion.hpp>
+#endif
+
+#if !defined(PCAP_NETMASK_UNKNOWN)
+#define PCAP_NETMASK_UNKNOWN  0xffffffff
+#endif
+
+namespace nfd {
+namespace face {
+
+#if defined(__linux__)
+
+static size_t
+roundUpToPowerOfTwo(size_t n)
+{
+  size_t result = 1;
+  while (result < n) {
+    result <<= 1;
+  }
+  return result;
+}
+
+static uint8_t*
+getTxFrameData(uint8_t* slot)
+{
+  // with TPACKET_V3, the kernel reads the frame from this offset of the slot
+  return slot + TPACKET3_HDRLEN - sizeof(sockaddr_ll);
+}
+
+EthernetPacketRing::EthernetPacketRing(const std::string& interfaceName, int interfaceIndex,
+                                       size_t mtu, const Options& options)
+  : m_interfaceName(interfaceName)
+  , m_fd(-1)
+  , m_map(nullptr)
+  , m_mapSize(0)
+  , m_rxBlockSize(options.blockSize)
+  , m_nRxBlocks(options.nRxBlocks)
+  , m_rxBlockIndex(0)
+  , m_txRing(nullptr)
+  , m_txFrameSize(0)
+  , m_nTxFrames(0)
+  , m_txFrameIndex(0)
+  , m_maxFrameSize(ethernet::HDR_LEN + std::max(mtu, ethernet::MIN_DATA_LEN))
+  , m_isFlushPending(false)
+  , m_nDropped(0)
+{
+  auto fail = [this] (const std::string& what) {
+    std::string msg = m_interfaceName + ": " + what + ": " + std::strerror(errno);
+    if (m_fd >= 0) {
+      ::close(m_fd);
+    }
+    BOOST_THROW_EXCEPTION(Error(msg));
+  };
+
+  if (m_rxBlockSize == 0 || m_rxBlockSize % ::getpagesize() != 0 || m_nRxBlocks == 0) {
+    BOOST_THROW_EXCEPTION(Error(m_interfaceName + ": invalid receive ring geometry"));
+  }
+
+  // protocol 0: nothing is received until the socket is bound below
+  m_fd = ::socket(AF_PACKET, SOCK_RAW, 0);
+  if (m_fd < 0) {
+    fail("socket(AF_PACKET)");
+  }
+
+  int version = TPACKET_V3;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0) {
+    fail("setsockopt(PACKET_VERSION)");
+  }
+
+  // receive ring: frames are packed into blocks, a block is handed over when full or timed out
+  tpacket_req3 rxReq{};
+  rxReq.tp_block_size = m_rxBlockSize;
+  rxReq.tp_block_nr = m_nRxBlocks;
+  rxReq.tp_frame_size = TPACKET_ALIGNMENT << 7;
+  rxReq.tp_frame_nr = m_rxBlockSize / rxReq.tp_frame_size * m_nRxBlocks;
+  rxReq.tp_retire_blk_tov = std::max<time::milliseconds::rep>(options.blockTimeout.count(), 1);
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_RX_RING, &rxReq, sizeof(rxReq)) < 0) {
+    fail("setsockopt(PACKET_RX_RING)");
+  }
+  size_t rxSize = m_rxBlockSize * m_nRxBlocks;
+
+  // transmit ring: one frame per slot; TPACKET_V3 transmit rings require Linux 4.11 or later,
+  // older kernels get one send(2) per frame instead
+  size_t txSize = 0;
+  if (options.nTxFrames > 0) {
+    m_txFrameSize = std::max<size_t>(roundUpToPowerOfTwo(TPACKET3_HDRLEN + m_maxFrameSize), 2048);
+    size_t txBlockSize = std::max(m_txFrameSize, m_rxBlockSize);
+    size_t framesPerBlock = txBlockSize / m_txFrameSize;
+    size_t nTxBlocks = (options.nTxFrames + framesPerBlock - 1) / framesPerBlock;
+
+    tpacket_req3 txReq{};
+    txReq.tp_block_size = txBlockSize;
+    txReq.tp_block_nr = nTxBlocks;
+    txReq.tp_frame_size = m_txFrameSize;
+    txReq.tp_frame_nr = nTxBlocks * framesPerBlock;
+    if (::setsockopt(m_fd, SOL_PACKET, PACKET_TX_RING, &txReq, sizeof(txReq)) == 0) {
+      m_nTxFrames = txReq.tp_frame_nr;
+      txSize = txBlockSize * nTxBlocks;
+    }
+  }
+  if (txSize == 0) {
+    m_txBuffer.resize(m_maxFrameSize);
+  }
+
+  m_mapSize = rxSize + txSize;
+  void* map = ::mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (map == MAP_FAILED) {
+    fail("mmap");
+  }
+  m_map = static_cast<uint8_t*>(map);
+  if (txSize > 0) {
+    m_txRing = m_map + rxSize;
+  }
+
+  sockaddr_ll sll{};
+  sll.sll_family = AF_PACKET;
+  sll.sll_protocol = boost::endian::native_to_big(ethernet::ETHERTYPE_NDN);
+  sll.sll_ifindex = interfaceIndex;
+  if (::bind(m_fd, reinterpret_cast<sockaddr*>(&sll), sizeof(sll)) < 0) {
+    ::munmap(m_map, m_mapSize);
+    fail("bind");
+  }
+}
+
+EthernetPacketRing::~EthernetPacketRing()
+{
+  if (m_map != nullptr) {
+    ::munmap(m_map, m_mapSize);
+  }
+  if (m_fd >= 0) {
+    ::close(m_fd);
+  }
+}
+
+int
+EthernetPacketRing::getFd() const
+{
+  // the caller and this object each close their own fd, as with PcapHelper::getFd
+  int fd = ::dup(m_fd);
+  if (fd < 0)
+    BOOST_THROW_EXCEPTION(Error(m_interfaceName + ": dup: " + std::strerror(errno)));
+  return fd;
+}
+
+void
+EthernetPacketRing::setPacketFilter(const char* filter) const
+{
+  pcap_t* pcap = pcap_open_dead(DLT_EN10MB, ndn::MAX_NDN_PACKET_SIZE + ethernet::HDR_LEN);
+  if (pcap == nullptr)
+    BOOST_THROW_EXCEPTION(Error("pcap_open_dead failed"));
+
+  bpf_program prog;
+  if (pcap_compile(pcap, &prog, filter, 1, PCAP_NETMASK_UNKNOWN) < 0) {
+    std::string msg = "pcap_compile: " + std::string(pcap_geterr(pcap));
+    pcap_close(pcap);
+    BOOST_THROW_EXCEPTION(Error(msg));
+  }
+
+  // struct bpf_insn and struct sock_filter have the same layout
+  sock_fprog fprog{};
+  fprog.len = static_cast<unsigned short>(prog.bf_len);
+  fprog.filter = reinterpret_cast<sock_filter*>(prog.bf_insns);
+  int ret = ::setsockopt(m_fd, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog));
+  int savedErrno = errno;
+  pcap_freecode(&prog);
+  pcap_close(pcap);
+  if (ret < 0)
+    BOOST_THROW_EXCEPTION(Error("setsockopt(SO_ATTACH_FILTER): " + std::string(std::strerror(savedErrno))));
+}
+
+size_t
+EthernetPacketRing::receive(const std::function<void(const uint8_t*, size_t)>& onFrame)
+{
+  size_t nFrames = 0;
+  while (true) {
+    auto block = reinterpret_cast<tpacket_block_desc*>(m_map + m_rxBlockIndex * m_rxBlockSize);
+    if ((__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER) == 0) {
+      break;
+    }
+
+    auto frame = reinterpret_cast<tpacket3_hdr*>(reinterpret_cast<uint8_t*>(block) +
+                                                 block->hdr.bh1.offset_to_first_pkt);
+    for (uint32_t i = 0; i < block->hdr.bh1.num_pkts; ++i) {
+      // frames whose VLAN tag was stripped by the NIC are not ours, see "not vlan" in pcap filters
+      if ((frame->tp_status & TP_STATUS_VLAN_VALID) == 0) {
+        onFrame(reinterpret_cast<const uint8_t*>(frame) + frame->tp_mac, frame->tp_snaplen);
+      }
+      ++nFrames;
+      frame = reinterpret_cast<tpacket3_hdr*>(reinterpret_cast<uint8_t*>(frame) + frame->tp_next_offset);
+    }
+
+    // return the block to the kernel
+    __atomic_store_n(&block->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+    m_rxBlockIndex = (m_rxBlockIndex + 1) % m_nRxBlocks;
+  }
+  return nFrames;
+}
+
+uint8_t*
+EthernetPacketRing::allocateFrame()
+{
+  if (m_txRing == nullptr) {
+    return m_isFlushPending ? nullptr : m_txBuffer.data();
+  }
+
+  auto slot = m_txRing + m_txFrameIndex * m_txFrameSize;
+  auto hdr = reinterpret_cast<tpacket3_hdr*>(slot);
+  uint32_t status = __atomic_load_n(&hdr->tp_status, __ATOMIC_ACQUIRE);
+  if (status != TP_STATUS_AVAILABLE && (status & TP_STATUS_WRONG_FORMAT) == 0) {
+    // the kernel has not transmitted this slot yet
+    return nullptr;
+  }
+  return getTxFrameData(slot);
+}
+
+void
+EthernetPacketRing::commitFrame(size_t length)
+{
+  BOOST_ASSERT(length <= m_maxFrameSize);
+
+  if (m_txRing == nullptr) {
+    m_txBuffer.resize(length);
+    m_isFlushPending = true;
+    return;
+  }
+
+  auto hdr = reinterpret_cast<tpacket3_hdr*>(m_txRing + m_txFrameIndex * m_txFrameSize);
+  hdr->tp_len = length;
+  hdr->tp_snaplen = length;
+  hdr->tp_next_offset = 0;
+  __atomic_store_n(&hdr->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+  m_txFrameIndex = (m_txFrameIndex + 1) % m_nTxFrames;
+  m_isFlushPending = true;
+}
+
+bool
+EthernetPacketRing::flush()
+{
+  if (!m_isFlushPending) {
+    return true;
+  }
+
+  ssize_t ret = 0;
+  if (m_txRing == nullptr) {
+    ret = ::send(m_fd, m_txBuffer.data(), m_txBuffer.size(), MSG_DONTWAIT);
+    if (ret >= 0) {
+      m_txBuffer.resize(m_maxFrameSize);
+    }
+  }
+  else {
+    // a zero-length send transmits every slot in TP_STATUS_SEND_REQUEST
+    ret = ::send(m_fd, nullptr, 0, MSG_DONTWAIT);
+  }
+
+  if (ret < 0) {
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS;
+  }
+  m_isFlushPending = false;
+  return true;
+}
+
+size_t
+EthernetPacketRing::getNDropped()
+{
+  // the kernel resets its counters each time they are read
+  tpacket_stats_v3 stats{};
+  socklen_t len = sizeof(stats);
+  if (::getsockopt(m_fd, SOL_PACKET, PACKET_STATISTICS, &stats, &len) == 0) {
+    m_nDropped += stats.tp_drops;
+  }
+  return m_nDropped;
+}
+
+#else // __linux__
+
+EthernetPacketRing::EthernetPacketRing(const std::string& interfaceName, int, size_t,
+                                       const Options&)
+  : m_interfaceName(interfaceName)
+  , m_fd(-1)
+  , m_map(nullptr)
+  , m_mapSize(0)
+  , m_rxBlockSize(0)
+  , m_nRxBlocks(0)
+  , m_rxBlockIndex(0)
+  , m_txRing(nullptr)
+  , m_txFrameSize(0)
+  , m_nTxFrames(0)
+  , m_txFrameIndex(0)
+  , m_maxFrameSize(0)
+  , m_isFlushPending(false)
+  , m_nDropped(0)
+{
+  BOOST_THROW_EXCEPTION(Error(m_interfaceName + ": PACKET_MMAP rings are only supported on Linux"));
+}
+
+EthernetPacketRing::~EthernetPacketRing() = default;
+
+int
+EthernetPacketRing::getFd() const
+{
+  return -1;
+}
+
+void
+EthernetPacketRing::setPacketFilter(const char*) const
+{
+}
+
+size_t
+EthernetPacketRing::receive(const std::function<void(const uint8_t*, size_t)>&)
+{
+  return 0;
+}
+
+uint8_t*
+EthernetPacketRing::allocateFrame()
+{
+  return nullptr;
+}
+
+void
+EthernetPacketRing::commitFrame(size_t)
+{
+}
+
+bool
+EthernetPacketRing::flush()
+{
+  return true;
+}
+
+size_t
+EthernetPacketRing::getNDropped()
+{
+  return 0;
+}
+
+#endif // __linux__
+
+} // namespace face
+} // namespace nfd
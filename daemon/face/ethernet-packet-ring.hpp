@@ -0,0 +1,197 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+#define NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+
+#include "core/common.hpp"
+
+#ifndef HAVE_LIBPCAP
+#error "Cannot include this file when libpcap is not available"
+#endif
+
+namespace nfd {
+namespace face {
+
+/**
+ * @brief AF_PACKET socket with memory-mapped TPACKET_V3 receive and transmit rings.
+ *
+ * The kernel places received frames into blocks of a ring shared with the process, so that
+ * every frame that arrived since the last readiness notification is processed in place,
+ * without a system call or a copy per frame. Outgoing frames are written into slots of the
+ * transmit ring and handed to the kernel together by a single send(2).
+ *
+ * The rings are only available on Linux. On other platforms, the constructor throws.
+ */
+class EthernetPacketRing : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /**
+   * @brief Options that control the ring geometry
+   */
+  struct Options
+  {
+    /** @brief use the rings instead of libpcap
+     */
+    bool isEnabled = false;
+
+    /** @brief size of each block of the receive ring, in octets; must be a multiple of the page size
+     */
+    size_t blockSize = 1 << 17;
+
+    /** @brief number of blocks in the receive ring
+     */
+    size_t nRxBlocks = 16;
+
+    /** @brief number of frame slots in the transmit ring
+     */
+    size_t nTxFrames = 256;
+
+    /** @brief how long the kernel may hold a partially filled receive block
+     */
+    time::milliseconds blockTimeout = 1_ms;
+  };
+
+  /**
+   * @brief Open an AF_PACKET socket bound to a network interface and map its rings.
+   * @param interfaceName name of the network interface, used in error messages
+   * @param interfaceIndex index of the network interface
+   * @param mtu largest frame payload to be transmitted
+   * @param options ring geometry
+   * @throw Error on any error
+   */
+  EthernetPacketRing(const std::string& interfaceName, int interfaceIndex, size_t mtu,
+                     const Options& options);
+
+  ~EthernetPacketRing();
+
+  /**
+   * @brief Obtain a file descriptor that can be used in calls such as select(2) and poll(2).
+   * @return A selectable file descriptor. It is the caller's responsibility to close the fd.
+   * @throw Error on any error
+   */
+  int
+  getFd() const;
+
+  /**
+   * @brief Install a BPF filter on the socket.
+   * @param filter Null-terminated string containing the BPF program source.
+   * @throw Error on any error
+   * @sa pcap-filter(7)
+   */
+  void
+  setPacketFilter(const char* filter) const;
+
+  /**
+   * @brief Process every frame the kernel has delivered into the receive ring.
+   * @param onFrame called with each frame, including the link-layer header;
+   *                the pointer is valid only during the call
+   * @return number of frames processed
+   */
+  size_t
+  receive(const std::function<void(const uint8_t* frame, size_t length)>& onFrame);
+
+  /**
+   * @brief Reserve the next free slot of the transmit ring.
+   * @return pointer to a buffer of getMaxFrameSize() octets, or nullptr if the ring is full
+   * @post the slot is handed to the kernel by commitFrame()
+   */
+  uint8_t*
+  allocateFrame();
+
+  /**
+   * @brief Queue the frame written into the slot returned by the last allocateFrame().
+   * @param length frame length, including the link-layer header
+   */
+  void
+  commitFrame(size_t length);
+
+  /**
+   * @brief Ask the kernel to transmit all queued frames.
+   * @return true on success, or if the kernel cannot accept more frames at the moment
+   *         (isFlushPending() is then true); false on error, with errno set
+   */
+  bool
+  flush();
+
+  /**
+   * @return whether queued frames are waiting for the kernel to accept them
+   */
+  bool
+  isFlushPending() const
+  {
+    return m_isFlushPending;
+  }
+
+  /**
+   * @return maximum length of a frame in the transmit ring
+   */
+  size_t
+  getMaxFrameSize() const
+  {
+    return m_maxFrameSize;
+  }
+
+  /**
+   * @brief Get the number of frames dropped by the kernel since the socket was opened.
+   */
+  size_t
+  getNDropped();
+
+private:
+  std::string m_interfaceName;
+  int m_fd;
+  uint8_t* m_map;
+  size_t m_mapSize;
+
+  size_t m_rxBlockSize;
+  size_t m_nRxBlocks;
+  size_t m_rxBlockIndex;
+
+  uint8_t* m_txRing; ///< nullptr if the kernel does not support a TPACKET_V3 transmit ring
+  size_t m_txFrameSize;
+  size_t m_nTxFrames;
+  size_t m_txFrameIndex;
+  std::vector<uint8_t> m_txBuffer; ///< used instead of the transmit ring if it is unavailable
+  size_t m_maxFrameSize;
+  bool m_isFlushPending;
+
+  size_t m_nDropped;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
@@ -29,7 +29,8 @@
 
 #include <pcap/pcap.h>
 
-#include <cstring> // for memcpy()
+#include <cerrno>  // for errno
+#include <cstring> // for memcpy(), memset(), strerror()
 
 #include <boost/endian/conversion.hpp>
 
@@ -39,24 +40,36 @@ namespace face {
 NFD_LOG_INIT(EthernetTransport);
 
 EthernetTransport::EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                                     const ethernet::Address& remoteEndpoint)
+                                     const ethernet::Address& remoteEndpoint,
+                                     const EthernetPacketRing::Options& ringOptions)
   : m_socket(getGlobalIoService())
   , m_pcap(localEndpoint.getName())
   , m_srcAddress(localEndpoint.getEthernetAddress())
   , m_destAddress(remoteEndpoint)
   , m_interfaceName(localEndpoint.getName())
   , m_hasRecentlyReceived(false)
+  , m_isRingFlushScheduled(false)
 #ifdef _DEBUG
   , m_nDropped(0)
 #endif
 {
   try {
-    m_pcap.activate(DLT_EN10MB);
-    m_socket.assign(m_pcap.getFd());
+    if (ringOptions.isEnabled) {
+      m_ring = make_unique<EthernetPacketRing>(localEndpoint.getName(), localEndpoint.getIndex(),
+                                               localEndpoint.getMtu(), ringOptions);
+      m_socket.assign(m_ring->getFd());
+    }
+    else {
+      m_pcap.activate(DLT_EN10MB);
+      m_socket.assign(m_pcap.getFd());
+    }
   }
   catch (const PcapHelper::Error& e) {
     BOOST_THROW_EXCEPTION(Error(e.what()));
   }
+  catch (const EthernetPacketRing::Error& e) {
+    BOOST_THROW_EXCEPTION(Error(e.what()));
+  }
 
   m_netifStateConn = localEndpoint.onStateChanged.connect(
     [=] (ndn::net::InterfaceState, ndn::net::InterfaceState newState) {
@@ -81,12 +94,26 @@ EthernetTransport::doClose()
   m_pcap.close();
 
   // Ensure that the Transport stays alive at least
-  // until all pending handlers are dispatched
+  // until all pending handlers are dispatched.
+  // The packet ring is unmapped only then, because doClose may be called
+  // while frames of the receive ring are being processed.
   getGlobalIoService().post([this] {
+    m_ring.reset();
     this->setState(TransportState::CLOSED);
   });
 }
 
+void
+EthernetTransport::setPacketFilter(const char* filter)
+{
+  if (m_ring != nullptr) {
+    m_ring->setPacketFilter(filter);
+  }
+  else {
+    m_pcap.setPacketFilter(filter);
+  }
+}
+
 void
 EthernetTransport::handleNetifStateChange(ndn::net::InterfaceState netifState)
 {
@@ -112,6 +139,10 @@ EthernetTransport::doSend(Transport::Packet&& packet)
 void
 EthernetTransport::sendPacket(const ndn::Block& block)
 {
+  if (m_ring != nullptr) {
+    return sendPacketToRing(block);
+  }
+
   ndn::EncodingBuffer buffer(block);
 
   // pad with zeroes if the payload is too short
@@ -138,6 +169,77 @@ EthernetTransport::sendPacket(const ndn::Block& block)
     NFD_LOG_FACE_TRACE("Successfully sent: " << block.size() << " bytes");
 }
 
+void
+EthernetTransport::sendPacketToRing(const ndn::Block& block)
+{
+  // pad with zeroes if the payload is too short
+  size_t payloadLen = std::max(block.size(), ethernet::MIN_DATA_LEN);
+  size_t frameLen = ethernet::HDR_LEN + payloadLen;
+  if (frameLen > m_ring->getMaxFrameSize()) {
+    handleError("Failed to send the full frame: size=" + to_string(frameLen) +
+                " max=" + to_string(m_ring->getMaxFrameSize()));
+    return;
+  }
+
+  uint8_t* frame = m_ring->allocateFrame();
+  if (frame == nullptr) {
+    // transmit ring is full, hand the queued frames to the kernel and try again
+    flushRing();
+    frame = m_ring != nullptr ? m_ring->allocateFrame() : nullptr;
+    if (frame == nullptr) {
+      NFD_LOG_FACE_DEBUG("Transmit ring is full, dropping " << block.size() << " bytes");
+      return;
+    }
+  }
+
+
+  uint16_t ethertype = boost::endian::native_to_big(ethernet::ETHERTYPE_NDN);
+  std::memcpy(frame, m_destAddress.data(), m_destAddress.size());
+  std::memcpy(frame + ethernet::ADDR_LEN, m_srcAddress.data(), m_srcAddress.size());
+  std::memcpy(frame + 2 * ethernet::ADDR_LEN, &ethertype, ethernet::TYPE_LEN);
+  std::memcpy(frame + ethernet::HDR_LEN, block.wire(), block.size());
+  std::memset(frame + ethernet::HDR_LEN + block.size(), 0, payloadLen - block.size());
+  m_ring->commitFrame(frameLen);
+  NFD_LOG_FACE_TRACE("Queued in transmit ring: " << block.size() << " bytes");
+
+  // frames queued in the same event loop iteration are handed to the kernel together;
+  // the face may be destroyed before the flush runs
+  if (!m_isRingFlushScheduled) {
+    m_isRingFlushScheduled = true;
+    getGlobalIoService().post([this, guard = weak_ptr<bool>(m_flushGuard)] {
+      if (!guard.expired()) {
+        m_isRingFlushScheduled = false;
+        flushRing();
+      }
+    });
+  }
+}
+
+void
+EthernetTransport::flushRing()
+{
+  if (m_ring == nullptr) {
+    return;
+  }
+
+  if (!m_ring->flush()) {
+    handleError("Send operation failed: "s + std::strerror(errno));
+    return;
+  }
+
+  if (m_ring->isFlushPending() && !m_isRingFlushScheduled) {
+    // the kernel cannot accept more frames right now, retry when the socket becomes writable
+    m_isRingFlushScheduled = true;
+    m_socket.async_write_some(boost::asio::null_buffers(),
+                              [this, guard = weak_ptr<bool>(m_flushGuard)] (const auto& error, auto) {
+      if (!guard.expired() && error != boost::asio::error::operation_aborted) {
+        m_isRingFlushScheduled = false;
+        this->flushRing();
+      }
+    });
+  }
+}
+
 void
 EthernetTransport::asyncRead()
 {
@@ -160,31 +262,26 @@ EthernetTransport::handleRead(const boost::system::error_code& error)
     return;
   }
 
-  const uint8_t* pkt;
-  size_t len;
-  std::string err;
-  std::tie(pkt, len, err) = m_pcap.readNextPacket();
-
-  if (pkt == nullptr) {
-    NFD_LOG_FACE_WARN("Read error: " << err);
+  if (m_ring != nullptr) {
+    // process every frame that arrived since the last notification
+    m_ring->receive([this] (const uint8_t* frame, size_t length) { processFrame(frame, length); });
   }
   else {
-    const ether_header* eh;
-    std::tie(eh, err) = ethernet::checkFrameHeader(pkt, len, m_srcAddress,
-                                                   m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
-    if (eh == nullptr) {
-      NFD_LOG_FACE_WARN(err);
+    const uint8_t* pkt;
+    size_t len;
+    std::string err;
+    std::tie(pkt, len, err) = m_pcap.readNextPacket();
+
+    if (pkt == nullptr) {
+      NFD_LOG_FACE_WARN("Read error: " << err);
     }
     else {
-      ethernet::Address sender(eh->ether_shost);
-      pkt += ethernet::HDR_LEN;
-      len -= ethernet::HDR_LEN;
-      receivePayload(pkt, len, sender);
+      processFrame(pkt, len);
     }
   }
 
 #ifdef _DEBUG
-  size_t nDropped = m_pcap.getNDropped();
+  size_t nDropped = m_ring != nullptr ? m_ring->getNDropped() : m_pcap.getNDropped();
   if (nDropped - m_nDropped > 0)
     NFD_LOG_FACE_DEBUG("Detected " << nDropped - m_nDropped << " dropped frame(s)");
   m_nDropped = nDropped;
@@ -193,6 +290,22 @@ EthernetTransport::handleRead(const boost::system::error_code& error)
   asyncRead();
 }
 
+void
+EthernetTransport::processFrame(const uint8_t* frame, size_t length)
+{
+  const ether_header* eh;
+  std::string err;
+  std::tie(eh, err) = ethernet::checkFrameHeader(frame, length, m_srcAddress,
+                                                 m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
+  if (eh == nullptr) {
+    NFD_LOG_FACE_WARN(err);
+  }
+  else {
+    ethernet::Address sender(eh->ether_shost);
+    receivePayload(frame + ethernet::HDR_LEN, length - ethernet::HDR_LEN, sender);
+  }
+}
+
 void
 EthernetTransport::receivePayload(const uint8_t* payload, size_t length,
                                   const ethernet::Address& sender)
@@ -26,6 +26,7 @@
 #ifndef NFD_DAEMON_FACE_ETHERNET_TRANSPORT_HPP
 #define NFD_DAEMON_FACE_ETHERNET_TRANSPORT_HPP
 
+#include "ethernet-packet-ring.hpp"
 #include "ethernet-protocol.hpp"
 #include "pcap-helper.hpp"
 #include "transport.hpp"
@@ -61,12 +62,26 @@ public:
                  const ethernet::Address& sender);
 
 protected:
+  /**
+   * @param localEndpoint network interface
+   * @param remoteEndpoint remote or multicast Ethernet address
+   * @param ringOptions if enabled, frames are sent and received through an EthernetPacketRing
+   *                    instead of libpcap
+   */
   EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                    const ethernet::Address& remoteEndpoint);
+                    const ethernet::Address& remoteEndpoint,
+                    const EthernetPacketRing::Options& ringOptions = {});
 
   void
   doClose() final;
 
+  /**
+   * @brief Install a BPF filter on the receiving socket.
+   * @throw PcapHelper::Error or EthernetPacketRing::Error on any error
+   */
+  void
+  setPacketFilter(const char* filter);
+
   bool
   hasRecentlyReceived() const
   {
@@ -92,18 +107,38 @@ private:
   void
   sendPacket(const ndn::Block& block);
 
+  /**
+   * @brief Writes the frame into the transmit ring, and schedules a flush of the ring
+   *        unless one is already scheduled
+   */
+  void
+  sendPacketToRing(const ndn::Block& block);
+
+  /**
+   * @brief Hands the frames queued in the transmit ring to the kernel
+   */
+  void
+  flushRing();
+
   void
   asyncRead();
 
   void
   handleRead(const boost::system::error_code& error);
 
+  /**
+   * @brief Checks the Ethernet header of a received frame, and passes its payload to receivePayload
+   */
+  void
+  processFrame(const uint8_t* frame, size_t length);
+
   void
   handleError(const std::string& errorMessage);
 
 protected:
   boost::asio::posix::stream_descriptor m_socket;
   PcapHelper m_pcap;
+  unique_ptr<EthernetPacketRing> m_ring; ///< used instead of m_pcap if set
   ethernet::Address m_srcAddress;
   ethernet::Address m_destAddress;
   std::string m_interfaceName;
@@ -111,8 +146,11 @@ protected:
 private:
   signal::ScopedConnection m_netifStateConn;
   bool m_hasRecentlyReceived;
+  bool m_isRingFlushScheduled;
+  /// expires when the transport is destroyed; checked by posted ring flushes
+  shared_ptr<bool> m_flushGuard = make_shared<bool>();
 #ifdef _DEBUG
-  /// number of frames dropped by the kernel, as reported by libpcap
+  /// number of frames dropped by the kernel, as reported by libpcap or the packet ring
   size_t m_nDropped;
 #endif
 };
@@ -24,6 +24,7 @@
  */
 
 #include "face-system.hpp"
+#include "generic-link-service.hpp"
 #include "protocol-factory.hpp"
 #include "netdev-bound.hpp"
 #include "core/global-io.hpp"
@@ -48,6 +49,10 @@ FaceSystem::FaceSystem(FaceTable& faceTable, shared_ptr<ndn::net::NetworkMonitor
   }
 
   m_netdevBound = make_unique<NetdevBound>(pfCtorParams, *this);
+
+  m_afterAddFaceConn = m_faceTable.afterAdd.connect([this] (Face& face) {
+    this->applyGeneralConfig(face);
+  });
 }
 
 ProtocolFactoryCtorParams
@@ -109,12 +114,22 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
       if (key == "enable_congestion_marking") {
         context.generalConfig.wantCongestionMarking = ConfigFile::parseYesNo(pair, "face_system.general");
       }
+      else if (key == "allow_bare_net_packet") {
+        context.generalConfig.allowBareNetPacket = ConfigFile::parseYesNo(pair, "face_system.general");
+      }
       else {
         BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option face_system.general." + key));
       }
     }
   }
 
+  if (!isDryRun) {
+    m_generalConfig = context.generalConfig;
+    for (Face& face : m_faceTable) {
+      this->applyGeneralConfig(face);
+    }
+  }
+
   // process in protocol factories
   for (const auto& pair : m_factories) {
     const std::string& sectionName = pair.first;
@@ -162,5 +177,20 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
   }
 }
 
+void
+FaceSystem::applyGeneralConfig(Face& face) const
+{
+  auto service = dynamic_cast<GenericLinkService*>(face.getLinkService());
+  if (service == nullptr) {
+    return;
+  }
+
+  GenericLinkService::Options options = service->getOptions();
+  if (options.allowBareNetPacket != m_generalConfig.allowBareNetPacket) {
+    options.allowBareNetPacket = m_generalConfig.allowBareNetPacket;
+    service->setOptions(options);
+  }
+}
+
 } // namespace face
 } // namespace nfd
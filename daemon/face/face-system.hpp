@@ -89,6 +89,7 @@ public:
   struct GeneralConfig
   {
     bool wantCongestionMarking = true;
+    bool allowBareNetPacket = false;
   };
 
   /** \brief context for processing a config section in ProtocolFactory
@@ -109,6 +110,13 @@ private:
   processConfig(const ConfigSection& configSection, bool isDryRun,
                 const std::string& filename);
 
+  /** \brief apply link service options from "general" section to \p face
+   *
+   *  This covers every face in the FaceTable, including faces not created by a ProtocolFactory.
+   */
+  void
+  applyGeneralConfig(Face& face) const;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief config section name => protocol factory
    */
@@ -124,6 +132,9 @@ private:
 
   FaceTable& m_faceTable;
   shared_ptr<ndn::net::NetworkMonitor> m_netmon;
+
+  GeneralConfig m_generalConfig;
+  signal::ScopedConnection m_afterAddFaceConn;
 };
 
 } // namespace face
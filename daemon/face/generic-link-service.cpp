@@ -41,6 +41,7 @@ GenericLinkService::GenericLinkService(const GenericLinkService::Options& option
   , m_fragmenter(m_options.fragmenterOptions, this)
   , m_reassembler(m_options.reassemblerOptions, this)
   , m_reliability(m_options.reliabilityOptions, this)
+  , m_scheduler(m_options.schedulerOptions, this)
   , m_lastSeqNo(-2)
   , m_nextMarkTime(time::steady_clock::TimePoint::max())
   , m_lastMarkTime(time::steady_clock::TimePoint::min())
@@ -58,6 +59,7 @@ GenericLinkService::setOptions(const GenericLinkService::Options& options)
   m_fragmenter.setOptions(m_options.fragmenterOptions);
   m_reassembler.setOptions(m_options.reassemblerOptions);
   m_reliability.setOptions(m_options.reliabilityOptions);
+  m_scheduler.setOptions(m_options.schedulerOptions);
 }
 
 void
@@ -65,11 +67,11 @@ GenericLinkService::requestIdlePacket()
 {
   // No need to request Acks to attach to this packet from LpReliability, as they are already
   // attached in sendLpPacket
-  this->sendLpPacket({});
+  this->sendLpPacket({}, TrafficClass::CONTROL);
 }
 
 void
-GenericLinkService::sendLpPacket(lp::Packet&& pkt)
+GenericLinkService::sendLpPacket(lp::Packet&& pkt, TrafficClass trafficClass, bool isOnCch)
 {
   const ssize_t mtu = this->getTransport()->getMtu();
 
@@ -87,8 +89,8 @@ GenericLinkService::sendLpPacket(lp::Packet&& pkt)
     NFD_LOG_FACE_WARN("attempted to send packet over MTU limit");
     return;
   }
-  
-  this->sendPacket(std::move(tp));
+
+  this->transmitPacket(std::move(tp), trafficClass, isOnCch);
 }
 ////////////////////////////////
 // For interest. Jiangtao Luo. 2 April 2020
@@ -96,109 +98,146 @@ void
 GenericLinkService::sendLpPacketX(lp::Packet&& pkt)
 {
   NFD_LOG_INFO("Entering sendLpPacketX ...");
-  const ssize_t mtu = this->getTransport()->getMtu();
-
-  if (m_options.reliabilityOptions.isEnabled) {
-    m_reliability.piggyback(pkt, mtu);
-  }
-
-  if (m_options.allowCongestionMarking) {
-    checkCongestionLevel(pkt);
-  }
-
-  Transport::Packet tp(pkt.wireEncode());
-  if (mtu != MTU_UNLIMITED && tp.packet.size() > static_cast<size_t>(mtu)) {
-    ++this->nOutOverMtu;
-    NFD_LOG_FACE_WARN("attempted to send packet over MTU limit");
-    return;
-  }
-  
-  this->sendPacketX(std::move(tp));
+  this->sendLpPacket(std::move(pkt), TrafficClass::CONTROL, true);
 }
 ////////////////////////////////
 
 void
 GenericLinkService::doSendInterest(const Interest& interest)
 {
+  TrafficClass trafficClass = m_isInterestOnCch ? TrafficClass::CONTROL : TrafficClass::INTEREST;
+
+  if (this->sendNetPacketDirect(interest, interest.wireEncode(), nullptr, true, trafficClass)) {
+    return;
+  }
+
   lp::Packet lpPacket(interest.wireEncode());
 
   encodeLpFields(interest, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), true);
+  this->sendNetPacket(std::move(lpPacket), true, trafficClass);
 }
 
 void
 GenericLinkService::doSendData(const Data& data)
 {
+  TrafficClass trafficClass = data.getEmergencyInd() == "Emergency" ? TrafficClass::EMERGENCY :
+                                                                      TrafficClass::DATA;
+
+  if (this->sendNetPacketDirect(data, data.wireEncode(), nullptr, false, trafficClass)) {
+    return;
+  }
+
   lp::Packet lpPacket(data.wireEncode());
 
   encodeLpFields(data, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), false);
+  this->sendNetPacket(std::move(lpPacket), false, trafficClass);
 }
 
 void
 GenericLinkService::doSendNack(const lp::Nack& nack)
 {
+  if (this->sendNetPacketDirect(nack, nack.getInterest().wireEncode(), &nack.getHeader(), false,
+                                TrafficClass::NACK)) {
+    return;
+  }
+
   lp::Packet lpPacket(nack.getInterest().wireEncode());
   lpPacket.add<lp::NackField>(nack.getHeader());
 
   encodeLpFields(nack, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), false);
+  this->sendNetPacket(std::move(lpPacket), false, TrafficClass::NACK);
 }
 
+template<typename LpHeader>
 void
-GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket)
+GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, LpHeader& lpPacket)
 {
   if (m_options.allowLocalFields) {
     shared_ptr<lp::IncomingFaceIdTag> incomingFaceIdTag = netPkt.getTag<lp::IncomingFaceIdTag>();
     if (incomingFaceIdTag != nullptr) {
-      lpPacket.add<lp::IncomingFaceIdField>(*incomingFaceIdTag);
+      lpPacket.template add<lp::IncomingFaceIdField>(*incomingFaceIdTag);
     }
   }
 
   shared_ptr<lp::CongestionMarkTag> congestionMarkTag = netPkt.getTag<lp::CongestionMarkTag>();
   if (congestionMarkTag != nullptr) {
-    lpPacket.add<lp::CongestionMarkField>(*congestionMarkTag);
+    lpPacket.template add<lp::CongestionMarkField>(*congestionMarkTag);
   }
 
   if (m_options.allowSelfLearning) {
     shared_ptr<lp::NonDiscoveryTag> nonDiscoveryTag = netPkt.getTag<lp::NonDiscoveryTag>();
     if (nonDiscoveryTag != nullptr) {
-      lpPacket.add<lp::NonDiscoveryField>(*nonDiscoveryTag);
+      lpPacket.template add<lp::NonDiscoveryField>(*nonDiscoveryTag);
     }
 
     shared_ptr<lp::PrefixAnnouncementTag> prefixAnnouncementTag = netPkt.getTag<lp::PrefixAnnouncementTag>();
     if (prefixAnnouncementTag != nullptr) {
-      lpPacket.add<lp::PrefixAnnouncementField>(*prefixAnnouncementTag);
+      lpPacket.template add<lp::PrefixAnnouncementField>(*prefixAnnouncementTag);
     }
   }
 
   shared_ptr<lp::HopCountTag> hopCountTag = netPkt.getTag<lp::HopCountTag>();
   if (hopCountTag != nullptr) {
-    lpPacket.add<lp::HopCountTagField>(*hopCountTag);
+    lpPacket.template add<lp::HopCountTagField>(*hopCountTag);
   }
-  else {
-    lpPacket.add<lp::HopCountTagField>(0);
+  else if (!m_options.allowBareNetPacket) {
+    lpPacket.template add<lp::HopCountTagField>(0);
   }
 
   ////////////////////////////////
   // Jiangtao Luo. 31 Mar 2020
   shared_ptr<lp::CchTag> cchTag = netPkt.getTag<lp::CchTag>();
   if (cchTag != nullptr) {
-    lpPacket.add<lp::CchTagField>(*cchTag);
+    lpPacket.template add<lp::CchTagField>(*cchTag);
     //NFD_LOG_DEBUG("CchTag in generic-link-service in encodeLpFields: " << *cchTag);
   }
-  else {
+  else if (!m_options.allowBareNetPacket) {
     //NFD_LOG_DEBUG("CchTag in generic-link-service in encodeLpFields: lost!!!");
-    lpPacket.add<lp::CchTagField>(1);
+    lpPacket.template add<lp::CchTagField>(1);
   }
   ////////////////////////////////
 }
 
+bool
+GenericLinkService::sendNetPacketDirect(const ndn::PacketBase& netPkt, const Block& wire,
+                                        const lp::NackHeader* nack, bool isInterest,
+                                        TrafficClass trafficClass)
+{
+  // reliability and congestion marking operate on lp::Packet
+  if (m_options.reliabilityOptions.isEnabled || m_options.allowCongestionMarking) {
+    return false;
+  }
+
+  LpHeaderEncoder header;
+  if (nack != nullptr) {
+    header.add<lp::NackField>(*nack);
+  }
+  encodeLpFields(netPkt, header);
+
+  Transport::Packet tp{Block(wire)};
+  if (!header.empty()) {
+    tp.header = header.encode(wire.size());
+  }
+
+  const ssize_t mtu = this->getTransport()->getMtu();
+  if (mtu != MTU_UNLIMITED && tp.size() > static_cast<size_t>(mtu)) {
+    if (m_options.allowFragmentation) {
+      return false;
+    }
+    ++this->nOutOverMtu;
+    NFD_LOG_FACE_WARN("attempted to send packet over MTU limit");
+    return true;
+  }
+
+  this->transmitPacket(std::move(tp), trafficClass, isInterest && m_isInterestOnCch);
+  return true;
+}
+
 void
-GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest)
+GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest, TrafficClass trafficClass)
 {
   std::vector<lp::Packet> frags;
   ssize_t mtu = this->getTransport()->getMtu();
@@ -216,7 +255,8 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest)
 
   if (m_options.allowFragmentation && mtu != MTU_UNLIMITED) {
     bool isOk = false;
-    std::tie(isOk, frags) = m_fragmenter.fragmentPacket(pkt, mtu);
+    // sequences are embedded by the fragmenter, so fragments need not be re-encoded
+    std::tie(isOk, frags) = m_fragmenter.fragmentPacket(pkt, mtu, m_lastSeqNo + 1);
     if (!isOk) {
       // fragmentation failed (warning is logged by LpFragmenter)
       ++this->nFragmentationErrors;
@@ -241,8 +281,9 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest)
 
   // Only assign sequences to fragments if packet contains more than 1 fragment
   if (frags.size() > 1) {
-    // Assign sequences to all fragments
-    this->assignSequences(frags);
+    // LpFragmenter has assigned consecutive sequences starting from m_lastSeqNo + 1
+    BOOST_ASSERT(frags.front().get<lp::SequenceField>() == m_lastSeqNo + 1);
+    m_lastSeqNo += frags.size();
   }
 
   if (m_options.reliabilityOptions.isEnabled && frags.front().has<lp::FragmentField>()) {
@@ -257,7 +298,7 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest)
        this->sendLpPacketX(std::move(frag));
      }
      else {
-        this->sendLpPacket(std::move(frag));
+        this->sendLpPacket(std::move(frag), trafficClass);
      }
    ////////////////////////////////
      // Commented by Jiangtao Luo. replaced by above
@@ -266,15 +307,17 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest)
 }
 
 void
-GenericLinkService::assignSequence(lp::Packet& pkt)
+GenericLinkService::transmitPacket(Transport::Packet&& tp, TrafficClass trafficClass, bool isOnCch)
 {
-  pkt.set<lp::SequenceField>(++m_lastSeqNo);
-}
-
-void
-GenericLinkService::assignSequences(std::vector<lp::Packet>& pkts)
-{
-  std::for_each(pkts.begin(), pkts.end(), [this] (auto& pkt) { this->assignSequence(pkt); });
+  if (m_options.schedulerOptions.isEnabled) {
+    m_scheduler.enqueue(std::move(tp), trafficClass, isOnCch);
+  }
+  else if (isOnCch) {
+    this->sendPacketX(std::move(tp));
+  }
+  else {
+    this->sendPacket(std::move(tp));
+  }
 }
 
 void
@@ -27,7 +27,9 @@
 #define NFD_DAEMON_FACE_GENERIC_LINK_SERVICE_HPP
 
 #include "link-service.hpp"
+#include "lp-egress-scheduler.hpp"
 #include "lp-fragmenter.hpp"
+#include "lp-header-encoder.hpp"
 #include "lp-reassembler.hpp"
 #include "lp-reliability.hpp"
 
@@ -128,6 +130,10 @@ public:
      */
     LpReliability::Options reliabilityOptions;
 
+    /** \brief options for the egress scheduler
+     */
+    LpEgressScheduler::Options schedulerOptions;
+
     /** \brief enables send queue congestion detection and marking
      */
     bool allowCongestionMarking = false;
@@ -147,6 +153,17 @@ public:
     /** \brief enables self-learning forwarding support
      */
     bool allowSelfLearning = true;
+
+    /** \brief enables sending a network-layer packet without LpPacket wrapping
+     *         when it needs no link protocol field
+     *
+     *  If false, HopCountTag and CchTag fields are encoded on every packet, with default values
+     *  0 and 1 when the packet does not carry the tag. If true, these fields are encoded only
+     *  when the packet carries the tag.
+     *
+     *  This is set by the face_system.general.allow_bare_net_packet config option.
+     */
+    bool allowBareNetPacket = false;
   };
 
   /** \brief counters provided by GenericLinkService
@@ -169,6 +186,14 @@ public:
   const Counters&
   getCounters() const override;
 
+  /** \brief get the egress scheduler, which provides per-class queue lengths and counters
+   */
+  const LpEgressScheduler&
+  getEgressScheduler() const;
+
+private:
+  using TrafficClass = LpEgressScheduler::TrafficClass;
+
 PROTECTED_WITH_TESTS_ELSE_PRIVATE: // send path
   /** \brief request an IDLE packet to transmit pending service fields
    */
@@ -177,9 +202,12 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE: // send path
 
   /** \brief send an LpPacket fragment
    *  \param pkt LpPacket to send
+   *  \param trafficClass traffic class used by the egress scheduler
+   *  \param isOnCch whether the packet is sent on the control channel
    */
   void
-  sendLpPacket(lp::Packet&& pkt);
+  sendLpPacket(lp::Packet&& pkt, TrafficClass trafficClass = TrafficClass::DATA,
+               bool isOnCch = false);
 
   /** \brief send Interest
    */
@@ -198,28 +226,45 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE: // send path
 
 private: // send path
   /** \brief encode link protocol fields from tags onto an outgoing LpPacket
+   *  \tparam LpHeader lp::Packet or LpHeaderEncoder
    *  \param netPkt network-layer packet to extract tags from
    *  \param lpPacket LpPacket to add link protocol fields to
    */
+  template<typename LpHeader>
   void
-  encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket);
+  encodeLpFields(const ndn::PacketBase& netPkt, LpHeader& lpPacket);
+
+  /** \brief send a network-layer packet that needs neither fragmentation nor sequence numbers
+   *
+   *  The LpPacket header is encoded by LpHeaderEncoder and passed to the transport in
+   *  Transport::Packet::header, so that the network-layer packet is not copied.
+   *  If no header field is needed, the packet is sent without LpPacket wrapping.
+   *
+   *  \param netPkt network-layer packet to extract tags from
+   *  \param wire wire encoding of \p netPkt
+   *  \param nack Nack header, or nullptr if \p netPkt is not a Nack
+   *  \param isInterest whether the network-layer packet is an Interest
+   *  \param trafficClass traffic class used by the egress scheduler
+   *  \return false if the packet must go through sendNetPacket instead;
+   *          true if the packet has been sent or dropped
+   */
+  bool
+  sendNetPacketDirect(const ndn::PacketBase& netPkt, const Block& wire,
+                      const lp::NackHeader* nack, bool isInterest, TrafficClass trafficClass);
 
   /** \brief send a complete network layer packet
    *  \param pkt LpPacket containing a complete network layer packet
    *  \param isInterest whether the network layer packet is an Interest
+   *  \param trafficClass traffic class used by the egress scheduler
    */
   void
-  sendNetPacket(lp::Packet&& pkt, bool isInterest);
-
-  /** \brief assign a sequence number to an LpPacket
-   */
-  void
-  assignSequence(lp::Packet& pkt);
+  sendNetPacket(lp::Packet&& pkt, bool isInterest, TrafficClass trafficClass);
 
-  /** \brief assign consecutive sequence numbers to LpPackets
+  /** \brief pass a link-layer packet to the egress scheduler, or to the transport
+   *         if the scheduler is disabled
    */
   void
-  assignSequences(std::vector<lp::Packet>& pkts);
+  transmitPacket(Transport::Packet&& tp, TrafficClass trafficClass, bool isOnCch);
 
   /** \brief if the send queue is found to be congested, add a congestion mark to the packet
    *         according to CoDel
@@ -293,6 +338,7 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   LpFragmenter m_fragmenter;
   LpReassembler m_reassembler;
   LpReliability m_reliability;
+  LpEgressScheduler m_scheduler;
   lp::Sequence m_lastSeqNo;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
@@ -307,6 +353,7 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   size_t m_nMarkedSinceInMarkingState;
 
   friend class LpReliability;
+  friend class LpEgressScheduler;
 };
 
 inline const GenericLinkService::Options&
@@ -321,6 +368,12 @@ GenericLinkService::getCounters() const
   return *this;
 }
 
+inline const LpEgressScheduler&
+GenericLinkService::getEgressScheduler() const
+{
+  return m_scheduler;
+}
+
 } // namespace face
 } // namespace nfd
 
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FACE_LINK_SERVICE_HPP
 
 #include "core/counter.hpp"
+#include "core/execution-context.hpp"
 #include "face-log.hpp"
 #include "transport.hpp"
 
@@ -111,6 +112,19 @@ public:
   virtual const Counters&
   getCounters() const;
 
+  /** \return execution context for timers of this LinkService
+   */
+  ExecutionContext&
+  getExecutionContext() const;
+
+  /** \brief set execution context for timers of this LinkService
+   *
+   *  Forwarder sets its own context when the face is added to its FaceTable.
+   *  Until then, the thread-wide context is used.
+   */
+  void
+  setExecutionContext(ExecutionContext& context);
+
 public: // upper interface to be used by forwarding
   /** \brief send Interest
    *  \pre setTransport has been called
@@ -219,6 +233,7 @@ private: // lower interface to be overridden in subclass
 private:
   Face* m_face;
   Transport* m_transport;
+  ExecutionContext* m_context;
 
 ////////////////////////////////
 // Jiangtao Luo. 2 April 2020
@@ -283,6 +298,18 @@ LinkService::getCounters() const
   return *this;
 }
 
+inline ExecutionContext&
+LinkService::getExecutionContext() const
+{
+  return *m_context;
+}
+
+inline void
+LinkService::setExecutionContext(ExecutionContext& context)
+{
+  m_context = &context;
+}
+
 inline void
 LinkService::receivePacket(Transport::Packet&& packet)
 {
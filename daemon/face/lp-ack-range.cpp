@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "lp-ack-range.hpp"
+
+namespace nfd {
+namespace face {
+
+static_assert((LpAckRange::TLV_TYPE & 0x03) == 0, "AckRange TLV-TYPE must be ignorable");
+static_assert(LpAckRange::MAX_BITMAP_SIZE <= 0xFF, "bitmap length must fit in 1 octet");
+
+constexpr uint64_t LpAckRange::TLV_TYPE;
+constexpr size_t LpAckRange::MAX_BITMAP_SIZE;
+constexpr size_t LpAckRange::RANGE_BASE_SIZE;
+
+LpAckRange::LpAckRange(lp::Sequence base)
+{
+  this->addRange(base);
+}
+
+LpAckRange::LpAckRange(const Block& wire)
+{
+  this->wireDecode(wire);
+}
+
+void
+LpAckRange::addRange(lp::Sequence base)
+{
+  m_ranges.push_back({base, {}});
+}
+
+bool
+LpAckRange::add(lp::Sequence seq, size_t maxBitmapSize)
+{
+  BOOST_ASSERT(!m_ranges.empty());
+  Range& range = m_ranges.back();
+
+  lp::Sequence offset = seq - range.base;
+  if (offset == 0) {
+    return true;
+  }
+
+  lp::Sequence bit = offset - 1;
+  if (bit >= std::min(maxBitmapSize, MAX_BITMAP_SIZE) * 8) {
+    return false;
+  }
+
+  size_t octet = static_cast<size_t>(bit / 8);
+  if (octet >= range.bitmap.size()) {
+    range.bitmap.resize(octet + 1);
+  }
+  range.bitmap[octet] |= static_cast<uint8_t>(0x80 >> (bit % 8));
+  return true;
+}
+
+std::vector<lp::Sequence>
+LpAckRange::getSequences() const
+{
+  std::vector<lp::Sequence> seqs;
+  for (const Range& range : m_ranges) {
+    seqs.push_back(range.base);
+    for (size_t octet = 0; octet < range.bitmap.size(); ++octet) {
+      for (size_t i = 0; i < 8; ++i) {
+        if (range.bitmap[octet] & (0x80 >> i)) {
+          seqs.push_back(range.base + 1 + octet * 8 + i);
+        }
+      }
+    }
+  }
+  return seqs;
+}
+
+size_t
+LpAckRange::getValueSize() const
+{
+  size_t valueSize = 0;
+  for (const Range& range : m_ranges) {
+    valueSize += RANGE_BASE_SIZE + range.bitmap.size();
+  }
+  return valueSize;
+}
+
+size_t
+LpAckRange::getEncodedSize() const
+{
+  size_t valueSize = this->getValueSize();
+  return tlv::sizeOfVarNumber(TLV_TYPE) + tlv::sizeOfVarNumber(valueSize) + valueSize;
+}
+
+void
+LpAckRange::wireDecode(const Block& wire)
+{
+  if (wire.type() != TLV_TYPE) {
+    BOOST_THROW_EXCEPTION(Error("expecting AckRange block"));
+  }
+
+  m_ranges.clear();
+
+  const uint8_t* value = wire.value();
+  size_t remaining = wire.value_size();
+  while (remaining > 0) {
+    if (remaining < RANGE_BASE_SIZE) {
+      BOOST_THROW_EXCEPTION(Error("AckRange is truncated"));
+    }
+
+    lp::Sequence base = 0;
+    for (size_t i = 0; i < sizeof(lp::Sequence); ++i) {
+      base = (base << 8) | value[i];
+    }
+    size_t bitmapSize = value[sizeof(lp::Sequence)];
+    value += RANGE_BASE_SIZE;
+    remaining -= RANGE_BASE_SIZE;
+
+    if (remaining < bitmapSize) {
+      BOOST_THROW_EXCEPTION(Error("AckRange bitmap is truncated"));
+    }
+    m_ranges.push_back({base, std::vector<uint8_t>(value, value + bitmapSize)});
+    value += bitmapSize;
+    remaining -= bitmapSize;
+  }
+}
+
+} // namespace face
+} // namespace nfd
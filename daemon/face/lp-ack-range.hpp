@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_LP_ACK_RANGE_HPP
+#define NFD_DAEMON_FACE_LP_ACK_RANGE_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/lp/field-decl.hpp>
+#include <ndn-cxx/lp/sequence.hpp>
+
+namespace nfd {
+namespace face {
+
+/** \brief represents an AckRange header field, which acknowledges a set of TxSequence numbers
+ *
+ *  AckRange is an NFD extension to NDNLPv2. Its TLV-TYPE is in the ignorable range, so that
+ *  a peer that does not recognize it silently drops the field. Such a peer also treats the field
+ *  as non-repeatable, so an LpPacket carries at most one AckRange, which holds all ranges.
+ *
+ *  TLV-VALUE is either empty, or a list of ranges. Each range is an 8-octet base TxSequence,
+ *  a 1-octet bitmap length, and the bitmap. The base is always acknowledged; bit i of the bitmap,
+ *  counting from the most significant bit of the first octet, acknowledges base + 1 + i.
+ *  An empty AckRange acknowledges nothing and only advertises that the sender understands AckRange.
+ */
+class LpAckRange
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  /** \brief construct an empty AckRange, which advertises support for AckRange
+   */
+  LpAckRange() = default;
+
+  /** \brief construct an AckRange with one range that acknowledges \p base
+   */
+  explicit
+  LpAckRange(lp::Sequence base);
+
+  explicit
+  LpAckRange(const Block& wire);
+
+  /** \return whether this AckRange acknowledges nothing
+   */
+  bool
+  empty() const
+  {
+    return m_ranges.empty();
+  }
+
+  /** \return number of ranges
+   */
+  size_t
+  getNRanges() const
+  {
+    return m_ranges.size();
+  }
+
+  /** \brief start a new range that acknowledges \p base
+   */
+  void
+  addRange(lp::Sequence base);
+
+  /** \brief acknowledge \p seq in the last range
+   *  \pre !empty()
+   *  \param maxBitmapSize maximum size of the bitmap of the last range after the addition
+   *  \return whether \p seq can be represented; if false, this AckRange is unchanged
+   */
+  bool
+  add(lp::Sequence seq, size_t maxBitmapSize = MAX_BITMAP_SIZE);
+
+  /** \return acknowledged TxSequence numbers, range by range, each in increasing order
+   *          starting from its base
+   */
+  std::vector<lp::Sequence>
+  getSequences() const;
+
+  /** \return size of TLV-VALUE
+   */
+  size_t
+  getValueSize() const;
+
+  /** \return size of TLV encoding
+   */
+  size_t
+  getEncodedSize() const;
+
+  template<ndn::encoding::Tag TAG>
+  size_t
+  wireEncode(ndn::EncodingImpl<TAG>& encoder) const;
+
+  void
+  wireDecode(const Block& wire);
+
+public:
+  /// TLV-TYPE of AckRange: ignorable, in the range reserved for NDNLPv2 header fields
+  static constexpr uint64_t TLV_TYPE = 956;
+
+  /// largest bitmap of one range, which keeps the bitmap length in one octet
+  static constexpr size_t MAX_BITMAP_SIZE = 32;
+
+  /// size of one range with an empty bitmap: base and bitmap length
+  static constexpr size_t RANGE_BASE_SIZE = sizeof(lp::Sequence) + 1;
+
+private:
+  struct Range
+  {
+    lp::Sequence base;
+    std::vector<uint8_t> bitmap;
+  };
+  std::vector<Range> m_ranges;
+};
+
+template<ndn::encoding::Tag TAG>
+size_t
+LpAckRange::wireEncode(ndn::EncodingImpl<TAG>& encoder) const
+{
+  size_t length = 0;
+  for (auto range = m_ranges.rbegin(); range != m_ranges.rend(); ++range) {
+    length += encoder.prependByteArray(range->bitmap.data(), range->bitmap.size());
+    length += encoder.prependByte(static_cast<uint8_t>(range->bitmap.size()));
+
+    uint8_t base[sizeof(lp::Sequence)];
+    for (size_t i = 0; i < sizeof(base); ++i) {
+      base[sizeof(base) - 1 - i] = static_cast<uint8_t>(range->base >> (8 * i));
+    }
+    length += encoder.prependByteArray(base, sizeof(base));
+  }
+  length += encoder.prependVarNumber(length);
+  length += encoder.prependVarNumber(TLV_TYPE);
+  return length;
+}
+
+using AckRangeField = lp::FieldDecl<lp::field_location_tags::Header, LpAckRange,
+                                    LpAckRange::TLV_TYPE, false>;
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_LP_ACK_RANGE_HPP
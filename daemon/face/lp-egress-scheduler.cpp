@@ -0,0 +1,233 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "lp-egress-scheduler.hpp"
+#include "generic-link-service.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace nfd {
+namespace face {
+
+NFD_LOG_INIT(LpEgressScheduler);
+
+constexpr size_t LpEgressScheduler::N_CLASSES;
+constexpr size_t LpEgressScheduler::N_STRICT_CLASSES;
+
+LpEgressScheduler::LpEgressScheduler(const Options& options, GenericLinkService* linkService)
+  : m_options(options)
+  , m_linkService(linkService)
+  , m_deficits{}
+  , m_drrIndex(N_STRICT_CLASSES)
+  , m_tokens(m_options.maxBurstSize)
+  , m_lastRefill(time::steady_clock::now())
+  , m_isDrainTimerRunning(false)
+{
+  BOOST_ASSERT(m_linkService != nullptr);
+}
+
+void
+LpEgressScheduler::setOptions(const Options& options)
+{
+  m_options = options;
+  m_tokens = std::min(m_tokens, static_cast<double>(m_options.maxBurstSize));
+
+  if (!m_options.isEnabled) {
+    m_drainTimer.cancel();
+    m_isDrainTimerRunning = false;
+    for (size_t i = 0; i < N_CLASSES; ++i) {
+      while (!m_queues[i].empty()) {
+        transmit(i);
+      }
+    }
+  }
+}
+
+const GenericLinkService*
+LpEgressScheduler::getLinkService() const
+{
+  return m_linkService;
+}
+
+void
+LpEgressScheduler::enqueue(Transport::Packet&& packet, TrafficClass trafficClass, bool isOnCch)
+{
+  auto i = static_cast<size_t>(trafficClass);
+  BOOST_ASSERT(i < N_CLASSES);
+
+  if (m_queues[i].size() >= m_options.queueCapacity[i]) {
+    ++m_counters[i].nDropped;
+    NFD_LOG_FACE_DEBUG("queue of class " << trafficClass << " is full: DROP");
+    return;
+  }
+
+  m_queues[i].push_back({std::move(packet), isOnCch});
+  if (!m_isDrainTimerRunning) {
+    drain();
+  }
+}
+
+size_t
+LpEgressScheduler::getQueueLength(TrafficClass trafficClass) const
+{
+  return m_queues.at(static_cast<size_t>(trafficClass)).size();
+}
+
+const LpEgressScheduler::ClassCounters&
+LpEgressScheduler::getCounters(TrafficClass trafficClass) const
+{
+  return m_counters.at(static_cast<size_t>(trafficClass));
+}
+
+void
+LpEgressScheduler::drain()
+{
+  m_isDrainTimerRunning = false;
+
+  for (size_t i = selectClass(); i < N_CLASSES; i = selectClass()) {
+    size_t packetSize = m_queues[i].front().packet.size();
+    time::nanoseconds delay = getTransmitDelay(packetSize);
+    if (delay > 0_ns) {
+      NFD_LOG_FACE_TRACE("link saturated, next attempt in " << delay);
+      m_drainTimer = m_linkService->getExecutionContext().schedule(delay, [this] { drain(); });
+      m_isDrainTimerRunning = true;
+      return;
+    }
+
+    if (i >= N_STRICT_CLASSES) {
+      m_deficits[i] -= packetSize;
+    }
+    if (m_options.egressRate > 0) {
+      m_tokens -= packetSize;
+    }
+    transmit(i);
+  }
+}
+
+size_t
+LpEgressScheduler::selectClass()
+{
+  for (size_t i = 0; i < N_STRICT_CLASSES; ++i) {
+    if (!m_queues[i].empty()) {
+      return i;
+    }
+  }
+
+  bool hasBacklog = std::any_of(m_queues.begin() + N_STRICT_CLASSES, m_queues.end(),
+                                [] (const auto& queue) { return !queue.empty(); });
+  if (!hasBacklog) {
+    return N_CLASSES;
+  }
+
+  // deficit round robin: serve the current class while its head packet fits in its deficit,
+  // otherwise grant it another quantum and move on to the next class
+  while (true) {
+    const auto& queue = m_queues[m_drrIndex];
+    if (queue.empty()) {
+      m_deficits[m_drrIndex] = 0;
+    }
+    else if (queue.front().packet.size() <= m_deficits[m_drrIndex]) {
+      return m_drrIndex;
+    }
+    else {
+      m_deficits[m_drrIndex] += std::max<size_t>(m_options.quantum, 1) *
+                                std::max<uint32_t>(m_options.weights[m_drrIndex], 1);
+    }
+
+    if (++m_drrIndex == N_CLASSES) {
+      m_drrIndex = N_STRICT_CLASSES;
+    }
+  }
+}
+
+time::nanoseconds
+LpEgressScheduler::getTransmitDelay(size_t packetSize)
+{
+  ssize_t backlog = m_linkService->getTransport()->getSendQueueLength();
+  if (backlog > 0 && static_cast<size_t>(backlog) > m_options.maxTransportBacklog) {
+    return m_options.pollInterval;
+  }
+
+  if (m_options.egressRate == 0) {
+    return 0_ns;
+  }
+
+  auto now = time::steady_clock::now();
+  double elapsed = time::duration_cast<time::duration<double>>(now - m_lastRefill).count();
+  m_tokens = std::min(m_tokens + elapsed * m_options.egressRate,
+                      static_cast<double>(m_options.maxBurstSize));
+  m_lastRefill = now;
+
+  if (m_tokens >= 0) {
+    return 0_ns;
+  }
+  // wait until the deficit of the bucket is paid back
+  return time::nanoseconds(static_cast<time::nanoseconds::rep>(
+                             std::ceil(-m_tokens * 1e9 / m_options.egressRate)));
+}
+
+void
+LpEgressScheduler::transmit(size_t classIndex)
+{
+  Item item = std::move(m_queues[classIndex].front());
+  m_queues[classIndex].pop_front();
+  ++m_counters[classIndex].nSent;
+
+  if (item.isOnCch) {
+    m_linkService->sendPacketX(std::move(item.packet));
+  }
+  else {
+    m_linkService->sendPacket(std::move(item.packet));
+  }
+}
+
+std::ostream&
+operator<<(std::ostream& os, LpEgressScheduler::TrafficClass trafficClass)
+{
+  switch (trafficClass) {
+    case LpEgressScheduler::TrafficClass::EMERGENCY:
+      return os << "emergency";
+    case LpEgressScheduler::TrafficClass::CONTROL:
+      return os << "control";
+    case LpEgressScheduler::TrafficClass::NACK:
+      return os << "nack";
+    case LpEgressScheduler::TrafficClass::INTEREST:
+      return os << "interest";
+    case LpEgressScheduler::TrafficClass::DATA:
+      return os << "data";
+  }
+  return os << static_cast<unsigned>(trafficClass);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const FaceLogHelper<LpEgressScheduler>& flh)
+{
+  os << FaceLogHelper<LinkService>(*flh.obj.getLinkService());
+  return os;
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,210 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_LP_EGRESS_SCHEDULER_HPP
+#define NFD_DAEMON_FACE_LP_EGRESS_SCHEDULER_HPP
+
+#include "face-log.hpp"
+#include "transport.hpp"
+#include "core/counter.hpp"
+#include "core/scheduler.hpp"
+
+#include <array>
+#include <deque>
+
+namespace nfd {
+namespace face {
+
+class GenericLinkService;
+
+/** \brief per-face egress scheduler with strict-priority and weighted traffic classes
+ *
+ *  Outgoing link-layer packets are placed in a bounded FIFO queue per traffic class.
+ *  Strict-priority classes are always served first, in their order of declaration.
+ *  The remaining classes share the link by deficit round robin, in proportion to their weights.
+ *
+ *  Packets are held in the scheduler while the transport's send queue is longer than
+ *  Options::maxTransportBacklog, or while Options::egressRate would be exceeded, so that
+ *  the order of transmission is decided here rather than in a FIFO further down.
+ *  When the link is not saturated, packets pass through without delay.
+ */
+class LpEgressScheduler : noncopyable
+{
+public:
+  /** \brief traffic classes, in decreasing order of priority
+   */
+  enum class TrafficClass : uint8_t {
+    EMERGENCY, ///< Data carrying the emergency indication (strict priority)
+    CONTROL,   ///< Interests on the control channel and IDLE packets (strict priority)
+    NACK,      ///< Nacks (weighted)
+    INTEREST,  ///< other Interests (weighted)
+    DATA,      ///< other Data (weighted)
+  };
+
+  static constexpr size_t N_CLASSES = 5;
+  static constexpr size_t N_STRICT_CLASSES = 2;
+
+  struct Options
+  {
+    /** \brief enables the egress scheduler
+     *
+     *  If false, packets are passed to the transport in the order they are sent.
+     */
+    bool isEnabled = false;
+
+    /** \brief maximum number of packets queued in each traffic class
+     */
+    std::array<size_t, N_CLASSES> queueCapacity = {{64, 256, 256, 1024, 1024}};
+
+    /** \brief relative weights of the weighted traffic classes
+     *
+     *  Entries of strict-priority classes are ignored. A weight of zero is treated as one.
+     */
+    std::array<uint32_t, N_CLASSES> weights = {{0, 0, 1, 1, 1}};
+
+    /** \brief number of octets a weighted class may send per unit of weight in each round
+     */
+    size_t quantum = 1500;
+
+    /** \brief transport send queue length in octets above which packets are held
+     *
+     *  This has no effect if the transport cannot report its send queue length.
+     */
+    size_t maxTransportBacklog = 65536;
+
+    /** \brief interval between checks of a backlogged transport send queue
+     */
+    time::nanoseconds pollInterval = 1_ms;
+
+    /** \brief maximum egress rate in octets per second; zero means unlimited
+     */
+    uint64_t egressRate = 0;
+
+    /** \brief maximum number of octets that may be sent at once after an idle period,
+     *         when egressRate is set
+     */
+    size_t maxBurstSize = ndn::MAX_NDN_PACKET_SIZE;
+  };
+
+  /** \brief counters of a traffic class
+   */
+  struct ClassCounters
+  {
+    /** \brief count of packets passed to the transport
+     */
+    PacketCounter nSent;
+
+    /** \brief count of packets dropped because the queue was full
+     */
+    PacketCounter nDropped;
+  };
+
+  LpEgressScheduler(const Options& options, GenericLinkService* linkService);
+
+  /** \brief set options for the scheduler
+   *
+   *  If the scheduler is disabled, queued packets are sent immediately.
+   */
+  void
+  setOptions(const Options& options);
+
+  /** \return LinkService that owns this instance
+   */
+  const GenericLinkService*
+  getLinkService() const;
+
+  /** \brief queue a link-layer packet for transmission, sending it right away if possible
+   *  \param packet link-layer packet
+   *  \param trafficClass traffic class of the packet
+   *  \param isOnCch whether the packet is sent with LinkService::sendPacketX
+   */
+  void
+  enqueue(Transport::Packet&& packet, TrafficClass trafficClass, bool isOnCch = false);
+
+  /** \return number of packets queued in \p trafficClass
+   */
+  size_t
+  getQueueLength(TrafficClass trafficClass) const;
+
+  const ClassCounters&
+  getCounters(TrafficClass trafficClass) const;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief send queued packets until the queues are empty or the link is saturated
+   *
+   *  If packets remain, a timer is started to call this function again.
+   */
+  void
+  drain();
+
+private:
+  /** \return index of the class to serve next, or N_CLASSES if all queues are empty
+   */
+  size_t
+  selectClass();
+
+  /** \return how long to wait before a packet of \p packetSize octets may be sent
+   */
+  time::nanoseconds
+  getTransmitDelay(size_t packetSize);
+
+  void
+  transmit(size_t classIndex);
+
+private:
+  struct Item
+  {
+    Transport::Packet packet;
+    bool isOnCch;
+  };
+
+  Options m_options;
+  GenericLinkService* m_linkService;
+  std::array<std::deque<Item>, N_CLASSES> m_queues;
+  std::array<ClassCounters, N_CLASSES> m_counters;
+
+  /// deficit counters of deficit round robin, in octets
+  std::array<size_t, N_CLASSES> m_deficits;
+  /// weighted class currently visited by deficit round robin
+  size_t m_drrIndex;
+
+  /// token bucket of egressRate, in octets
+  double m_tokens;
+  time::steady_clock::TimePoint m_lastRefill;
+
+  scheduler::ScopedEventId m_drainTimer;
+  bool m_isDrainTimerRunning;
+};
+
+std::ostream&
+operator<<(std::ostream& os, LpEgressScheduler::TrafficClass trafficClass);
+
+std::ostream&
+operator<<(std::ostream& os, const FaceLogHelper<LpEgressScheduler>& flh);
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_LP_EGRESS_SCHEDULER_HPP
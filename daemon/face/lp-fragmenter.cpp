@@ -26,6 +26,7 @@
 #include "lp-fragmenter.hpp"
 #include "link-service.hpp"
 
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
 #include <ndn-cxx/encoding/tlv.hpp>
 
 namespace nfd {
@@ -75,8 +76,38 @@ LpFragmenter::getLinkService() const
   return m_linkService;
 }
 
+/** \brief encodes one fragment in a single pass
+ *  \param payloadBegin,payloadEnd slice of the network-layer packet carried by this fragment
+ *  \param headers other NDNLPv2 headers to place on this fragment, in TLV-TYPE order;
+ *                 they must all have a TLV-TYPE greater than FragCount
+ *
+ *  The payload is copied once, directly from the network-layer packet into the wire
+ *  of the fragment; headers are then prepended in front of it.
+ */
+static lp::Packet
+encodeFragment(ndn::Buffer::const_iterator payloadBegin, ndn::Buffer::const_iterator payloadEnd,
+               const std::vector<Block>& headers, size_t headerSize,
+               size_t fragIndex, size_t fragCount, optional<lp::Sequence> sequence)
+{
+  ndn::EncodingBuffer encoder(MAX_FRAG_OVERHEAD + headerSize + std::distance(payloadBegin, payloadEnd), 0);
+
+  size_t length = lp::FragmentField::encode(encoder, std::make_pair(payloadBegin, payloadEnd));
+  for (auto it = headers.rbegin(); it != headers.rend(); ++it) {
+    length += encoder.prependByteArray(it->wire(), it->size());
+  }
+  length += lp::FragCountField::encode(encoder, fragCount);
+  length += lp::FragIndexField::encode(encoder, fragIndex);
+  if (sequence) {
+    length += lp::SequenceField::encode(encoder, *sequence);
+  }
+  encoder.prependVarNumber(length);
+  encoder.prependVarNumber(lp::tlv::LpPacket);
+
+  return lp::Packet(encoder.block());
+}
+
 std::tuple<bool, std::vector<lp::Packet>>
-LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
+LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu, optional<lp::Sequence> firstSequence)
 {
   BOOST_ASSERT(packet.has<lp::FragmentField>());
   BOOST_ASSERT(!packet.has<lp::FragIndexField>());
@@ -93,12 +124,15 @@ LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
   std::tie(netPktBegin, netPktEnd) = packet.get<lp::FragmentField>();
   size_t netPktSize = std::distance(netPktBegin, netPktEnd);
 
-  // compute size of other NDNLPv2 headers to be placed on the first fragment
+  // collect other NDNLPv2 headers to be placed on the first fragment
+  std::vector<Block> firstHeaders;
   size_t firstHeaderSize = 0;
   const Block& packetWire = packet.wireEncode();
   if (packetWire.type() == lp::tlv::LpPacket) {
     for (const Block& element : packetWire.elements()) {
       if (element.type() != lp::tlv::Fragment) {
+        BOOST_ASSERT(element.type() > lp::tlv::FragCount);
+        firstHeaders.push_back(element);
         firstHeaderSize += element.size();
       }
     }
@@ -121,25 +155,35 @@ LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
   }
 
   // populate fragments
-  std::vector<lp::Packet> frags(fragCount);
-  frags.front() = packet; // copy input packet to preserve other NDNLPv2 fields
-  size_t fragIndex = 0;
+  // Each fragment refers to a slice of the network-layer packet and is encoded in one pass,
+  // so that payload octets are copied only once, into the wire of the fragment.
+  static const std::vector<Block> noHeaders;
+  std::vector<lp::Packet> frags;
+  frags.reserve(fragCount);
   auto fragBegin = netPktBegin,
        fragEnd = fragBegin + firstPayloadSize;
   while (fragBegin < netPktEnd) {
-    lp::Packet& frag = frags[fragIndex];
-    frag.add<lp::FragIndexField>(fragIndex);
-    frag.add<lp::FragCountField>(fragCount);
-    frag.set<lp::FragmentField>({fragBegin, fragEnd});
-    BOOST_ASSERT(frag.wireEncode().size() <= mtu);
+    size_t fragIndex = frags.size();
+    optional<lp::Sequence> sequence;
+    if (firstSequence) {
+      sequence = *firstSequence + fragIndex;
+    }
+    if (fragIndex == 0) {
+      frags.push_back(encodeFragment(fragBegin, fragEnd, firstHeaders, firstHeaderSize,
+                                     fragIndex, fragCount, sequence));
+    }
+    else {
+      frags.push_back(encodeFragment(fragBegin, fragEnd, noHeaders, 0,
+                                     fragIndex, fragCount, sequence));
+    }
+    BOOST_ASSERT(frags.back().wireEncode().size() <= mtu);
 
-    ++fragIndex;
     fragBegin = fragEnd;
     fragEnd = std::min(netPktEnd, fragBegin + payloadSize);
   }
-  BOOST_ASSERT(fragIndex == fragCount);
+  BOOST_ASSERT(frags.size() == fragCount);
 
-  return std::make_tuple(true, frags);
+  return std::make_tuple(true, std::move(frags));
 }
 
 std::ostream&
@@ -70,10 +70,17 @@ public:
    *  \param packet an LpPacket that contains a network-layer packet;
    *                must have Fragment field, must not have FragIndex and FragCount fields
    *  \param mtu maximum allowable LpPacket size after fragmentation and sequence number assignment
-   *  \return whether fragmentation succeeded, fragmented packets without sequence number
+   *  \param firstSequence if set, and the packet is fragmented, fragments are given consecutive
+   *                       sequence numbers starting from this value
+   *  \return whether fragmentation succeeded, fragmented packets
+   *
+   *  Each fragment is encoded directly from a slice of the network-layer packet, so that
+   *  payload octets are copied exactly once and no fragment is re-encoded afterwards.
+   *  A packet that fits in \p mtu is returned as is, without sequence number.
    */
   std::tuple<bool, std::vector<lp::Packet>>
-  fragmentPacket(const lp::Packet& packet, size_t mtu);
+  fragmentPacket(const lp::Packet& packet, size_t mtu,
+                 optional<lp::Sequence> firstSequence = nullopt);
 
 private:
   Options m_options;
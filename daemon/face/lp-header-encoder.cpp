@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "lp-header-encoder.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace nfd {
+namespace face {
+
+constexpr size_t LpHeaderEncoder::HEADROOM;
+
+LpHeaderEncoder::LpHeaderEncoder()
+  : m_fields(0)
+  , m_nack(nullptr)
+  , m_incomingFaceId(0)
+  , m_congestionMark(0)
+  , m_hopCount(0)
+  , m_cchTag(0)
+{
+}
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::NackField>(const lp::NackHeader& value)
+{
+  m_nack = &value;
+  this->set(FIELD_NACK);
+  return *this;
+}
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::IncomingFaceIdField>(const uint64_t& value)
+{
+  m_incomingFaceId = value;
+  this->set(FIELD_INCOMING_FACE_ID);
+  return *this;
+}
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::CongestionMarkField>(const uint64_t& value)
+{
+  m_congestionMark = value;
+  this->set(FIELD_CONGESTION_MARK);
+  return *this;
+}
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::NonDiscoveryField>(const lp::EmptyValue&)
+{
+  this->set(FIELD_NON_DISCOVERY);
+  return *this;
+}
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::PrefixAnnouncementField>(const lp::PrefixAnnouncementHeader& value)
+{
+  m_prefixAnnouncement = value;
+  this->set(FIELD_PREFIX_ANNOUNCEMENT);
+  return *this;
+}
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::HopCountTagField>(const uint64_t& value)
+{
+  m_hopCount = value;
+  this->set(FIELD_HOP_COUNT);
+  return *this;
+}
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::CchTagField>(const uint64_t& value)
+{
+  m_cchTag = value;
+  this->set(FIELD_CCH_TAG);
+  return *this;
+}
+
+ndn::ConstBufferPtr
+LpHeaderEncoder::encode(size_t fragmentSize) const
+{
+  // Header fields must appear in increasing TLV-TYPE order, so they are prepended in decreasing
+  // order. The order is derived from the field declarations, so that fields whose TLV-TYPE is
+  // assigned outside this file (such as CchTag) are placed correctly.
+  static const std::array<FieldKind, FIELD_MAX> prependOrder = [] {
+    std::array<uint64_t, FIELD_MAX> tlvTypes;
+    tlvTypes[FIELD_NACK] = lp::NackField::TlvType::value;
+    tlvTypes[FIELD_INCOMING_FACE_ID] = lp::IncomingFaceIdField::TlvType::value;
+    tlvTypes[FIELD_CONGESTION_MARK] = lp::CongestionMarkField::TlvType::value;
+    tlvTypes[FIELD_NON_DISCOVERY] = lp::NonDiscoveryField::TlvType::value;
+    tlvTypes[FIELD_PREFIX_ANNOUNCEMENT] = lp::PrefixAnnouncementField::TlvType::value;
+    tlvTypes[FIELD_HOP_COUNT] = lp::HopCountTagField::TlvType::value;
+    tlvTypes[FIELD_CCH_TAG] = lp::CchTagField::TlvType::value;
+
+    std::array<FieldKind, FIELD_MAX> order;
+    for (int i = 0; i < FIELD_MAX; ++i) {
+      order[i] = static_cast<FieldKind>(i);
+    }
+    std::sort(order.begin(), order.end(),
+              [&] (FieldKind a, FieldKind b) { return tlvTypes[a] > tlvTypes[b]; });
+    return order;
+  }();
+
+  ndn::EncodingBuffer encoder(HEADROOM, 0);
+
+  // the TLV-LENGTH of LpPacket counts the network-layer packet, although it is not in this buffer
+  size_t length = fragmentSize;
+  length += encoder.prependVarNumber(fragmentSize);
+  length += encoder.prependVarNumber(lp::tlv::Fragment);
+
+  for (FieldKind kind : prependOrder) {
+    if (!this->has(kind)) {
+      continue;
+    }
+
+    switch (kind) {
+      case FIELD_NACK:
+        length += lp::NackField::encode(encoder, *m_nack);
+        break;
+      case FIELD_INCOMING_FACE_ID:
+        length += lp::IncomingFaceIdField::encode(encoder, m_incomingFaceId);
+        break;
+      case FIELD_CONGESTION_MARK:
+        length += lp::CongestionMarkField::encode(encoder, m_congestionMark);
+        break;
+      case FIELD_NON_DISCOVERY:
+        length += lp::NonDiscoveryField::encode(encoder, lp::EmptyValue{});
+        break;
+      case FIELD_PREFIX_ANNOUNCEMENT:
+        length += lp::PrefixAnnouncementField::encode(encoder, *m_prefixAnnouncement);
+        break;
+      case FIELD_HOP_COUNT:
+        length += lp::HopCountTagField::encode(encoder, m_hopCount);
+        break;
+      case FIELD_CCH_TAG:
+        length += lp::CchTagField::encode(encoder, m_cchTag);
+        break;
+      case FIELD_MAX:
+        BOOST_ASSERT(false);
+        break;
+    }
+  }
+
+  length += encoder.prependVarNumber(length);
+  encoder.prependVarNumber(lp::tlv::LpPacket);
+  return make_shared<ndn::Buffer>(encoder.begin(), encoder.end());
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_LP_HEADER_ENCODER_HPP
+#define NFD_DAEMON_FACE_LP_HEADER_ENCODER_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/lp/fields.hpp>
+
+namespace nfd {
+namespace face {
+
+/** \brief single-pass encoder of an LpPacket that carries one unfragmented network-layer packet
+ *
+ *  Header fields are collected with add(), using the same interface as lp::Packet.
+ *  encode() then writes the LpPacket TLV-TYPE and TLV-LENGTH, the header fields in TLV-TYPE
+ *  order, and the Fragment TLV-TYPE and TLV-LENGTH into one small buffer. The network-layer
+ *  packet is not copied: it is sent after the header as a separate buffer, see
+ *  Transport::Packet::header. Unlike lp::Packet, no Block is created per field.
+ *
+ *  Only the fields produced by GenericLinkService on an unfragmented packet are supported:
+ *  Nack, IncomingFaceId, CongestionMark, NonDiscovery, PrefixAnnouncement, HopCountTag, CchTag.
+ *  The Nack header is referenced, not copied; it must remain valid until encode() returns.
+ */
+class LpHeaderEncoder
+{
+public:
+  LpHeaderEncoder();
+
+  /** \brief add a header field
+   *  \tparam FIELD one of the supported lp::FieldDecl types
+   */
+  template<typename FIELD>
+  LpHeaderEncoder&
+  add(const typename FIELD::ValueType& value);
+
+  /** \return whether no header field has been added
+   *
+   *  In this case, the network-layer packet may be sent without LpPacket wrapping.
+   */
+  bool
+  empty() const
+  {
+    return m_fields == 0;
+  }
+
+  /** \brief encode the header of an LpPacket with the added header fields
+   *  \param fragmentSize size of the network-layer packet that follows the header
+   *  \return the LpPacket up to and including the TLV-LENGTH of its Fragment field
+   */
+  ndn::ConstBufferPtr
+  encode(size_t fragmentSize) const;
+
+public:
+  /** \brief initial buffer space for the header
+   *
+   *  This is enough for all supported fields except a PrefixAnnouncement;
+   *  a larger header causes one reallocation.
+   */
+  static constexpr size_t HEADROOM = 64;
+
+private:
+  enum FieldKind {
+    FIELD_NACK,
+    FIELD_INCOMING_FACE_ID,
+    FIELD_CONGESTION_MARK,
+    FIELD_NON_DISCOVERY,
+    FIELD_PREFIX_ANNOUNCEMENT,
+    FIELD_HOP_COUNT,
+    FIELD_CCH_TAG,
+    FIELD_MAX
+  };
+
+  void
+  set(FieldKind kind)
+  {
+    m_fields |= (1 << kind);
+  }
+
+  bool
+  has(FieldKind kind) const
+  {
+    return (m_fields & (1 << kind)) != 0;
+  }
+
+private:
+  uint32_t m_fields;
+  const lp::NackHeader* m_nack;
+  uint64_t m_incomingFaceId;
+  uint64_t m_congestionMark;
+  optional<lp::PrefixAnnouncementHeader> m_prefixAnnouncement;
+  uint64_t m_hopCount;
+  uint64_t m_cchTag;
+};
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::NackField>(const lp::NackHeader& value);
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::IncomingFaceIdField>(const uint64_t& value);
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::CongestionMarkField>(const uint64_t& value);
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::NonDiscoveryField>(const lp::EmptyValue& value);
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::PrefixAnnouncementField>(const lp::PrefixAnnouncementHeader& value);
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::HopCountTagField>(const uint64_t& value);
+
+template<>
+LpHeaderEncoder&
+LpHeaderEncoder::add<lp::CchTagField>(const uint64_t& value);
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_LP_HEADER_ENCODER_HPP
@@ -26,17 +26,33 @@
 #include "lp-reassembler.hpp"
 #include "link-service.hpp"
 
-#include <numeric>
+#include <cstring>
 
 namespace nfd {
 namespace face {
 
 NFD_LOG_INIT(LpReassembler);
 
+constexpr int LpReassembler::SWEEPS_PER_TIMEOUT;
+
 LpReassembler::LpReassembler(const LpReassembler::Options& options, const LinkService* linkService)
   : m_options(options)
   , m_linkService(linkService)
+  , m_isSweepScheduled(false)
+{
+}
+
+LpReassembler::~LpReassembler()
 {
+  scheduler::cancel(m_sweepTimer);
+}
+
+size_t
+LpReassembler::KeyHash::operator()(const Key& key) const
+{
+  // message identifiers from one endpoint are consecutive, so they are spread by a multiplicative hash
+  return std::hash<Transport::EndpointId>()(key.remoteEndpoint) ^
+         static_cast<size_t>(key.messageIdentifier * 0x9E3779B97F4A7C15ULL);
 }
 
 std::tuple<bool, Block, lp::Packet>
@@ -66,10 +82,11 @@ LpReassembler::receiveFragment(Transport::EndpointId remoteEndpoint, const lp::P
     return FALSE_RETURN;
   }
 
+  ndn::Buffer::const_iterator fragBegin, fragEnd;
+  std::tie(fragBegin, fragEnd) = packet.get<lp::FragmentField>();
+
   // check for fast path
   if (fragIndex == 0 && fragCount == 1) {
-    ndn::Buffer::const_iterator fragBegin, fragEnd;
-    std::tie(fragBegin, fragEnd) = packet.get<lp::FragmentField>();
     Block netPkt(&*fragBegin, std::distance(fragBegin, fragEnd));
     return std::make_tuple(true, netPkt, packet);
   }
@@ -80,14 +97,14 @@ LpReassembler::receiveFragment(Transport::EndpointId remoteEndpoint, const lp::P
     return FALSE_RETURN;
   }
   lp::Sequence messageIdentifier = packet.get<lp::SequenceField>() - fragIndex;
-  Key key = std::make_tuple(remoteEndpoint, messageIdentifier);
+  Key key{remoteEndpoint, messageIdentifier};
 
   // add to PartialPacket
   PartialPacket& pp = m_partialPackets[key];
   if (pp.fragCount == 0) { // new PartialPacket
     pp.fragCount = fragCount;
-    pp.nReceivedFragments = 0;
-    pp.fragments.resize(fragCount);
+    pp.payloadSizes.resize(fragCount);
+    pp.isReceived.resize(fragCount);
   }
   else {
     if (fragCount != pp.fragCount) {
@@ -96,62 +113,121 @@ LpReassembler::receiveFragment(Transport::EndpointId remoteEndpoint, const lp::P
     }
   }
 
-  if (pp.fragments[fragIndex].has<lp::SequenceField>()) {
+  if (pp.isReceived[fragIndex]) {
     NFD_LOG_FACE_TRACE("fragment already received: DROP");
     return FALSE_RETURN;
   }
 
-  pp.fragments[fragIndex] = packet;
+  if (!storePayload(pp, fragIndex, &*fragBegin, std::distance(fragBegin, fragEnd))) {
+    NFD_LOG_FACE_WARN("reassembly error, packet size over limit: DROP");
+    m_partialPackets.erase(key);
+    return FALSE_RETURN;
+  }
+  pp.isReceived[fragIndex] = true;
   ++pp.nReceivedFragments;
+  if (fragIndex == 0) {
+    pp.firstFragment = packet;
+  }
 
   // check complete condition
   if (pp.nReceivedFragments == pp.fragCount) {
-    Block reassembled = doReassembly(key);
-    lp::Packet firstFrag(std::move(pp.fragments[0]));
+    PartialPacket completed(std::move(pp));
     m_partialPackets.erase(key);
-    return std::make_tuple(true, reassembled, firstFrag);
+    Block reassembled = doReassembly(completed);
+    return std::make_tuple(true, reassembled, completed.firstFragment);
   }
 
-  // set drop timer
-  pp.dropTimer = scheduler::schedule(m_options.reassemblyTimeout, [=] { timeoutPartialPacket(key); });
+  // extend deadline
+  pp.expiry = time::steady_clock::now() + m_options.reassemblyTimeout;
+  this->scheduleSweep();
 
   return FALSE_RETURN;
 }
 
+bool
+LpReassembler::storePayload(PartialPacket& pp, size_t fragIndex,
+                            const uint8_t* payload, size_t payloadSize)
+{
+  if (pp.totalPayloadSize + payloadSize > ndn::MAX_NDN_PACKET_SIZE) {
+    return false;
+  }
+
+  if (pp.buffer == nullptr || payloadSize > pp.slotSize) {
+    // (re)allocate the buffer with larger slots, moving payloads already received
+    size_t newSlotSize = std::max(payloadSize, pp.slotSize);
+    // FragCount is chosen by the sender: bound the allocation before trusting it;
+    // allow two extra slots because the first and last fragments may be shorter than the others
+    if (newSlotSize * pp.fragCount > ndn::MAX_NDN_PACKET_SIZE + 2 * newSlotSize) {
+      return false;
+    }
+    auto newBuffer = make_shared<ndn::Buffer>(newSlotSize * pp.fragCount);
+    if (pp.buffer != nullptr) {
+      for (size_t i = 0; i < pp.fragCount; ++i) {
+        if (pp.isReceived[i]) {
+          std::memcpy(newBuffer->data() + i * newSlotSize, pp.buffer->data() + i * pp.slotSize,
+                      pp.payloadSizes[i]);
+        }
+      }
+    }
+    pp.buffer = std::move(newBuffer);
+    pp.slotSize = newSlotSize;
+  }
+
+  std::memcpy(pp.buffer->data() + fragIndex * pp.slotSize, payload, payloadSize);
+  pp.payloadSizes[fragIndex] = payloadSize;
+  pp.totalPayloadSize += payloadSize;
+  return true;
+}
+
 Block
-LpReassembler::doReassembly(const Key& key)
+LpReassembler::doReassembly(PartialPacket& pp)
 {
-  PartialPacket& pp = m_partialPackets[key];
+  // close gaps left by fragments shorter than slotSize; none for an evenly fragmented packet
+  size_t payloadSize = 0;
+  for (size_t i = 0; i < pp.fragCount; ++i) {
+    size_t offset = i * pp.slotSize;
+    if (offset != payloadSize) {
+      std::memmove(pp.buffer->data() + payloadSize, pp.buffer->data() + offset, pp.payloadSizes[i]);
+    }
+    payloadSize += pp.payloadSizes[i];
+  }
 
-  size_t payloadSize = std::accumulate(pp.fragments.begin(), pp.fragments.end(), 0U,
-    [&] (size_t sum, const lp::Packet& pkt) -> size_t {
-      ndn::Buffer::const_iterator fragBegin, fragEnd;
-      std::tie(fragBegin, fragEnd) = pkt.get<lp::FragmentField>();
-      return sum + std::distance(fragBegin, fragEnd);
-    });
+  return Block(pp.buffer, pp.buffer->begin(), pp.buffer->begin() + payloadSize);
+}
 
-  ndn::Buffer fragBuffer(payloadSize);
-  auto it = fragBuffer.begin();
+void
+LpReassembler::sweep()
+{
+  m_isSweepScheduled = false;
 
-  for (const lp::Packet& frag : pp.fragments) {
-    ndn::Buffer::const_iterator fragBegin, fragEnd;
-    std::tie(fragBegin, fragEnd) = frag.get<lp::FragmentField>();
-    it = std::copy(fragBegin, fragEnd, it);
+  auto now = time::steady_clock::now();
+  for (auto it = m_partialPackets.begin(); it != m_partialPackets.end();) {
+    if (it->second.expiry <= now) {
+      this->beforeTimeout(it->first.remoteEndpoint, it->second.nReceivedFragments);
+      it = m_partialPackets.erase(it);
+    }
+    else {
+      ++it;
+    }
   }
 
-  return Block(&*(fragBuffer.cbegin()), std::distance(fragBuffer.cbegin(), fragBuffer.cend()));
+  if (!m_partialPackets.empty()) {
+    this->scheduleSweep();
+  }
 }
 
 void
-LpReassembler::timeoutPartialPacket(const Key& key)
+LpReassembler::scheduleSweep()
 {
-  auto it = m_partialPackets.find(key);
-  if (it == m_partialPackets.end()) {
+  if (m_isSweepScheduled) {
     return;
   }
 
-  this->beforeTimeout(std::get<0>(key), it->second.nReceivedFragments);
-  m_partialPackets.erase(it);
+  ExecutionContext& context = m_linkService != nullptr ? m_linkService->getExecutionContext() :
+                                                         getGlobalExecutionContext();
+  auto interval = std::max<time::nanoseconds>(m_options.reassemblyTimeout / SWEEPS_PER_TIMEOUT, 1_ms);
+  m_sweepTimer = context.schedule(interval, [this] { sweep(); });
+  m_isSweepScheduled = true;
 }
 
 std::ostream&
@@ -38,6 +38,12 @@ namespace face {
 class LinkService;
 
 /** \brief reassembles fragmented network-layer packets
+ *
+ *  Fragment payloads are copied, as they arrive, into one buffer per partial packet,
+ *  which becomes the reassembled packet without further copying.
+ *  Partial packets are expired by a periodic sweep, which runs only while there are
+ *  partial packets, instead of a timer per partial packet.
+ *
  *  \sa https://redmine.named-data.net/projects/nfd/wiki/NDNLPv2
  */
 class LpReassembler : noncopyable
@@ -61,6 +67,8 @@ public:
   explicit
   LpReassembler(const Options& options, const LinkService* linkService = nullptr);
 
+  ~LpReassembler();
+
   /** \brief set options for reassembler
    */
   void
@@ -99,34 +107,83 @@ public:
    */
   signal::Signal<LpReassembler, Transport::EndpointId, size_t> beforeTimeout;
 
+public:
+  /** \brief the sweep runs this many times per Options::reassemblyTimeout
+   *
+   *  A partial packet is dropped at most reassemblyTimeout/SWEEPS_PER_TIMEOUT later than
+   *  its deadline.
+   */
+  static constexpr int SWEEPS_PER_TIMEOUT = 8;
+
 private:
-  /** \brief holds all fragments of packet until reassembled
+  /** \brief holds fragment payloads of a packet until reassembled
+   *
+   *  The payload of fragment i is stored at offset i*slotSize of the buffer.
+   *  slotSize is the largest payload received so far; a sender that fragments evenly
+   *  (such as LpFragmenter) makes it fixed after the first non-last fragment,
+   *  so that each payload is copied exactly once.
    */
   struct PartialPacket
   {
-    std::vector<lp::Packet> fragments;
-    size_t fragCount; ///< total fragments
-    size_t nReceivedFragments; ///< number of received fragments
-    scheduler::ScopedEventId dropTimer;
+    shared_ptr<ndn::Buffer> buffer;
+    size_t slotSize = 0;
+    std::vector<size_t> payloadSizes;
+    size_t totalPayloadSize = 0; ///< sum of payloadSizes
+    std::vector<bool> isReceived;
+    lp::Packet firstFragment; ///< fragment with FragIndex 0, holding other NDNLPv2 headers
+    size_t fragCount = 0; ///< total fragments
+    size_t nReceivedFragments = 0; ///< number of received fragments
+    time::steady_clock::TimePoint expiry;
   };
 
   /** \brief index key for PartialPackets
    */
-  typedef std::tuple<
-    Transport::EndpointId, // remoteEndpoint
-    lp::Sequence // message identifier (sequence of the first fragment)
-  > Key;
+  struct Key
+  {
+    Transport::EndpointId remoteEndpoint;
+    lp::Sequence messageIdentifier; ///< sequence of the first fragment
+
+    bool
+    operator==(const Key& other) const
+    {
+      return remoteEndpoint == other.remoteEndpoint &&
+             messageIdentifier == other.messageIdentifier;
+    }
+  };
 
-  Block
-  doReassembly(const Key& key);
+  struct KeyHash
+  {
+    size_t
+    operator()(const Key& key) const;
+  };
+
+  /** \brief copy the payload of fragment \p fragIndex into the buffer of \p pp
+   *  \return false if the buffer or the reassembled packet would exceed MAX_NDN_PACKET_SIZE;
+   *          \p pp is unchanged in this case
+   */
+  static bool
+  storePayload(PartialPacket& pp, size_t fragIndex, const uint8_t* payload, size_t payloadSize);
+
+  /** \brief construct the reassembled packet from the buffer of \p pp
+   *  \throw tlv::Error the reassembled packet is malformed
+   */
+  static Block
+  doReassembly(PartialPacket& pp);
+
+  /** \brief drop partial packets whose deadline has passed
+   */
+  void
+  sweep();
 
   void
-  timeoutPartialPacket(const Key& key);
+  scheduleSweep();
 
 private:
   Options m_options;
-  std::map<Key, PartialPacket> m_partialPackets;
+  std::unordered_map<Key, PartialPacket, KeyHash> m_partialPackets;
   const LinkService* m_linkService;
+  scheduler::EventId m_sweepTimer;
+  bool m_isSweepScheduled;
 };
 
 std::ostream&
@@ -25,8 +25,11 @@
 
 #include "lp-reliability.hpp"
 #include "generic-link-service.hpp"
+#include "lp-ack-range.hpp"
 #include "transport.hpp"
 
+#include <algorithm>
+
 namespace nfd {
 namespace face {
 
@@ -34,6 +37,7 @@ LpReliability::LpReliability(const LpReliability::Options& options, GenericLinkS
   : m_options(options)
   , m_linkService(linkService)
   , m_firstUnackedFrag(m_unackedFrags.begin())
+  , m_isPeerAckRangeCapable(false)
   , m_lastTxSeqNo(-1) // set to "-1" to start TxSequence numbers at 0
   , m_isIdleAckTimerRunning(false)
 {
@@ -65,7 +69,6 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
 {
   BOOST_ASSERT(m_options.isEnabled);
 
-  auto unackedFragsIt = m_unackedFrags.begin();
   auto sendTime = time::steady_clock::now();
 
   auto netPkt = make_shared<NetPkt>(std::move(pkt), isInterest);
@@ -76,12 +79,10 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
     lp::Sequence txSeq = assignTxSequence(frag);
 
     // Store LpPacket for future retransmissions
-    unackedFragsIt = m_unackedFrags.emplace_hint(unackedFragsIt,
-                                                 std::piecewise_construct,
-                                                 std::forward_as_tuple(txSeq),
-                                                 std::forward_as_tuple(frag));
+    auto unackedFragsIt = m_unackedFrags.emplace(txSeq, frag);
     unackedFragsIt->second.sendTime = sendTime;
-    unackedFragsIt->second.rtoTimer = scheduler::schedule(m_rto.computeRto(), [=] { onLpPacketLost(txSeq); });
+    unackedFragsIt->second.rtoTimer = m_linkService->getExecutionContext().schedule(
+      m_rto.computeRto(), [=] { onLpPacketLost(txSeq); });
     unackedFragsIt->second.netPkt = netPkt;
 
     if (m_unackedFrags.size() == 1) {
@@ -102,44 +103,14 @@ LpReliability::processIncomingPacket(const lp::Packet& pkt)
 
   // Extract and parse Acks
   for (lp::Sequence ackSeq : pkt.list<lp::AckField>()) {
-    auto fragIt = m_unackedFrags.find(ackSeq);
-    if (fragIt == m_unackedFrags.end()) {
-      // Ignore an Ack for an unknown TxSequence number
-      continue;
-    }
-    auto& frag = fragIt->second;
-
-    // Cancel the RTO timer for the acknowledged fragment
-    frag.rtoTimer.cancel();
-
-    if (frag.retxCount == 0) {
-      // This sequence had no retransmissions, so use it to calculate the RTO
-      m_rto.addMeasurement(time::duration_cast<RttEstimator::Duration>(now - frag.sendTime));
-    }
+    this->processAck(ackSeq, now);
+  }
 
-    // Look for frags with TxSequence numbers < ackSeq (allowing for wraparound) and consider them
-    // lost if a configurable number of Acks containing greater TxSequence numbers have been
-    // received.
-    auto lostLpPackets = findLostLpPackets(fragIt);
-
-    // Remove the fragment from the map of unacknowledged fragments and from its associated network
-    // packet. Potentially increment the start of the window.
-    onLpPacketAcknowledged(fragIt);
-
-    // This set contains TxSequences that have been removed by onLpPacketLost below because they
-    // were part of a network packet that was removed due to a fragment exceeding retx, as well as
-    // any other TxSequences removed by onLpPacketLost. This prevents onLpPacketLost from being
-    // called later for an invalid iterator.
-    std::set<lp::Sequence> removedLpPackets;
-
-    // Resend or fail fragments considered lost. Potentially increment the start of the window.
-    for (lp::Sequence txSeq : lostLpPackets) {
-      if (removedLpPackets.find(txSeq) == removedLpPackets.end()) {
-        auto removedThisTxSeq = this->onLpPacketLost(txSeq);
-        for (auto removedTxSeq : removedThisTxSeq) {
-          removedLpPackets.insert(removedTxSeq);
-        }
-      }
+  // Extract and parse AckRanges; receiving any AckRange shows that the peer supports them
+  for (const LpAckRange& ackRange : pkt.list<AckRangeField>()) {
+    m_isPeerAckRangeCapable = true;
+    for (lp::Sequence ackSeq : ackRange.getSequences()) {
+      this->processAck(ackSeq, now);
     }
   }
 
@@ -165,6 +136,20 @@ LpReliability::piggyback(lp::Packet& pkt, ssize_t mtu)
   ssize_t remainingSpace = (mtu == MTU_UNLIMITED ? ndn::MAX_NDN_PACKET_SIZE : mtu) - reservedSpace;
   remainingSpace -= pktSize;
 
+  if (m_options.allowAckRanges) {
+    if (m_isPeerAckRangeCapable) {
+      this->piggybackAckRanges(pkt, remainingSpace);
+      return;
+    }
+
+    // advertise AckRange support with an empty AckRange, which a peer may ignore
+    LpAckRange advertisement;
+    if (static_cast<ssize_t>(advertisement.getEncodedSize()) <= remainingSpace) {
+      pkt.add<AckRangeField>(advertisement);
+      remainingSpace -= advertisement.getEncodedSize();
+    }
+  }
+
   while (!m_ackQueue.empty()) {
     lp::Sequence ackSeq = m_ackQueue.front();
     // Ack size = Ack TLV-TYPE (3 octets) + TLV-LENGTH (1 octet) + uint64_t (8 octets)
@@ -182,6 +167,98 @@ LpReliability::piggyback(lp::Packet& pkt, ssize_t mtu)
   }
 }
 
+void
+LpReliability::processAck(lp::Sequence ackSeq, time::steady_clock::TimePoint now)
+{
+  auto fragIt = m_unackedFrags.find(ackSeq);
+  if (fragIt == m_unackedFrags.end()) {
+    // Ignore an Ack for an unknown TxSequence number
+    return;
+  }
+  auto& frag = fragIt->second;
+
+  // Cancel the RTO timer for the acknowledged fragment
+  frag.rtoTimer.cancel();
+
+  if (frag.retxCount == 0) {
+    // This sequence had no retransmissions, so use it to calculate the RTO
+    m_rto.addMeasurement(time::duration_cast<RttEstimator::Duration>(now - frag.sendTime));
+  }
+
+  // Look for frags with TxSequence numbers < ackSeq (allowing for wraparound) and consider them
+  // lost if a configurable number of Acks containing greater TxSequence numbers have been
+  // received.
+  auto lostLpPackets = findLostLpPackets(fragIt);
+
+  // Remove the fragment from the map of unacknowledged fragments and from its associated network
+  // packet. Potentially increment the start of the window.
+  onLpPacketAcknowledged(fragIt);
+
+  // This set contains TxSequences that have been removed by onLpPacketLost below because they
+  // were part of a network packet that was removed due to a fragment exceeding retx, as well as
+  // any other TxSequences removed by onLpPacketLost. This prevents onLpPacketLost from being
+  // called later for an invalid iterator.
+  std::set<lp::Sequence> removedLpPackets;
+
+  // Resend or fail fragments considered lost. Potentially increment the start of the window.
+  for (lp::Sequence txSeq : lostLpPackets) {
+    if (removedLpPackets.find(txSeq) == removedLpPackets.end()) {
+      auto removedThisTxSeq = this->onLpPacketLost(txSeq);
+      for (auto removedTxSeq : removedThisTxSeq) {
+        removedLpPackets.insert(removedTxSeq);
+      }
+    }
+  }
+}
+
+void
+LpReliability::piggybackAckRanges(lp::Packet& pkt, ssize_t& remainingSpace)
+{
+  if (m_ackQueue.empty()) {
+    return;
+  }
+
+  std::vector<lp::Sequence> acks;
+  acks.reserve(m_ackQueue.size());
+  while (!m_ackQueue.empty()) {
+    acks.push_back(m_ackQueue.front());
+    m_ackQueue.pop();
+  }
+
+  // Sort relative to the oldest queued Ack, allowing for wraparound. An Ack for a TxSequence
+  // received out of order before it may end up last and in its own AckRange, which is harmless.
+  lp::Sequence ref = acks.front();
+  std::sort(acks.begin(), acks.end(), [ref] (lp::Sequence a, lp::Sequence b) { return a - ref < b - ref; });
+  acks.erase(std::unique(acks.begin(), acks.end()), acks.end());
+
+  // All ranges go into one AckRange field, because a peer that decodes AckRange as an
+  // unrecognized field rejects a packet that repeats it.
+  // Space for TLV-TYPE and TLV-LENGTH is reserved upfront, with TLV-LENGTH in up to 3 octets.
+  ssize_t valueSpace = remainingSpace - tlv::sizeOfVarNumber(LpAckRange::TLV_TYPE) -
+                       tlv::sizeOfVarNumber(ndn::MAX_NDN_PACKET_SIZE);
+  LpAckRange ackRange;
+  auto it = acks.begin();
+  while (it != acks.end() && static_cast<ssize_t>(LpAckRange::RANGE_BASE_SIZE) <= valueSpace) {
+    size_t maxBitmapSize = std::min<size_t>(LpAckRange::MAX_BITMAP_SIZE,
+                                            valueSpace - LpAckRange::RANGE_BASE_SIZE);
+    size_t prevValueSize = ackRange.getValueSize();
+    ackRange.addRange(*it);
+    for (++it; it != acks.end() && ackRange.add(*it, maxBitmapSize); ++it) {
+    }
+    valueSpace -= ackRange.getValueSize() - prevValueSize;
+  }
+
+  if (!ackRange.empty()) {
+    pkt.add<AckRangeField>(ackRange);
+    remainingSpace -= ackRange.getEncodedSize();
+  }
+
+  // Acks that do not fit remain queued
+  for (; it != acks.end(); ++it) {
+    m_ackQueue.push(*it);
+  }
+}
+
 lp::Sequence
 LpReliability::assignTxSequence(lp::Packet& frag)
 {
@@ -199,7 +276,7 @@ LpReliability::startIdleAckTimer()
   BOOST_ASSERT(!m_isIdleAckTimerRunning);
   m_isIdleAckTimerRunning = true;
 
-  m_idleAckTimer = scheduler::schedule(m_options.idleAckTimerPeriod, [this] {
+  m_idleAckTimer = m_linkService->getExecutionContext().schedule(m_options.idleAckTimerPeriod, [this] {
     while (!m_ackQueue.empty()) {
       m_linkService->requestIdlePacket();
     }
@@ -220,15 +297,9 @@ LpReliability::findLostLpPackets(LpReliability::UnackedFrags::iterator ackIt)
 {
   std::vector<lp::Sequence> lostLpPackets;
 
-  for (auto it = m_firstUnackedFrag; ; ++it) {
-    if (it == m_unackedFrags.end()) {
-      it = m_unackedFrags.begin();
-    }
-
-    if (it->first == ackIt->first) {
-      break;
-    }
-
+  // m_unackedFrags iterates in window order, so this visits TxSequences < ackSeq
+  // with consideration of wraparound
+  for (auto it = m_firstUnackedFrag; it != ackIt; ++it) {
     auto& unackedFrag = it->second;
     unackedFrag.nGreaterSeqAcks++;
 
@@ -279,17 +350,13 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq)
     // Assign new TxSequence
     lp::Sequence newTxSeq = assignTxSequence(txFrag.pkt);
     netPkt->didRetx = true;
+    size_t retxCount = txFrag.retxCount + 1;
 
     // Move fragment to new TxSequence mapping
-    auto newTxFragIt = m_unackedFrags.emplace_hint(
-      m_firstUnackedFrag != m_unackedFrags.end() && m_firstUnackedFrag->first > newTxSeq
-        ? m_firstUnackedFrag
-        : m_unackedFrags.end(),
-      std::piecewise_construct,
-      std::forward_as_tuple(newTxSeq),
-      std::forward_as_tuple(txFrag.pkt));
+    // (this may relocate entries in m_unackedFrags, so txFrag is not used afterwards)
+    auto newTxFragIt = m_unackedFrags.emplace(newTxSeq, lp::Packet(txFrag.pkt));
     auto& newTxFrag = newTxFragIt->second;
-    newTxFrag.retxCount = txFrag.retxCount + 1;
+    newTxFrag.retxCount = retxCount;
     newTxFrag.netPkt = netPkt;
 
     // Update associated NetPkt
@@ -301,10 +368,13 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq)
     deleteUnackedFrag(txSeqIt);
 
     // Retransmit fragment
-    m_linkService->sendLpPacket(lp::Packet(newTxFrag.pkt));
+    m_linkService->sendLpPacket(lp::Packet(newTxFrag.pkt), netPkt->isInterest ?
+                                LpEgressScheduler::TrafficClass::INTEREST :
+                                LpEgressScheduler::TrafficClass::DATA);
 
     // Start RTO timer for this sequence
-    newTxFrag.rtoTimer = scheduler::schedule(m_rto.computeRto(), [=] { onLpPacketLost(newTxSeq); });
+    newTxFrag.rtoTimer = m_linkService->getExecutionContext().schedule(
+      m_rto.computeRto(), [=] { onLpPacketLost(newTxSeq); });
   }
 
   return removedThisTxSeq;
@@ -337,22 +407,11 @@ LpReliability::onLpPacketAcknowledged(UnackedFrags::iterator fragIt)
 void
 LpReliability::deleteUnackedFrag(UnackedFrags::iterator fragIt)
 {
-  lp::Sequence firstUnackedTxSeq = m_firstUnackedFrag->first;
-  lp::Sequence currentTxSeq = fragIt->first;
-  auto nextFragIt = m_unackedFrags.erase(fragIt);
+  m_unackedFrags.erase(fragIt);
 
-  if (!m_unackedFrags.empty() && firstUnackedTxSeq == currentTxSeq) {
-    // If "first" fragment in send window (allowing for wraparound), increment window begin
-    if (nextFragIt == m_unackedFrags.end()) {
-      m_firstUnackedFrag = m_unackedFrags.begin();
-    }
-    else {
-      m_firstUnackedFrag = nextFragIt;
-    }
-  }
-  else if (m_unackedFrags.empty()) {
-    m_firstUnackedFrag = m_unackedFrags.end();
-  }
+  // If "first" fragment in send window (allowing for wraparound), the window begin is moved to
+  // the next fragment in window order
+  m_firstUnackedFrag = m_unackedFrags.begin();
 }
 
 LpReliability::UnackedFrag::UnackedFrag(lp::Packet pkt)
@@ -26,6 +26,7 @@
 #ifndef NFD_DAEMON_FACE_LP_RELIABILITY_HPP
 #define NFD_DAEMON_FACE_LP_RELIABILITY_HPP
 
+#include "lp-sequence-ring.hpp"
 #include "core/rtt-estimator.hpp"
 #include "core/scheduler.hpp"
 
@@ -63,6 +64,15 @@ public:
      *         numbers are acknowledged
      */
     size_t seqNumLossThreshold = 3;
+
+    /** \brief allows Acks to be encoded in an AckRange field
+     *
+     *  When enabled, this side advertises AckRange support to the peer, and switches from one
+     *  Ack field per TxSequence to one AckRange field per packet once the peer has advertised
+     *  support too.
+     *  Incoming AckRange fields are always accepted.
+     */
+    bool allowAckRanges = false;
   };
 
   LpReliability(const Options& options, GenericLinkService* linkService);
@@ -107,7 +117,7 @@ public:
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   class UnackedFrag;
   class NetPkt;
-  using UnackedFrags = std::map<lp::Sequence, UnackedFrag>;
+  using UnackedFrags = LpSequenceRing<UnackedFrag>;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief assign TxSequence number to a fragment
@@ -132,6 +142,17 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   stopIdleAckTimer();
 
+  /** \brief process an Ack for \p ackSeq received in an Ack or AckRange field
+   */
+  void
+  processAck(lp::Sequence ackSeq, time::steady_clock::TimePoint now);
+
+  /** \brief attach pending Acks as one AckRange field
+   *  \param remainingSpace space available in \p pkt, decreased by the size of attached fields
+   */
+  void
+  piggybackAckRanges(lp::Packet& pkt, ssize_t& remainingSpace);
+
   /** \brief find and mark as lost fragments where a configurable number of Acks
    *         (\p m_options.seqNumLossThreshold) have been received for greater TxSequence numbers
    *  \param ackIt iterator pointing to acknowledged fragment
@@ -160,8 +181,8 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
    *  \param fragIt iterator to an UnackedFrag, must be dereferencable
    *  \post fragIt is not in m_unackedFrags
    *  \post if was equal to m_firstUnackedFrag,
-   *        m_firstUnackedFrag is set to the UnackedFrag after fragIt with consideration of
-   *        TxSequence number wraparound, or set to m_unackedFrags.end() if m_unackedFrags is empty
+   *        m_firstUnackedFrag is set to the UnackedFrag after fragIt in window order,
+   *        or set to m_unackedFrags.end() if m_unackedFrags is empty
    */
   void
   deleteUnackedFrag(UnackedFrags::iterator fragIt);
@@ -208,11 +229,12 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   UnackedFrags m_unackedFrags;
   /** An iterator that points to the first unacknowledged fragment in the current window. The window
    *  can wrap around so that the beginning of the window is at a TxSequence greater than other
-   *  fragments in the window. When the window is moved past the last item in the iterator, the
-   *  first fragment in the map will become the start of the window.
+   *  fragments in the window; m_unackedFrags iterates in window order, so this is always its
+   *  first entry.
    */
   UnackedFrags::iterator m_firstUnackedFrag;
   std::queue<lp::Sequence> m_ackQueue;
+  bool m_isPeerAckRangeCapable;
   lp::Sequence m_lastTxSeqNo;
   scheduler::ScopedEventId m_idleAckTimer;
   bool m_isIdleAckTimerRunning;
@@ -0,0 +1,316 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_LP_SEQUENCE_RING_HPP
+#define NFD_DAEMON_FACE_LP_SEQUENCE_RING_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/lp/sequence.hpp>
+
+#include <tuple>
+
+namespace nfd {
+namespace face {
+
+/** \brief a window of entries indexed by consecutive NDNLPv2 sequence numbers
+ *
+ *  Entries are stored in a ring buffer whose slot is selected by the low bits of the sequence
+ *  number, so that lookup, insertion, and erasure need neither tree traversal nor per-entry
+ *  allocation. The window spans from the oldest stored sequence number to the newest one,
+ *  allowing for wraparound, and the ring grows when the window exceeds its capacity.
+ *
+ *  The interface mimics the subset of std::map used by LpReliability. Iterators refer to a
+ *  sequence number rather than to a slot, so they stay valid across insertion of other entries
+ *  and across growth of the ring. Iteration follows window order rather than numeric order.
+ */
+template<typename T>
+class LpSequenceRing : noncopyable
+{
+public:
+  using key_type = lp::Sequence;
+  using mapped_type = T;
+  using value_type = std::pair<const lp::Sequence, T>;
+
+  class iterator
+  {
+  public:
+    iterator() = default;
+
+    value_type&
+    operator*() const
+    {
+      return *m_ring->getSlot(m_seq);
+    }
+
+    value_type*
+    operator->() const
+    {
+      return &**this;
+    }
+
+    iterator&
+    operator++()
+    {
+      *this = m_ring->findNext(m_seq);
+      return *this;
+    }
+
+    friend bool
+    operator==(const iterator& lhs, const iterator& rhs)
+    {
+      return lhs.m_ring == rhs.m_ring && lhs.m_isEnd == rhs.m_isEnd &&
+             (lhs.m_isEnd || lhs.m_seq == rhs.m_seq);
+    }
+
+    friend bool
+    operator!=(const iterator& lhs, const iterator& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    iterator(LpSequenceRing* ring, lp::Sequence seq, bool isEnd)
+      : m_ring(ring)
+      , m_seq(seq)
+      , m_isEnd(isEnd)
+    {
+    }
+
+  private:
+    LpSequenceRing* m_ring = nullptr;
+    lp::Sequence m_seq = 0;
+    bool m_isEnd = true;
+
+    friend LpSequenceRing;
+  };
+
+  /** \param initialCapacity initial number of slots, rounded up to a power of two
+   */
+  explicit
+  LpSequenceRing(size_t initialCapacity = 64)
+  {
+    size_t capacity = 1;
+    while (capacity < initialCapacity) {
+      capacity <<= 1;
+    }
+    m_slots.resize(capacity);
+  }
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  /** \return number of slots in the ring
+   */
+  size_t
+  capacity() const
+  {
+    return m_slots.size();
+  }
+
+  /** \return iterator to the oldest entry in the window
+   */
+  iterator
+  begin()
+  {
+    return m_size == 0 ? end() : iterator(this, m_first, false);
+  }
+
+  iterator
+  end()
+  {
+    return iterator(this, 0, true);
+  }
+
+  iterator
+  find(lp::Sequence seq)
+  {
+    if (!isInWindow(seq) || !getSlot(seq)) {
+      return end();
+    }
+    return iterator(this, seq, false);
+  }
+
+  size_t
+  count(lp::Sequence seq) const
+  {
+    return isInWindow(seq) && getSlot(seq) ? 1 : 0;
+  }
+
+  /** \throw std::out_of_range no entry has sequence number \p seq
+   */
+  T&
+  at(lp::Sequence seq)
+  {
+    if (count(seq) == 0) {
+      BOOST_THROW_EXCEPTION(std::out_of_range("sequence not in window"));
+    }
+    return getSlot(seq)->second;
+  }
+
+  /** \brief insert an entry constructed from \p args, unless \p seq is already present
+   *  \pre \p seq does not precede the oldest entry in the window
+   *  \return iterator to the entry with sequence number \p seq
+   *  \throw std::length_error the window would exceed MAX_CAPACITY
+   */
+  template<typename... Args>
+  iterator
+  emplace(lp::Sequence seq, Args&&... args)
+  {
+    if (m_size == 0) {
+      m_first = seq;
+      m_last = seq;
+    }
+    else if (isInWindow(seq)) {
+      if (getSlot(seq)) {
+        return iterator(this, seq, false);
+      }
+    }
+    else {
+      // seq is after the newest entry (allowing for wraparound)
+      size_t span = static_cast<size_t>(seq - m_first) + 1;
+      if (span > MAX_CAPACITY) {
+        BOOST_THROW_EXCEPTION(std::length_error("sequence window too large"));
+      }
+      if (span > m_slots.size()) {
+        grow(span);
+      }
+      m_last = seq;
+    }
+
+    getSlot(seq).emplace(std::piecewise_construct,
+                         std::forward_as_tuple(seq),
+                         std::forward_as_tuple(std::forward<Args>(args)...));
+    ++m_size;
+    return iterator(this, seq, false);
+  }
+
+  /** \brief erase an entry
+   *  \param it iterator to an entry, must be dereferencable
+   *  \return iterator to the next entry in window order, or end()
+   */
+  iterator
+  erase(iterator it)
+  {
+    BOOST_ASSERT(it.m_ring == this && !it.m_isEnd);
+    lp::Sequence seq = it.m_seq;
+    getSlot(seq) = nullopt;
+    --m_size;
+
+    if (m_size == 0) {
+      return end();
+    }
+
+    iterator next = findNext(seq);
+    if (seq == m_first) {
+      m_first = next.m_seq; // the newest entry is still present, so next is not end()
+    }
+    else if (seq == m_last) {
+      while (!getSlot(m_last)) {
+        --m_last;
+      }
+    }
+    return next;
+  }
+
+public:
+  /// upper bound on the window size, which prevents a stray sequence number from exhausting memory
+  static constexpr size_t MAX_CAPACITY = 1 << 22;
+
+private:
+  optional<value_type>&
+  getSlot(lp::Sequence seq)
+  {
+    return m_slots[seq & (m_slots.size() - 1)];
+  }
+
+  const optional<value_type>&
+  getSlot(lp::Sequence seq) const
+  {
+    return m_slots[seq & (m_slots.size() - 1)];
+  }
+
+  bool
+  isInWindow(lp::Sequence seq) const
+  {
+    return m_size > 0 && seq - m_first <= m_last - m_first;
+  }
+
+  iterator
+  findNext(lp::Sequence seq)
+  {
+    while (seq != m_last) {
+      ++seq;
+      if (getSlot(seq)) {
+        return iterator(this, seq, false);
+      }
+    }
+    return end();
+  }
+
+  void
+  grow(size_t span)
+  {
+    size_t capacity = m_slots.size();
+    while (capacity < span) {
+      capacity <<= 1;
+    }
+
+    std::vector<optional<value_type>> slots(capacity);
+    for (lp::Sequence seq = m_first; ; ++seq) {
+      auto& slot = getSlot(seq);
+      if (slot) {
+        slots[seq & (capacity - 1)].emplace(std::move(*slot));
+      }
+      if (seq == m_last) {
+        break;
+      }
+    }
+    m_slots = std::move(slots);
+  }
+
+private:
+  std::vector<optional<value_type>> m_slots;
+  size_t m_size = 0;
+  lp::Sequence m_first = 0; ///< oldest sequence number in the window, always occupied
+  lp::Sequence m_last = 0; ///< newest sequence number in the window, always occupied
+};
+
+template<typename T>
+constexpr size_t LpSequenceRing<T>::MAX_CAPACITY;
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_LP_SEQUENCE_RING_HPP
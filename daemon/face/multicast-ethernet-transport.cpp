@@ -50,8 +50,9 @@ NFD_LOG_INIT(MulticastEthernetTransport);
 
 MulticastEthernetTransport::MulticastEthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
                                                        const ethernet::Address& mcastAddress,
-                                                       ndn::nfd::LinkType linkType)
-  : EthernetTransport(localEndpoint, mcastAddress)
+                                                       ndn::nfd::LinkType linkType,
+                                                       const EthernetPacketRing::Options& ringOptions)
+  : EthernetTransport(localEndpoint, mcastAddress, ringOptions)
 #if defined(__linux__)
   , m_interfaceIndex(localEndpoint.getIndex())
 #endif
@@ -75,7 +76,7 @@ MulticastEthernetTransport::MulticastEthernetTransport(const ndn::net::NetworkIn
            ethernet::ETHERTYPE_NDN,
            m_destAddress.toString().data(),
            m_srcAddress.toString().data());
-  m_pcap.setPacketFilter(filter);
+  setPacketFilter(filter);
 
   BOOST_ASSERT(m_destAddress.isMulticast());
   if (!m_destAddress.isBroadcast())
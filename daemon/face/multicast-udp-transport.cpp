@@ -86,9 +86,14 @@ MulticastUdpTransport::doSend(Transport::Packet&& packet)
 {
   NFD_LOG_FACE_TRACE(__func__);
 
-  m_sendSocket.async_send_to(boost::asio::buffer(packet.packet), m_multicastGroup,
-                             // packet.packet is copied into the lambda to retain the underlying Buffer
-                             [this, p = packet.packet] (auto&&... args) {
+  std::array<boost::asio::const_buffer, 2> buffers{{{}, boost::asio::buffer(packet.packet)}};
+  if (packet.header != nullptr) {
+    buffers[0] = boost::asio::buffer(packet.header->data(), packet.header->size());
+  }
+
+  m_sendSocket.async_send_to(buffers, m_multicastGroup,
+                             // header and packet are copied into the lambda to retain the underlying Buffers
+                             [this, h = packet.header, p = packet.packet] (auto&&... args) {
                                this->handleSend(std::forward<decltype(args)>(args)...);
                              });
 }
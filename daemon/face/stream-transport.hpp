@@ -30,7 +30,8 @@
 #include "socket-utils.hpp"
 #include "core/global-io.hpp"
 
-#include <queue>
+#include <array>
+#include <deque>
 
 namespace nfd {
 namespace face {
@@ -55,7 +56,24 @@ public:
   ssize_t
   getSendQueueLength() override;
 
+  /** \brief maximum number of queued packets handed to the socket in a single gather write
+   *
+   *  A packet with a separate LpPacket header occupies two buffers of the write.
+   */
+  static constexpr size_t MAX_SEND_BUFFERS = 64;
+
+  /** \brief capacity of the receive buffer
+   *
+   *  The buffer holds several packets, so that a single read can pick up a burst of small
+   *  packets. Unparsed bytes are moved to the front only when less than one maximum-sized
+   *  packet fits after them.
+   */
+  static constexpr size_t RECEIVE_BUFFER_SIZE = 8 * ndn::MAX_NDN_PACKET_SIZE;
+
 protected:
+  bool
+  canSendSeparateHeader() const override;
+
   void
   doClose() override;
 
@@ -100,18 +118,28 @@ protected:
   NFD_LOG_MEMBER_DECL();
 
 private:
-  uint8_t m_receiveBuffer[ndn::MAX_NDN_PACKET_SIZE];
-  size_t m_receiveBufferSize;
-  std::queue<Block> m_sendQueue;
+  std::array<uint8_t, RECEIVE_BUFFER_SIZE> m_receiveBuffer;
+  size_t m_receiveBufferStart; ///< offset of the first unparsed byte
+  size_t m_receiveBufferSize;  ///< offset past the last received byte
+  std::deque<Transport::Packet> m_sendQueue;
   size_t m_sendQueueBytes;
+  size_t m_nSendsInFlight; ///< number of packets at the front of m_sendQueue being written
 };
 
+template<class T>
+constexpr size_t StreamTransport<T>::MAX_SEND_BUFFERS;
+
+template<class T>
+constexpr size_t StreamTransport<T>::RECEIVE_BUFFER_SIZE;
+
 
 template<class T>
 StreamTransport<T>::StreamTransport(typename StreamTransport::protocol::socket&& socket)
   : m_socket(std::move(socket))
+  , m_receiveBufferStart(0)
   , m_receiveBufferSize(0)
   , m_sendQueueBytes(0)
+  , m_nSendsInFlight(0)
 {
   // No queue capacity is set because there is no theoretical limit to the size of m_sendQueue.
   // Therefore, protecting against send queue overflows is less critical than in other transport
@@ -178,6 +206,13 @@ StreamTransport<T>::deferredClose()
   this->setState(TransportState::CLOSED);
 }
 
+template<class T>
+bool
+StreamTransport<T>::canSendSeparateHeader() const
+{
+  return true;
+}
+
 template<class T>
 void
 StreamTransport<T>::doSend(Transport::Packet&& packet)
@@ -187,11 +222,11 @@ StreamTransport<T>::doSend(Transport::Packet&& packet)
   if (getState() != TransportState::UP)
     return;
 
-  bool wasQueueEmpty = m_sendQueue.empty();
-  m_sendQueue.push(packet.packet);
-  m_sendQueueBytes += packet.packet.size();
+  m_sendQueueBytes += packet.size();
+  m_sendQueue.push_back(std::move(packet));
 
-  if (wasQueueEmpty)
+  // packets queued while a write is in progress are picked up by the next gather write
+  if (m_nSendsInFlight == 0)
     sendFromQueue();
 }
 
@@ -199,7 +234,21 @@ template<class T>
 void
 StreamTransport<T>::sendFromQueue()
 {
-  boost::asio::async_write(m_socket, boost::asio::buffer(m_sendQueue.front()),
+  BOOST_ASSERT(m_nSendsInFlight == 0);
+  BOOST_ASSERT(!m_sendQueue.empty());
+
+  m_nSendsInFlight = std::min(m_sendQueue.size(), MAX_SEND_BUFFERS);
+  std::vector<boost::asio::const_buffer> buffers;
+  buffers.reserve(2 * m_nSendsInFlight);
+  for (size_t i = 0; i < m_nSendsInFlight; ++i) {
+    const Transport::Packet& packet = m_sendQueue[i];
+    if (packet.header != nullptr) {
+      buffers.emplace_back(packet.header->data(), packet.header->size());
+    }
+    buffers.emplace_back(packet.packet.wire(), packet.packet.size());
+  }
+
+  boost::asio::async_write(m_socket, buffers,
                            [this] (auto&&... args) { this->handleSend(std::forward<decltype(args)>(args)...); });
 }
 
@@ -213,10 +262,14 @@ StreamTransport<T>::handleSend(const boost::system::error_code& error,
 
   NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
 
-  BOOST_ASSERT(!m_sendQueue.empty());
-  BOOST_ASSERT(m_sendQueue.front().size() == nBytesSent);
-  m_sendQueueBytes -= nBytesSent;
-  m_sendQueue.pop();
+  BOOST_ASSERT(m_nSendsInFlight > 0 && m_nSendsInFlight <= m_sendQueue.size());
+  size_t nBytesDequeued = 0;
+  for (; m_nSendsInFlight > 0; --m_nSendsInFlight) {
+    nBytesDequeued += m_sendQueue.front().size();
+    m_sendQueue.pop_front();
+  }
+  BOOST_ASSERT(nBytesDequeued == nBytesSent);
+  m_sendQueueBytes -= nBytesDequeued;
 
   if (!m_sendQueue.empty())
     sendFromQueue();
@@ -228,8 +281,8 @@ StreamTransport<T>::startReceive()
 {
   BOOST_ASSERT(getState() == TransportState::UP);
 
-  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer + m_receiveBufferSize,
-                                             ndn::MAX_NDN_PACKET_SIZE - m_receiveBufferSize),
+  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer.data() + m_receiveBufferSize,
+                                             m_receiveBuffer.size() - m_receiveBufferSize),
                          [this] (auto&&... args) { this->handleReceive(std::forward<decltype(args)>(args)...); });
 }
 
@@ -244,35 +297,36 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
   NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes");
 
   m_receiveBufferSize += nBytesReceived;
-  size_t offset = 0;
   bool isOk = true;
-  while (m_receiveBufferSize - offset > 0) {
+  while (m_receiveBufferSize - m_receiveBufferStart > 0) {
     Block element;
-    std::tie(isOk, element) = Block::fromBuffer(m_receiveBuffer + offset, m_receiveBufferSize - offset);
-    if (!isOk)
+    std::tie(isOk, element) = Block::fromBuffer(m_receiveBuffer.data() + m_receiveBufferStart,
+                                                m_receiveBufferSize - m_receiveBufferStart);
+    if (!isOk || element.size() > ndn::MAX_NDN_PACKET_SIZE)
       break;
 
-    offset += element.size();
-    BOOST_ASSERT(offset <= m_receiveBufferSize);
+    m_receiveBufferStart += element.size();
+    BOOST_ASSERT(m_receiveBufferStart <= m_receiveBufferSize);
 
     this->receive(Transport::Packet(std::move(element)));
   }
 
-  if (!isOk && m_receiveBufferSize == ndn::MAX_NDN_PACKET_SIZE && offset == 0) {
+  if (m_receiveBufferSize - m_receiveBufferStart >= ndn::MAX_NDN_PACKET_SIZE) {
     NFD_LOG_FACE_ERROR("Failed to parse incoming packet or packet too large to process");
     this->setState(TransportState::FAILED);
     doClose();
     return;
   }
 
-  if (offset > 0) {
-    if (offset != m_receiveBufferSize) {
-      std::copy(m_receiveBuffer + offset, m_receiveBuffer + m_receiveBufferSize, m_receiveBuffer);
-      m_receiveBufferSize -= offset;
-    }
-    else {
-      m_receiveBufferSize = 0;
-    }
+  if (m_receiveBufferStart == m_receiveBufferSize) {
+    m_receiveBufferStart = m_receiveBufferSize = 0;
+  }
+  else if (m_receiveBuffer.size() - m_receiveBufferSize < ndn::MAX_NDN_PACKET_SIZE) {
+    // make room for at least one more maximum-sized packet
+    std::copy(m_receiveBuffer.begin() + m_receiveBufferStart,
+              m_receiveBuffer.begin() + m_receiveBufferSize, m_receiveBuffer.begin());
+    m_receiveBufferSize -= m_receiveBufferStart;
+    m_receiveBufferStart = 0;
   }
 
   startReceive();
@@ -313,6 +367,7 @@ template<class T>
 void
 StreamTransport<T>::resetReceiveBuffer()
 {
+  m_receiveBufferStart = 0;
   m_receiveBufferSize = 0;
 }
 
@@ -320,9 +375,10 @@ template<class T>
 void
 StreamTransport<T>::resetSendQueue()
 {
-  std::queue<Block> emptyQueue;
+  std::deque<Transport::Packet> emptyQueue;
   std::swap(emptyQueue, m_sendQueue);
   m_sendQueueBytes = 0;
+  m_nSendsInFlight = 0;
 }
 
 template<class T>
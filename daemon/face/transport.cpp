@@ -58,6 +58,26 @@ Transport::Packet::Packet(Block&& packet1)
 {
 }
 
+size_t
+Transport::Packet::size() const
+{
+  return header == nullptr ? packet.size() : header->size() + packet.size();
+}
+
+void
+Transport::Packet::join()
+{
+  if (header == nullptr) {
+    return;
+  }
+
+  auto buffer = make_shared<ndn::Buffer>(header->size() + packet.size());
+  auto it = std::copy(header->begin(), header->end(), buffer->begin());
+  std::copy(packet.begin(), packet.end(), it);
+  packet = Block(std::move(buffer));
+  header.reset();
+}
+
 Transport::Transport()
   : m_face(nullptr)
   , m_service(nullptr)
@@ -100,7 +120,7 @@ void
 Transport::send(Packet&& packet)
 {
   BOOST_ASSERT(this->getMtu() == MTU_UNLIMITED ||
-               packet.packet.size() <= static_cast<size_t>(this->getMtu()));
+               packet.size() <= static_cast<size_t>(this->getMtu()));
 
   TransportState state = this->getState();
   if (state != TransportState::UP && state != TransportState::DOWN) {
@@ -110,9 +130,12 @@ Transport::send(Packet&& packet)
 
   if (state == TransportState::UP) {
     ++this->nOutPackets;
-    this->nOutBytes += packet.packet.size();
+    this->nOutBytes += packet.size();
   }
 
+  if (!this->canSendSeparateHeader()) {
+    packet.join();
+  }
   this->doSend(std::move(packet));
 }
 
@@ -122,7 +145,7 @@ void
 Transport::sendX(Packet&& packet)
 {
   BOOST_ASSERT(this->getMtu() == MTU_UNLIMITED ||
-               packet.packet.size() <= static_cast<size_t>(this->getMtu()));
+               packet.size() <= static_cast<size_t>(this->getMtu()));
 
   TransportState state = this->getState();
   if (state != TransportState::UP && state != TransportState::DOWN) {
@@ -132,9 +155,12 @@ Transport::sendX(Packet&& packet)
 
   if (state == TransportState::UP) {
     ++this->nOutPackets;
-    this->nOutBytes += packet.packet.size();
+    this->nOutBytes += packet.size();
   }
 
+  if (!this->canSendSeparateHeader()) {
+    packet.join();
+  }
   this->doSendX(std::move(packet));
 }
 
@@ -150,7 +176,7 @@ void
 Transport::receive(Packet&& packet)
 {
   BOOST_ASSERT(this->getMtu() == MTU_UNLIMITED ||
-               packet.packet.size() <= static_cast<size_t>(this->getMtu()));
+               packet.size() <= static_cast<size_t>(this->getMtu()));
 
   ++this->nInPackets;
   this->nInBytes += packet.packet.size();
@@ -174,6 +200,12 @@ Transport::canChangePersistencyTo(ndn::nfd::FacePersistency newPersistency) cons
   return this->canChangePersistencyToImpl(newPersistency);
 }
 
+bool
+Transport::canSendSeparateHeader() const
+{
+  return false;
+}
+
 bool
 Transport::canChangePersistencyToImpl(ndn::nfd::FacePersistency newPersistency) const
 {
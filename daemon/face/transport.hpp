@@ -127,11 +127,33 @@ public:
     explicit
     Packet(Block&& packet);
 
+    /** \return size of the packet on the wire, including \p header
+     */
+    size_t
+    size() const;
+
+    /** \brief copy \p header and \p packet into a single TLV block in \p packet
+     *
+     *  This has no effect if \p header is not set.
+     */
+    void
+    join();
+
   public:
     /** \brief the packet as a TLV block
+     *
+     *  If \p header is set, this is the network-layer packet carried in the LpPacket.
      */
     Block packet;
 
+    /** \brief LpPacket header that precedes \p packet on the wire, or nullptr
+     *
+     *  The header ends with the TLV-TYPE and TLV-LENGTH of the Fragment field, so that the header
+     *  followed by \p packet is a complete LpPacket. This allows a LinkService to send
+     *  a network-layer packet without copying it into an LpPacket.
+     */
+    ndn::ConstBufferPtr header;
+
     /** \brief identifies the remote endpoint
      *
      *  This ID is only meaningful in the context of the same Transport.
@@ -335,6 +357,14 @@ protected: // properties to be set by subclass
   setExpirationTime(const time::steady_clock::TimePoint& expirationTime);
 
 protected: // to be overridden by subclass
+  /** \return whether doSend accepts a packet whose header is set
+   *
+   *  If false, send() joins the header and the network-layer packet before invoking doSend.
+   *  Base class implementation returns false.
+   */
+  virtual bool
+  canSendSeparateHeader() const;
+
   /** \brief invoked by canChangePersistencyTo to perform the check
    *
    *  Base class implementation returns false.
@@ -28,6 +28,8 @@
 #include "unicast-udp-transport.hpp"
 #include "core/global-io.hpp"
 
+#include <cstring>
+
 namespace nfd {
 namespace face {
 
@@ -37,12 +39,18 @@ namespace ip = boost::asio::ip;
 
 UdpChannel::UdpChannel(const udp::Endpoint& localEndpoint,
                        time::nanoseconds idleTimeout,
-                       bool wantCongestionMarking)
+                       bool wantCongestionMarking,
+                       size_t ioBatchSize)
   : m_localEndpoint(localEndpoint)
   , m_socket(getGlobalIoService())
   , m_idleFaceTimeout(idleTimeout)
   , m_wantCongestionMarking(wantCongestionMarking)
+  , m_ioBatchSize(std::max<size_t>(ioBatchSize, 1))
 {
+  if (m_ioBatchSize > 1) {
+    m_receiveBatch = make_unique<DatagramBatch>(m_ioBatchSize);
+  }
+
   setUri(FaceUri(m_localEndpoint));
   NFD_LOG_CHAN_INFO("Creating channel");
 }
@@ -93,6 +101,14 @@ void
 UdpChannel::waitForNewPeer(const FaceCreatedCallback& onFaceCreated,
                            const FaceCreationFailedCallback& onReceiveFailed)
 {
+  if (m_receiveBatch) {
+    m_socket.async_receive(boost::asio::null_buffers(),
+                           [=] (const boost::system::error_code& error, size_t) {
+                             this->handleNewPeerBatch(error, onFaceCreated, onReceiveFailed);
+                           });
+    return;
+  }
+
   m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_remoteEndpoint,
                               [=] (auto&&... args) {
                                 this->handleNewPeer(std::forward<decltype(args)>(args)..., onFaceCreated, onReceiveFailed);
@@ -114,20 +130,71 @@ UdpChannel::handleNewPeer(const boost::system::error_code& error,
     return;
   }
 
-  NFD_LOG_CHAN_TRACE("New peer " << m_remoteEndpoint);
+  if (!dispatchDatagram(m_remoteEndpoint, m_receiveBuffer.data(), nBytesReceived,
+                        onFaceCreated, onReceiveFailed))
+    return;
+
+  waitForNewPeer(onFaceCreated, onReceiveFailed);
+}
+
+void
+UdpChannel::handleNewPeerBatch(const boost::system::error_code& error,
+                               const FaceCreatedCallback& onFaceCreated,
+                               const FaceCreationFailedCallback& onReceiveFailed)
+{
+  boost::system::error_code receiveError = error;
+  ssize_t nReceived = 0;
+  if (!receiveError) {
+    nReceived = m_receiveBatch->receive(m_socket.native_handle());
+    if (nReceived < 0)
+      receiveError.assign(errno, boost::system::system_category());
+  }
+
+  if (receiveError) {
+    if (receiveError != boost::asio::error::operation_aborted) {
+      NFD_LOG_CHAN_DEBUG("Receive failed: " << receiveError.message());
+      if (onReceiveFailed)
+        onReceiveFailed(500, "Receive failed: " + receiveError.message());
+    }
+    return;
+  }
+
+  for (ssize_t i = 0; i < nReceived; ++i) {
+    socklen_t senderSize = m_receiveBatch->getSenderSize(i);
+    if (senderSize == 0 || senderSize > m_remoteEndpoint.capacity()) {
+      continue;
+    }
+    m_remoteEndpoint.resize(senderSize);
+    std::memcpy(m_remoteEndpoint.data(), m_receiveBatch->getSender(i), senderSize);
+
+    if (!dispatchDatagram(m_remoteEndpoint, m_receiveBatch->getPayload(i),
+                          m_receiveBatch->getPayloadSize(i), onFaceCreated, onReceiveFailed))
+      return;
+  }
+
+  waitForNewPeer(onFaceCreated, onReceiveFailed);
+}
+
+bool
+UdpChannel::dispatchDatagram(const udp::Endpoint& remoteEndpoint,
+                             const uint8_t* buffer, size_t nBytesReceived,
+                             const FaceCreatedCallback& onFaceCreated,
+                             const FaceCreationFailedCallback& onReceiveFailed)
+{
+  NFD_LOG_CHAN_TRACE("New peer " << remoteEndpoint);
 
   bool isCreated = false;
   shared_ptr<Face> face;
   try {
     FaceParams params;
     params.persistency = ndn::nfd::FACE_PERSISTENCY_ON_DEMAND;
-    std::tie(isCreated, face) = createFace(m_remoteEndpoint, params);
+    std::tie(isCreated, face) = createFace(remoteEndpoint, params);
   }
   catch (const boost::system::system_error& e) {
-    NFD_LOG_CHAN_DEBUG("Face creation for " << m_remoteEndpoint << " failed: " << e.what());
+    NFD_LOG_CHAN_DEBUG("Face creation for " << remoteEndpoint << " failed: " << e.what());
     if (onReceiveFailed)
       onReceiveFailed(504, "Face creation failed: "s + e.what());
-    return;
+    return false;
   }
 
   if (isCreated)
@@ -137,9 +204,8 @@ UdpChannel::handleNewPeer(const boost::system::error_code& error,
 
   // dispatch the datagram to the face for processing
   auto* transport = static_cast<UnicastUdpTransport*>(face->getTransport());
-  transport->receiveDatagram(m_receiveBuffer.data(), nBytesReceived, error);
-
-  waitForNewPeer(onFaceCreated, onReceiveFailed);
+  transport->receiveDatagram(buffer, nBytesReceived, {});
+  return true;
 }
 
 std::pair<bool, shared_ptr<Face>>
@@ -181,7 +247,7 @@ UdpChannel::createFace(const udp::Endpoint& remoteEndpoint,
 
   auto linkService = make_unique<GenericLinkService>(options);
   auto transport = make_unique<UnicastUdpTransport>(std::move(socket), params.persistency,
-                                                    m_idleFaceTimeout, params.mtu);
+                                                    m_idleFaceTimeout, params.mtu, m_ioBatchSize);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_channelFaces[remoteEndpoint] = face;
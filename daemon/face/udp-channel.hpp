@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FACE_UDP_CHANNEL_HPP
 
 #include "channel.hpp"
+#include "datagram-batch.hpp"
 #include "udp-protocol.hpp"
 
 #include <array>
@@ -46,10 +47,13 @@ public:
    * To enable creation of faces upon incoming connections,
    * one needs to explicitly call UdpChannel::listen method.
    * The created socket is bound to \p localEndpoint.
+   * If \p ioBatchSize is greater than 1, the channel and its faces receive and send
+   * datagrams in batches of up to that many datagrams per system call.
    */
   UdpChannel(const udp::Endpoint& localEndpoint,
              time::nanoseconds idleTimeout,
-             bool wantCongestionMarking);
+             bool wantCongestionMarking,
+             size_t ioBatchSize = 1);
 
   bool
   isListening() const override
@@ -102,6 +106,24 @@ private:
                 const FaceCreatedCallback& onFaceCreated,
                 const FaceCreationFailedCallback& onReceiveFailed);
 
+  /**
+   * \brief The channel socket has become readable in batched mode
+   */
+  void
+  handleNewPeerBatch(const boost::system::error_code& error,
+                     const FaceCreatedCallback& onFaceCreated,
+                     const FaceCreationFailedCallback& onReceiveFailed);
+
+  /**
+   * \brief Dispatch a datagram from \p remoteEndpoint to its face, creating the face if needed
+   * \return false if face creation failed
+   */
+  bool
+  dispatchDatagram(const udp::Endpoint& remoteEndpoint,
+                   const uint8_t* buffer, size_t nBytesReceived,
+                   const FaceCreatedCallback& onFaceCreated,
+                   const FaceCreationFailedCallback& onReceiveFailed);
+
   std::pair<bool, shared_ptr<Face>>
   createFace(const udp::Endpoint& remoteEndpoint,
              const FaceParams& params);
@@ -114,6 +136,8 @@ private:
   std::map<udp::Endpoint, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
   bool m_wantCongestionMarking;
+  const size_t m_ioBatchSize;
+  unique_ptr<DatagramBatch> m_receiveBatch; ///< used only if m_ioBatchSize > 1
 };
 
 } // namespace face
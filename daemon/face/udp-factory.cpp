@@ -40,6 +40,8 @@ namespace net = ndn::net;
 NFD_LOG_INIT(UdpFactory);
 NFD_REGISTER_PROTOCOL_FACTORY(UdpFactory);
 
+constexpr uint32_t UdpFactory::MAX_IO_BATCH_SIZE;
+
 const std::string&
 UdpFactory::getId() noexcept
 {
@@ -66,6 +68,7 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   //   enable_v4 yes
   //   enable_v6 yes
   //   idle_timeout 600
+  //   io_batch_size 1
   //   mcast yes
   //   mcast_group 224.0.23.170
   //   mcast_port 56363
@@ -88,6 +91,7 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   bool enableV4 = false;
   bool enableV6 = false;
   uint32_t idleTimeout = 600;
+  uint32_t ioBatchSize = 1;
   MulticastConfig mcastConfig;
 
   if (configSection) {
@@ -113,6 +117,13 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
       else if (key == "idle_timeout") {
         idleTimeout = ConfigFile::parseNumber<uint32_t>(pair, "face_system.udp");
       }
+      else if (key == "io_batch_size") {
+        ioBatchSize = ConfigFile::parseNumber<uint32_t>(pair, "face_system.udp");
+        if (ioBatchSize < 1 || ioBatchSize > MAX_IO_BATCH_SIZE) {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("face_system.udp.io_batch_size must be between 1 and " +
+                                                  to_string(MAX_IO_BATCH_SIZE)));
+        }
+      }
       else if (key == "keep_alive_interval") {
         // ignored
       }
@@ -177,6 +188,8 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
     return;
   }
 
+  m_ioBatchSize = ioBatchSize;
+
   if (enableV4) {
     udp::Endpoint endpoint(ip::udp::v4(), port);
     shared_ptr<UdpChannel> v4Channel = this->createChannel(endpoint, time::seconds(idleTimeout));
@@ -303,7 +316,8 @@ UdpFactory::createChannel(const udp::Endpoint& localEndpoint,
                                 ", endpoint already allocated for a UDP multicast face"));
   }
 
-  auto channel = std::make_shared<UdpChannel>(localEndpoint, idleTimeout, m_wantCongestionMarking);
+  auto channel = std::make_shared<UdpChannel>(localEndpoint, idleTimeout, m_wantCongestionMarking,
+                                              m_ioBatchSize);
   m_channels[localEndpoint] = channel;
   return channel;
 }
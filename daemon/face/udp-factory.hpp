@@ -121,8 +121,13 @@ private:
   void
   applyMcastConfig(const FaceSystem::ConfigContext& context);
 
+public:
+  /// upper bound of face_system.udp.io_batch_size
+  static constexpr uint32_t MAX_IO_BATCH_SIZE = 1024;
+
 private:
   bool m_wantCongestionMarking = false;
+  size_t m_ioBatchSize = 1; ///< datagrams per system call on unicast UDP faces
   std::map<udp::Endpoint, shared_ptr<UdpChannel>> m_channels;
 
   struct MulticastConfig
@@ -36,8 +36,9 @@ UnicastEthernetTransport::UnicastEthernetTransport(const ndn::net::NetworkInterf
                                                    const ethernet::Address& remoteEndpoint,
                                                    ndn::nfd::FacePersistency persistency,
                                                    time::nanoseconds idleTimeout,
-                                                   optional<ssize_t> overrideMtu)
-  : EthernetTransport(localEndpoint, remoteEndpoint)
+                                                   optional<ssize_t> overrideMtu,
+                                                   const EthernetPacketRing::Options& ringOptions)
+  : EthernetTransport(localEndpoint, remoteEndpoint, ringOptions)
   , m_idleTimeout(idleTimeout)
 {
   this->setLocalUri(FaceUri::fromDev(m_interfaceName));
@@ -65,7 +66,7 @@ UnicastEthernetTransport::UnicastEthernetTransport(const ndn::net::NetworkInterf
            ethernet::ETHERTYPE_NDN,
            m_destAddress.toString().data(),
            m_srcAddress.toString().data());
-  m_pcap.setPacketFilter(filter);
+  setPacketFilter(filter);
 
   if (getPersistency() == ndn::nfd::FACE_PERSISTENCY_ON_DEMAND &&
       m_idleTimeout > time::nanoseconds::zero()) {
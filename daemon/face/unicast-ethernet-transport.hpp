@@ -45,7 +45,8 @@ public:
                            const ethernet::Address& remoteEndpoint,
                            ndn::nfd::FacePersistency persistency,
                            time::nanoseconds idleTimeout,
-                           optional<ssize_t> overrideMtu = {});
+                           optional<ssize_t> overrideMtu = {},
+                           const EthernetPacketRing::Options& ringOptions = {});
 
 protected:
   bool
@@ -41,8 +41,9 @@ NFD_LOG_MEMBER_INIT_SPECIALIZED((DatagramTransport<boost::asio::ip::udp, Unicast
 UnicastUdpTransport::UnicastUdpTransport(protocol::socket&& socket,
                                          ndn::nfd::FacePersistency persistency,
                                          time::nanoseconds idleTimeout,
-                                         optional<ssize_t> overrideMtu)
-  : DatagramTransport(std::move(socket))
+                                         optional<ssize_t> overrideMtu,
+                                         size_t ioBatchSize)
+  : DatagramTransport(std::move(socket), ioBatchSize)
   , m_idleTimeout(idleTimeout)
 {
   this->setLocalUri(FaceUri(m_socket.local_endpoint()));
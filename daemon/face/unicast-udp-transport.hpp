@@ -43,7 +43,8 @@ public:
   UnicastUdpTransport(protocol::socket&& socket,
                       ndn::nfd::FacePersistency persistency,
                       time::nanoseconds idleTimeout,
-                      optional<ssize_t> overrideMtu = {});
+                      optional<ssize_t> overrideMtu = {},
+                      size_t ioBatchSize = 1);
 
 protected:
   bool
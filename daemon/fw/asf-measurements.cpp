@@ -141,8 +141,9 @@ FaceInfo::recordTimeout(const Name& interestName)
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
-NamespaceInfo::NamespaceInfo()
-  : m_isProbingDue(false)
+NamespaceInfo::NamespaceInfo(ExecutionContext& context)
+  : m_context(context)
+  , m_isProbingDue(false)
   , m_hasFirstProbeBeenScheduled(false)
 {
 }
@@ -193,7 +194,7 @@ NamespaceInfo::extendFaceInfoLifetime(FaceInfo& info, FaceId faceId)
   scheduler::cancel(info.getMeasurementExpirationEventId());
 
   // Refresh measurement
-  auto id = scheduler::schedule(AsfMeasurements::MEASUREMENTS_LIFETIME, [=] { expireFaceInfo(faceId); });
+  auto id = m_context.schedule(AsfMeasurements::MEASUREMENTS_LIFETIME, [=] { expireFaceInfo(faceId); });
   info.setMeasurementExpirationEventId(id);
 }
 
@@ -202,8 +203,9 @@ NamespaceInfo::extendFaceInfoLifetime(FaceInfo& info, FaceId faceId)
 
 constexpr time::microseconds AsfMeasurements::MEASUREMENTS_LIFETIME;
 
-AsfMeasurements::AsfMeasurements(MeasurementsAccessor& measurements)
+AsfMeasurements::AsfMeasurements(MeasurementsAccessor& measurements, ExecutionContext& context)
   : m_measurements(measurements)
+  , m_context(context)
 {
 }
 
@@ -233,7 +235,7 @@ AsfMeasurements::getNamespaceInfo(const Name& prefix)
   // Set or update entry lifetime
   extendLifetime(*me);
 
-  NamespaceInfo* info = me->insertStrategyInfo<NamespaceInfo>().first;
+  NamespaceInfo* info = me->insertStrategyInfo<NamespaceInfo>(m_context).first;
   BOOST_ASSERT(info != nullptr);
   return info;
 }
@@ -256,7 +258,7 @@ AsfMeasurements::getOrCreateNamespaceInfo(const fib::Entry& fibEntry, const Inte
   // Set or update entry lifetime
   extendLifetime(*me);
 
-  NamespaceInfo* info = me->insertStrategyInfo<NamespaceInfo>().first;
+  NamespaceInfo* info = me->insertStrategyInfo<NamespaceInfo>(m_context).first;
   BOOST_ASSERT(info != nullptr);
   return *info;
 }
@@ -26,6 +26,7 @@
 #ifndef NFD_DAEMON_FW_ASF_MEASUREMENTS_HPP
 #define NFD_DAEMON_FW_ASF_MEASUREMENTS_HPP
 
+#include "core/execution-context.hpp"
 #include "core/rtt-estimator.hpp"
 #include "fw/strategy-info.hpp"
 #include "table/measurements-accessor.hpp"
@@ -208,7 +209,8 @@ typedef std::unordered_map<FaceId, FaceInfo> FaceInfoTable;
 class NamespaceInfo : public StrategyInfo
 {
 public:
-  NamespaceInfo();
+  explicit
+  NamespaceInfo(ExecutionContext& context = getGlobalExecutionContext());
 
   static constexpr int
   getTypeId()
@@ -282,6 +284,7 @@ public:
   }
 
 private:
+  ExecutionContext& m_context;
   FaceInfoTable m_fit;
 
   bool m_isProbingDue;
@@ -297,7 +300,8 @@ class AsfMeasurements : noncopyable
 {
 public:
   explicit
-  AsfMeasurements(MeasurementsAccessor& measurements);
+  AsfMeasurements(MeasurementsAccessor& measurements,
+                  ExecutionContext& context = getGlobalExecutionContext());
 
   FaceInfo*
   getFaceInfo(const fib::Entry& fibEntry, const Interest& interest, FaceId faceId);
@@ -320,6 +324,7 @@ public:
 
 private:
   MeasurementsAccessor& m_measurements;
+  ExecutionContext& m_context;
 };
 
 } // namespace asf
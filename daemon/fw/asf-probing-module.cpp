@@ -24,7 +24,6 @@
  */
 
 #include "asf-probing-module.hpp"
-#include "core/random.hpp"
 #include "algorithm.hpp"
 
 namespace nfd {
@@ -37,9 +36,10 @@ constexpr time::milliseconds ProbingModule::MIN_PROBING_INTERVAL;
 static_assert(ProbingModule::DEFAULT_PROBING_INTERVAL < AsfMeasurements::MEASUREMENTS_LIFETIME,
               "ProbingModule::DEFAULT_PROBING_INTERVAL must be less than AsfMeasurements::MEASUREMENTS_LIFETIME");
 
-ProbingModule::ProbingModule(AsfMeasurements& measurements)
+ProbingModule::ProbingModule(AsfMeasurements& measurements, ExecutionContext& context)
   : m_probingInterval(DEFAULT_PROBING_INTERVAL)
   , m_measurements(measurements)
+  , m_context(context)
 {
 }
 
@@ -49,7 +49,7 @@ ProbingModule::scheduleProbe(const fib::Entry& fibEntry, const time::millisecond
   Name prefix = fibEntry.getPrefix();
 
   // Set the probing flag for the namespace to true after passed interval of time
-  scheduler::schedule(interval, [this, prefix] {
+  m_context.schedule(interval, [this, prefix] {
     NamespaceInfo* info = m_measurements.getNamespaceInfo(prefix);
 
     if (info == nullptr) {
@@ -186,7 +186,7 @@ double
 ProbingModule::getRandomNumber(double start, double end)
 {
   std::uniform_real_distribution<double> dist(start, end);
-  return dist(getGlobalRng());
+  return dist(m_context.getRng());
 }
 
 void
@@ -37,8 +37,7 @@ namespace asf {
 class ProbingModule
 {
 public:
-  explicit
-  ProbingModule(AsfMeasurements& measurements);
+  ProbingModule(AsfMeasurements& measurements, ExecutionContext& context);
 
   void
   scheduleProbe(const fib::Entry& fibEntry, const time::milliseconds& interval);
@@ -86,6 +85,7 @@ public:
 private:
   time::milliseconds m_probingInterval;
   AsfMeasurements& m_measurements;
+  ExecutionContext& m_context;
 };
 
 } // namespace asf
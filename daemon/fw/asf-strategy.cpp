@@ -39,8 +39,8 @@ const time::milliseconds AsfStrategy::RETX_SUPPRESSION_MAX(250);
 
 AsfStrategy::AsfStrategy(Forwarder& forwarder, const Name& name)
   : Strategy(forwarder)
-  , m_measurements(getMeasurements())
-  , m_probing(m_measurements)
+  , m_measurements(getMeasurements(), getExecutionContext())
+  , m_probing(m_measurements, getExecutionContext())
   , m_maxSilentTimeouts(0)
   , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
                       RetxSuppressionExponential::DEFAULT_MULTIPLIER,
@@ -225,7 +225,7 @@ AsfStrategy::forwardInterest(const Interest& interest,
                                             << " FaceId: " << outFace.getId()
                                             << " in " << time::duration_cast<time::milliseconds>(timeout) << " ms");
 
-    scheduler::EventId id = scheduler::schedule(timeout,
+    scheduler::EventId id = this->getExecutionContext().schedule(timeout,
         bind(&AsfStrategy::onTimeout, this, interest.getName(), outFace.getId()));
 
     faceInfo.setTimeoutEvent(id, interest.getName());
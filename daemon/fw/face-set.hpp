@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_FACE_SET_HPP
+#define NFD_DAEMON_FW_FACE_SET_HPP
+
+#include "face/face.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <boost/container/small_vector.hpp>
+
+namespace nfd {
+namespace fw {
+
+/** \brief an insertion-ordered set of faces that does not allocate in the common case
+ *
+ *  Faces are deduplicated through a FaceId bitmap: a clear bit proves that the face is not
+ *  in the set, and only a set bit (which may be a collision of two FaceIds) requires a scan
+ *  of the stored faces. Up to \p N faces are stored inline.
+ *
+ *  This type is intended as a stack-resident replacement of `std::set<Face*>` when collecting
+ *  pending downstreams in the Data pipelines.
+ */
+template<size_t N = 16>
+class FaceSet
+{
+public:
+  using const_iterator = typename boost::container::small_vector<Face*, N>::const_iterator;
+
+  /** \brief inserts a face
+   *  \return true if the face was inserted, false if it was already in the set
+   */
+  bool
+  insert(Face& face)
+  {
+    size_t bit = static_cast<size_t>(face.getId()) % BITMAP_SIZE;
+    if (m_bitmap.test(bit) &&
+        std::find(m_faces.begin(), m_faces.end(), &face) != m_faces.end()) {
+      return false;
+    }
+    m_bitmap.set(bit);
+    m_faces.push_back(&face);
+    return true;
+  }
+
+  size_t
+  size() const
+  {
+    return m_faces.size();
+  }
+
+  bool
+  empty() const
+  {
+    return m_faces.empty();
+  }
+
+  const_iterator
+  begin() const
+  {
+    return m_faces.begin();
+  }
+
+  const_iterator
+  end() const
+  {
+    return m_faces.end();
+  }
+
+private:
+  static constexpr size_t BITMAP_SIZE = 256;
+
+  std::bitset<BITMAP_SIZE> m_bitmap;
+  boost::container::small_vector<Face*, N> m_faces;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_FACE_SET_HPP
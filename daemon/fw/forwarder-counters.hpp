@@ -46,6 +46,8 @@ public:
 
   PacketCounter nCsHits;
   PacketCounter nCsMisses;
+
+  PacketCounter nPitQuotaExceeded; ///< Interests Nacked because PIT quota was exceeded
 };
 
 } // namespace nfd
@@ -27,6 +27,7 @@
 
 #include "algorithm.hpp"
 #include "best-route-strategy2.hpp"
+#include "face-set.hpp"
 #include "strategy.hpp"
 #include "core/logger.hpp"
 #include "table/cleanup.hpp"
@@ -39,6 +40,20 @@ namespace nfd {
 
 NFD_LOG_INIT(Forwarder);
 
+/** \brief records a pipeline event if packet trace is enabled
+ *  \sa Forwarder::enablePacketTrace
+ */
+#ifdef WITH_PACKET_TRACE
+#define NFD_FW_TRACE(event, ...) \
+  do { \
+    if (m_tracer != nullptr) { \
+      m_tracer->record(trace::Event::event, __VA_ARGS__); \
+    } \
+  } while (false)
+#else
+#define NFD_FW_TRACE(event, ...) do {} while (false)
+#endif // WITH_PACKET_TRACE
+
 static Name
 getDefaultStrategyName()
 {
@@ -46,16 +61,27 @@ getDefaultStrategyName()
 }
 
 Forwarder::Forwarder()
-  : m_unsolicitedDataPolicy(new fw::DefaultUnsolicitedDataPolicy())
+  : Forwarder(make_unique<ExecutionContext>())
+{
+}
+
+Forwarder::Forwarder(unique_ptr<ExecutionContext> context)
+  : m_context(std::move(context))
+  , m_dataNonceList(DeadNonceList::DEFAULT_LIFETIME, *m_context)
+  , m_unsolicitedDataPolicy(new fw::DefaultUnsolicitedDataPolicy())
   , m_fib(m_nameTree)
   , m_pit(m_nameTree)
-  , m_measurements(m_nameTree)
+  , m_measurements(m_nameTree, *m_context)
   , m_strategyChoice(*this)
+  , m_deadNonceList(DeadNonceList::DEFAULT_LIFETIME, *m_context)
   , m_csFace(face::makeNullFace(FaceUri("contentstore://")))
 {
+  BOOST_ASSERT(m_context != nullptr);
+  m_cs.setExecutionContext(*m_context);
   getFaceTable().addReserved(m_csFace, face::FACEID_CONTENT_STORE);
 
   m_faceTable.afterAdd.connect([this] (Face& face) {
+    face.getLinkService()->setExecutionContext(*m_context);
     face.afterReceiveInterest.connect(
       [this, &face] (const Interest& interest) {
         this->startProcessInterest(face, interest);
@@ -95,6 +121,7 @@ void Forwarder::onRandomWaitLoopInterest(Face& inFace, const Interest& interest)
 
   if (pitEntry != nullptr && !pitEntry->isExpiredToSendInterest()) {
     NFD_LOG_DEBUG("Cancel the scheduled Interest transmission!");
+    NFD_FW_TRACE(RELAY_INTEREST_CANCELED, inFace.getId(), interest.getName(), interest.getNonce());
     scheduler::cancel(pitEntry->relayTimerForInterest);
   }
   // else if (!pitEntry->isExpiredRtxInterest()) {  // if re-tx not expired, cancel it.
@@ -118,6 +145,7 @@ void Forwarder::onDataEmergency(Face& inFace, const Data& data)
 {
   NFD_LOG_INFO("onDataEmergency: " << data.getName() <<
                 " Nonce: " << data.getNonce());
+  NFD_FW_TRACE(EMERGENCY_DATA, inFace.getId(), data.getName(), data.getNonce());
 
   // detect duplicate Nonce
   bool bDuplicate = m_dataNonceList.has(data.getName(),
@@ -163,6 +191,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
                 interest.getNonce()); // add nonce. Jiangtao Luo
   interest.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
   ++m_counters.nInInterests;
+  NFD_FW_TRACE(INCOMING_INTEREST, inFace.getId(), interest.getName(), interest.getNonce());
 
 
 
@@ -193,7 +222,15 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
   }
 
   // PIT insert
-  shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest).first;
+  auto pitInsertResult = m_pit.insert(interest, inFace.getId());
+  shared_ptr<pit::Entry> pitEntry = pitInsertResult.first;
+  if (pitEntry == nullptr) {
+    // goto PIT quota exceeded pipeline
+    this->onPitQuotaExceeded(inFace, interest);
+    return;
+  }
+  NFD_FW_TRACE(PIT_INSERT, inFace.getId(), interest.getName(), interest.getNonce(),
+               pitInsertResult.second);
 
   // Jiangtao LUo. 14 Feb 2020
   NFD_LOG_DEBUG("PIT inserted for : " << pitEntry->getName());
@@ -234,10 +271,12 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
     // Jiangtao Luo. 23 Mar 2020
     if (!pitEntry->isExpiredToSendInterest()) {
       NFD_LOG_INFO("Cancel the scheduled Interest transmission (old nonce)!");
+      NFD_FW_TRACE(RELAY_INTEREST_CANCELED, inFace.getId(), interest.getName(), interest.getNonce());
       scheduler::cancel(pitEntry->relayTimerForInterest);
     }
    if (!pitEntry->isExpiredRtxInterest()) {  // if re-tx not expired, cancel it.
       NFD_LOG_INFO("Cancel the scheduled Interest re-transmission (old nonce)!)");
+      NFD_FW_TRACE(RETX_INTEREST_CANCELED, inFace.getId(), interest.getName(), interest.getNonce());
       
       pitEntry->retxCount = 0; // reset re-tx count
       scheduler::cancel(pitEntry->retxTimerForInterest);
@@ -250,6 +289,8 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
 void
 Forwarder::onInterestLoop(Face& inFace, const Interest& interest)
 {
+  NFD_FW_TRACE(INTEREST_LOOP, inFace.getId(), interest.getName(), interest.getNonce());
+
   // if multi-access or ad hoc face, drop
   if (inFace.getLinkType() != ndn::nfd::LINK_TYPE_POINT_TO_POINT) {
     // NFD_LOG_DEBUG("onInterestLoop face=" << inFace.getId() <<
@@ -281,6 +322,25 @@ Forwarder::onInterestLoop(Face& inFace, const Interest& interest)
   inFace.sendNack(nack);
 }
 
+void
+Forwarder::onPitQuotaExceeded(Face& inFace, const Interest& interest)
+{
+  ++m_counters.nPitQuotaExceeded;
+  NFD_FW_TRACE(PIT_QUOTA_EXCEEDED, inFace.getId(), interest.getName(), interest.getNonce());
+
+  NFD_LOG_DEBUG("onPitQuotaExceeded face=" << inFace.getId() <<
+                " interest=" << interest.getName() <<
+                " pit-size=" << m_pit.size() <<
+                " face-usage=" << m_pit.getFaceUsage(inFace.getId()) <<
+                " send-Nack-congestion");
+
+  // send Nack with reason=CONGESTION
+  // note: Don't enter outgoing Nack pipeline because it needs an in-record.
+  lp::Nack nack(interest);
+  nack.setReason(lp::NackReason::CONGESTION);
+  inFace.sendNack(nack);
+}
+
 static inline bool
 compare_InRecord_expiry(const pit::InRecord& a, const pit::InRecord& b)
 {
@@ -293,6 +353,7 @@ Forwarder::onContentStoreMiss(const Face& inFace, const shared_ptr<pit::Entry>&
 {
   NFD_LOG_DEBUG("onContentStoreMiss interest=" << interest.getName());
   ++m_counters.nCsMisses;
+  NFD_FW_TRACE(CS_MISS, inFace.getId(), interest.getName(), interest.getNonce());
 
   // insert in-record
   pitEntry->insertOrUpdateInRecord(const_cast<Face&>(inFace), interest);
@@ -326,7 +387,10 @@ Forwarder::onContentStoreHit(const Face& inFace, const shared_ptr<pit::Entry>& p
 {
   NFD_LOG_DEBUG("onContentStoreHit interest=" << interest.getName());
   ++m_counters.nCsHits;
+  NFD_FW_TRACE(CS_HIT, inFace.getId(), interest.getName(), interest.getNonce());
 
+  // cached Data keeps the tags it was received with; HopCount is restarted at this node
+  data.removeTag<lp::HopCountTag>();
   data.setTag(make_shared<lp::IncomingFaceIdTag>(face::FACEID_CONTENT_STORE));
   // XXX should we lookup PIT for other Interests that also match csMatch?
 
@@ -366,6 +430,7 @@ Forwarder::onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry, Face& outF
   // send Interest
   outFace.sendInterest(interest);
   ++m_counters.nOutInterests;
+  NFD_FW_TRACE(OUTGOING_INTEREST, outFace.getId(), interest.getName(), interest.getNonce());
 
   ////////////////////////////////////////////////////////////////
   // if random wait, start re-tx
@@ -414,9 +479,13 @@ Forwarder::onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry)
   // Increment satisfied/unsatisfied Interests counter
   if (pitEntry->isSatisfied) {
     ++m_counters.nSatisfiedInterests;
+    NFD_FW_TRACE(INTEREST_FINALIZE_SATISFIED, face::INVALID_FACEID,
+                 pitEntry->getName(), pitEntry->getInterest().getNonce());
   }
   else {
     ++m_counters.nUnsatisfiedInterests;
+    NFD_FW_TRACE(INTEREST_FINALIZE_UNSATISFIED, face::INVALID_FACEID,
+                 pitEntry->getName(), pitEntry->getInterest().getNonce());
   }
 
  ////////////////////////////////
@@ -426,10 +495,14 @@ Forwarder::onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry)
   
   if (!pitEntry->isExpiredToSendInterest()) {
     NFD_LOG_DEBUG("Cancel the scheduled Interest transmission!");
+    NFD_FW_TRACE(RELAY_INTEREST_CANCELED, face::INVALID_FACEID,
+                 pitEntry->getName(), pitEntry->getInterest().getNonce());
     scheduler::cancel(pitEntry->relayTimerForInterest);
   }
   if (!pitEntry->isExpiredRtxInterest()) {  // if re-tx not expired, cancel it.
     NFD_LOG_DEBUG("Cancel the scheduled Interest re-transmission!");
+    NFD_FW_TRACE(RETX_INTEREST_CANCELED, face::INVALID_FACEID,
+                 pitEntry->getName(), pitEntry->getInterest().getNonce());
 
     pitEntry->retxCount = 0; // reset re-tx count
     scheduler::cancel(pitEntry->retxTimerForInterest);
@@ -452,6 +525,7 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
     
   data.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
   ++m_counters.nInData;
+  NFD_FW_TRACE(INCOMING_DATA, inFace.getId(), data.getName(), data.getNonce());
 
   // /localhost scope control
   bool isViolatingLocalhost = inFace.getScope() == ndn::nfd::FACE_SCOPE_NON_LOCAL &&
@@ -485,14 +559,13 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
     return;
   }
 
-  shared_ptr<Data> dataCopyWithoutTag = make_shared<Data>(data);
-  dataCopyWithoutTag->removeTag<lp::HopCountTag>();
-
   // CS insert
+  // The received Data is stored as is, sharing its wire buffer; link-layer tags that
+  // must not be served from the cache are removed in onContentStoreHit.
   if (m_csFromNdnSim == nullptr)
-    m_cs.insert(*dataCopyWithoutTag);
+    m_cs.insert(data);
   else
-    m_csFromNdnSim->Add(dataCopyWithoutTag);
+    m_csFromNdnSim->Add(data.shared_from_this());
 
   // when only one PIT entry is matched, trigger strategy: after receive Data
   if (pitMatches.size() == 1) {
@@ -521,7 +594,7 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
   // when more than one PIT entry is matched, trigger strategy: before satisfy Interest,
   // and send Data to all matched out faces
   else {
-    std::set<Face*> pendingDownstreams;
+    fw::FaceSet<> pendingDownstreams;
     auto now = time::steady_clock::now();
 
     for (const shared_ptr<pit::Entry>& pitEntry : pitMatches) {
@@ -530,7 +603,7 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
       // remember pending downstreams
       for (const pit::InRecord& inRecord : pitEntry->getInRecords()) {
         if (inRecord.getExpiry() > now) {
-          pendingDownstreams.insert(&inRecord.getFace());
+          pendingDownstreams.insert(inRecord.getFace());
         }
       }
 
@@ -569,6 +642,8 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
 void
 Forwarder::onDataUnsolicited(Face& inFace, const Data& data)
 {
+  NFD_FW_TRACE(DATA_UNSOLICITED, inFace.getId(), data.getName(), data.getNonce());
+
   // accept to cache?
   fw::UnsolicitedDataDecision decision = m_unsolicitedDataPolicy->decide(inFace, data);
   if (decision == fw::UnsolicitedDataDecision::CACHE) {
@@ -624,6 +699,7 @@ Forwarder::onOutgoingData(const Data& data, Face& outFace)
   // send Data
   outFace.sendData(data);
   ++m_counters.nOutData;
+  NFD_FW_TRACE(OUTGOING_DATA, outFace.getId(), data.getName(), data.getNonce());
 }
 
 void
@@ -632,6 +708,8 @@ Forwarder::onIncomingNack(Face& inFace, const lp::Nack& nack)
   // receive Nack
   nack.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
   ++m_counters.nInNacks;
+  NFD_FW_TRACE(INCOMING_NACK, inFace.getId(), nack.getInterest().getName(),
+               nack.getInterest().getNonce(), static_cast<uint32_t>(nack.getReason()));
 
   // if multi-access or ad hoc face, drop
   if (inFace.getLinkType() != ndn::nfd::LINK_TYPE_POINT_TO_POINT) {
@@ -731,6 +809,8 @@ Forwarder::onOutgoingNack(const shared_ptr<pit::Entry>& pitEntry, const Face& ou
   // send Nack on face
   const_cast<Face&>(outFace).sendNack(nackPkt);
   ++m_counters.nOutNacks;
+  NFD_FW_TRACE(OUTGOING_NACK, outFace.getId(), nackPkt.getInterest().getName(),
+               nackPkt.getInterest().getNonce(), static_cast<uint32_t>(nack.getReason()));
 }
 
 void
@@ -747,7 +827,9 @@ Forwarder::setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::millisec
 
   scheduler::cancel(pitEntry->expiryTimer);
 
-  pitEntry->expiryTimer = scheduler::schedule(duration, [=] { onInterestFinalize(pitEntry); });
+  pitEntry->expiryTimer = m_context->schedule(duration, [=] { onInterestFinalize(pitEntry); });
+  NFD_FW_TRACE(PIT_EXPIRY_SET, face::INVALID_FACEID, pitEntry->getName(),
+               pitEntry->getInterest().getNonce(), static_cast<uint32_t>(duration.count()));
 }
 
 void
@@ -803,7 +885,7 @@ Forwarder::setRelayTimerForInterest(time::microseconds delay, FaceId outFaceId,
 
     NFD_LOG_DEBUG("Set relay for Interest=" << interest.getName() <<
                   "Nonce="<< interest.getNonce() << " after delay=" << delay);
-    pitEntry->relayTimerForInterest = scheduler::schedule(delay, [=]
+    pitEntry->relayTimerForInterest = m_context->schedule(delay, [=]
                                                          {
                                                            const Interest& interest = pitEntry->getInterest();
                                                            Face* outFace = getFace(outFaceId);
@@ -811,6 +893,8 @@ Forwarder::setRelayTimerForInterest(time::microseconds delay, FaceId outFaceId,
                                                            onOutgoingInterest(pitEntry, *outFace, interest);});
 
     pitEntry->expireTimeToRelayInterest = time::steady_clock::now() + delay;
+    NFD_FW_TRACE(RELAY_INTEREST_SCHEDULED, outFaceId, interest.getName(), interest.getNonce(),
+                 static_cast<uint32_t>(delay.count()));
   }
 }
   
@@ -837,11 +921,13 @@ Forwarder::setRetxTimerForInterest(time::milliseconds delay, FaceId outFaceId, c
   // pitEntry->retxTimerForInterest = scheduler::schedule(delay, [&, pitEntry]
   //                                                        { onOutgoingInterest(pitEntry, outFace, interest);});
      pitEntry->retxTimerForInterest =
-       scheduler::schedule(delay, [=] {  const Interest& interest = pitEntry->getInterest();
+       m_context->schedule(delay, [=] {  const Interest& interest = pitEntry->getInterest();
                                       Face* outFace = getFace(outFaceId);
                                       onOutgoingInterest(pitEntry, *outFace, interest);});
 
      pitEntry->expireTimeToRetxInterest = time::steady_clock::now() + delay;
+     NFD_FW_TRACE(RETX_INTEREST_SCHEDULED, outFaceId, interest.getName(), interest.getNonce(),
+                  static_cast<uint32_t>(time::duration_cast<time::microseconds>(delay).count()));
   }
   else {
     NFD_LOG_DEBUG("PIT entry expired!!!");
@@ -869,14 +955,17 @@ Forwarder::setRelayTimerForData(time::microseconds delay, FaceId outFaceId, cons
 
     scheduler::cancel(csEntry->relayTimerForData);
 
-    csEntry->relayTimerForData = scheduler::schedule(delay, [=] {
+    csEntry->relayTimerForData = m_context->schedule(delay, [=] {
     //csEntry->relayTimerForData = scheduler::schedule(delay, [=, &data] {
                                                               NFD_LOG_DEBUG("Scheduled relay data from " << this);
                                                               const Data& data2 = csEntry->getData();
+                                                              data2.removeTag<lp::HopCountTag>();
                                                               Face* outFace = getFace(outFaceId);
                                                               this->onOutgoingData(data2, *outFace);});
 
     csEntry->expireTimeToRelayData =  time::steady_clock::now() + delay;
+    NFD_FW_TRACE(RELAY_DATA_SCHEDULED, outFaceId, data.getName(), data.getNonce(),
+                 static_cast<uint32_t>(delay.count()));
   }
 
 }
@@ -885,6 +974,7 @@ void Forwarder::onRandomWaitDataUnsolicited(Face& inFace, const Data& data)
 {
   cs::Entry *csEntry = m_cs.findEntry(data.getName());
   if (csEntry != nullptr) {
+    NFD_FW_TRACE(RELAY_DATA_CANCELED, inFace.getId(), data.getName(), data.getNonce());
     scheduler::cancel(csEntry->relayTimerForData);
   }
   
@@ -27,6 +27,8 @@
 #define NFD_DAEMON_FW_FORWARDER_HPP
 
 #include "core/common.hpp"
+#include "core/execution-context.hpp"
+#include "core/packet-trace.hpp"
 #include "core/scheduler.hpp"
 #include "forwarder-counters.hpp"
 #include "face-table.hpp"
@@ -54,8 +56,21 @@ class Strategy;
 class Forwarder
 {
 public:
+  /** \brief construct a Forwarder with a default execution context
+   *
+   *  The context delegates to the thread-wide scheduler and RNG, see ExecutionContext().
+   */
   Forwarder();
 
+  /** \brief construct a Forwarder with its own execution context
+   *
+   *  The context is shared by all tables, strategies, and link services of this Forwarder.
+   *  In a simulation with many nodes, each node should have a context with a distinct seed,
+   *  so that random decisions are independent across nodes and reproducible across runs.
+   */
+  explicit
+  Forwarder(unique_ptr<ExecutionContext> context);
+
   VIRTUAL_WITH_TESTS
   ~Forwarder();
 
@@ -65,6 +80,12 @@ public:
     return m_counters;
   }
 
+  ExecutionContext&
+  getExecutionContext() const
+  {
+    return *m_context;
+  }
+
 public: // faces and policies
   FaceTable&
   getFaceTable()
@@ -191,6 +212,28 @@ public: // allow enabling ndnSIM content store (will be removed in the future)
     m_csFromNdnSim = cs;
   }
 
+#ifdef WITH_PACKET_TRACE
+public: // packet trace
+  /** \brief start recording pipeline events into a binary trace file
+   *  \throw trace::PacketTracer::Error the trace file cannot be opened
+   *  \sa tools/nfd-trace-decode.cpp
+   */
+  void
+  enablePacketTrace(const std::string& filename,
+                    size_t capacity = trace::PacketTracer::DEFAULT_CAPACITY)
+  {
+    m_tracer = make_unique<trace::PacketTracer>(filename, capacity);
+  }
+
+  /** \return the packet tracer, or nullptr if packet trace is not enabled
+   */
+  trace::PacketTracer*
+  getPacketTracer() const
+  {
+    return m_tracer.get();
+  }
+#endif // WITH_PACKET_TRACE
+
 public:
   /** \brief trigger before PIT entry is satisfied
    *  \sa Strategy::beforeSatisfyInterest
@@ -229,6 +272,14 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   VIRTUAL_WITH_TESTS void
   onInterestLoop(Face& inFace, const Interest& interest);
 
+  /** \brief PIT quota exceeded pipeline
+   *
+   *  Invoked when a new PIT entry cannot be created because the global or
+   *  per-face PIT limit is reached.
+   */
+  VIRTUAL_WITH_TESTS void
+  onPitQuotaExceeded(Face& inFace, const Interest& interest);
+
   /** \brief Content Store miss pipeline
   */
   VIRTUAL_WITH_TESTS void
@@ -340,6 +391,9 @@ public: // For randomWait test
 ////////////////////////////////
 
 private:
+  // must be declared first: tables below schedule timers on it during construction
+  unique_ptr<ExecutionContext> m_context;
+
   ////////////////////////////////
   // Nonce List for Data.
   // Jiangtao Luo. 13 Feb 2020
@@ -363,6 +417,10 @@ private:
 
   ns3::Ptr<ns3::ndn::ContentStore> m_csFromNdnSim;
 
+#ifdef WITH_PACKET_TRACE
+  unique_ptr<trace::PacketTracer> m_tracer;
+#endif // WITH_PACKET_TRACE
+
   // allow Strategy (base class) to enter pipelines
   friend class fw::Strategy;
 };
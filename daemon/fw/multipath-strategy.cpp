@@ -0,0 +1,337 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "multipath-strategy.hpp"
+#include "algorithm.hpp"
+#include "core/logger.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include <random>
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT(MultipathStrategy);
+NFD_REGISTER_STRATEGY(MultipathStrategy);
+
+const time::milliseconds MultipathStrategy::RETX_SUPPRESSION_INITIAL(10);
+const time::milliseconds MultipathStrategy::RETX_SUPPRESSION_MAX(250);
+const time::seconds MultipathStrategy::MEASUREMENTS_LIFETIME(16);
+
+const double MultipathStrategy::NexthopInfo::MIN_PENALTY = 1.0 / 64;
+const double MultipathStrategy::NexthopInfo::PENALTY_RECOVERY = 1.0 / 32;
+
+MultipathStrategy::MultipathStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder)
+  , ProcessNackTraits(this)
+  , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
+                      RetxSuppressionExponential::DEFAULT_MULTIPLIER,
+                      RETX_SUPPRESSION_MAX)
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  if (!parsed.parameters.empty()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument("MultipathStrategy does not accept parameters"));
+  }
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument(
+      "MultipathStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+}
+
+const Name&
+MultipathStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/multipath/%FD%01");
+  return strategyName;
+}
+
+/** \brief determines whether a NextHop is eligible
+ *  \param inFace incoming face of current Interest
+ *  \param interest incoming Interest
+ *  \param nexthop next hop
+ */
+static bool
+isNextHopEligible(const Face& inFace, const Interest& interest, const fib::NextHop& nexthop)
+{
+  const Face& outFace = nexthop.getFace();
+
+  // do not forward back to the same face, unless it is ad hoc
+  if (outFace.getId() == inFace.getId() && outFace.getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC)
+    return false;
+
+  // forwarding would violate scope
+  return !wouldViolateScope(inFace, interest, outFace);
+}
+
+void
+MultipathStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
+                                        const shared_ptr<pit::Entry>& pitEntry)
+{
+  RetxSuppressionResult suppression = m_retxSuppression.decidePerPitEntry(*pitEntry);
+  if (suppression == RetxSuppressionResult::SUPPRESS) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " suppressed");
+    return;
+  }
+
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  MtInfo* mi = this->getPrefixMeasurements(fibEntry);
+  bool isRetx = suppression == RetxSuppressionResult::FORWARD;
+
+  Face* outFace = this->pickNexthop(inFace, interest, pitEntry, fibEntry, mi, isRetx);
+  if (outFace == nullptr) {
+    if (isRetx) {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmitNoNextHop");
+      return;
+    }
+
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " noNextHop");
+
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::NO_ROUTE);
+    this->sendNack(pitEntry, inFace, nackHeader);
+
+    this->rejectPendingInterest(pitEntry);
+    return;
+  }
+
+  if (mi != nullptr) {
+    PitInfo* pi = pitEntry->insertStrategyInfo<PitInfo>().first;
+    pi->addPending(outFace->getId(), mi->getOrCreate(outFace->getId()));
+  }
+
+  NFD_LOG_DEBUG(interest << " from=" << inFace.getId()
+                         << (isRetx ? " retransmit-to=" : " newPitEntry-to=") << outFace->getId());
+  this->sendInterest(pitEntry, *outFace, interest);
+}
+
+Face*
+MultipathStrategy::pickNexthop(const Face& inFace, const Interest& interest,
+                               const shared_ptr<pit::Entry>& pitEntry, const fib::Entry& fibEntry,
+                               MtInfo* mi, bool wantUnused)
+{
+  std::vector<std::pair<Face*, const NexthopInfo*>> candidates;
+  auto now = time::steady_clock::now();
+  for (const fib::NextHop& nexthop : fibEntry.getNextHops()) {
+    if (!isNextHopEligible(inFace, interest, nexthop)) {
+      continue;
+    }
+
+    Face& outFace = nexthop.getFace();
+    if (wantUnused) {
+      // a retransmission should try a nexthop that is not already waiting for Data
+      auto outRecord = pitEntry->getOutRecord(outFace);
+      if (outRecord != pitEntry->out_end() && outRecord->getExpiry() > now) {
+        continue;
+      }
+    }
+
+    const NexthopInfo* info = nullptr;
+    if (mi != nullptr) {
+      auto it = mi->nexthops.find(outFace.getId());
+      if (it != mi->nexthops.end()) {
+        info = it->second.get();
+      }
+    }
+    candidates.emplace_back(&outFace, info);
+  }
+
+  if (candidates.empty()) {
+    // every eligible nexthop has been tried; start over
+    return wantUnused ? this->pickNexthop(inFace, interest, pitEntry, fibEntry, mi, false) : nullptr;
+  }
+  if (candidates.size() == 1) {
+    return candidates.front().first;
+  }
+
+  // unmeasured nexthops are treated as fast as the fastest measured one, so that they are explored
+  auto fallbackSrtt = RttEstimator::getInitialRtt();
+  bool hasMeasured = false;
+  for (const auto& candidate : candidates) {
+    if (candidate.second != nullptr && candidate.second->rtt.hasSamples()) {
+      auto srtt = candidate.second->rtt.getSmoothedRtt();
+      fallbackSrtt = hasMeasured ? std::min(fallbackSrtt, srtt) : srtt;
+      hasMeasured = true;
+    }
+  }
+
+  std::vector<double> weights;
+  weights.reserve(candidates.size());
+  for (const auto& candidate : candidates) {
+    weights.push_back(candidate.second == nullptr ? NexthopInfo().getWeight(fallbackSrtt) :
+                                                    candidate.second->getWeight(fallbackSrtt));
+  }
+
+  std::discrete_distribution<size_t> dist(weights.begin(), weights.end());
+  return candidates.at(dist(this->getExecutionContext().getRng())).first;
+}
+
+void
+MultipathStrategy::beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                                         const Face& inFace, const Data& data)
+{
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi == nullptr) {
+    return;
+  }
+
+  shared_ptr<NexthopInfo> info = pi->removePending(inFace.getId());
+  // the Interest is satisfied, so other upstreams are no longer waited upon
+  pi->clearPending();
+  if (info == nullptr) {
+    return;
+  }
+
+  auto outRecord = pitEntry->getOutRecord(inFace);
+  if (outRecord == pitEntry->out_end()) {
+    NFD_LOG_DEBUG(pitEntry->getInterest() << " dataFrom " << inFace.getId() << " no-out-record");
+    return;
+  }
+
+  auto rtt = time::duration_cast<RttEstimator::Duration>(time::steady_clock::now() -
+                                                        outRecord->getLastRenewed());
+  auto mark = data.getTag<lp::CongestionMarkTag>();
+  bool isCongestionMarked = mark != nullptr && *mark > 0;
+  info->recordData(rtt, isCongestionMarked);
+
+  NFD_LOG_DEBUG(pitEntry->getInterest() << " dataFrom " << inFace.getId()
+                << " rtt=" << rtt.count() << " congestion-mark=" << isCongestionMarked
+                << " penalty=" << info->penalty);
+}
+
+void
+MultipathStrategy::afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                                    const shared_ptr<pit::Entry>& pitEntry)
+{
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi != nullptr) {
+    shared_ptr<NexthopInfo> info = pi->removePending(inFace.getId());
+    if (info != nullptr) {
+      info->recordCongestion(nack.getReason() != lp::NackReason::CONGESTION);
+      NFD_LOG_DEBUG(nack.getInterest() << " nackFrom " << inFace.getId()
+                    << " reason=" << nack.getReason() << " penalty=" << info->penalty);
+    }
+  }
+
+  this->processNack(inFace, nack, pitEntry);
+}
+
+MultipathStrategy::MtInfo*
+MultipathStrategy::getPrefixMeasurements(const fib::Entry& fibEntry)
+{
+  measurements::Entry* me = this->getMeasurements().get(fibEntry);
+  if (me == nullptr) {
+    return nullptr;
+  }
+
+  this->getMeasurements().extendLifetime(*me, MEASUREMENTS_LIFETIME);
+  return me->insertStrategyInfo<MtInfo>().first;
+}
+
+MultipathStrategy::NexthopInfo::NexthopInfo()
+  : nOutstanding(0)
+  , penalty(1.0)
+{
+}
+
+double
+MultipathStrategy::NexthopInfo::getWeight(RttEstimator::Duration fallbackSrtt) const
+{
+  auto srtt = rtt.hasSamples() ? rtt.getSmoothedRtt() : fallbackSrtt;
+  double srttUs = std::max<double>(srtt.count(), 1.0);
+  return penalty / (srttUs * (1 + nOutstanding));
+}
+
+void
+MultipathStrategy::NexthopInfo::recordData(RttEstimator::Duration rttSample, bool isCongestionMarked)
+{
+  rtt.addMeasurement(rttSample);
+  if (isCongestionMarked) {
+    this->recordCongestion();
+  }
+  else {
+    penalty = std::min(penalty + PENALTY_RECOVERY, 1.0);
+  }
+}
+
+void
+MultipathStrategy::NexthopInfo::recordCongestion(bool isSevere)
+{
+  penalty = isSevere ? MIN_PENALTY : std::max(penalty / 2, MIN_PENALTY);
+}
+
+shared_ptr<MultipathStrategy::NexthopInfo>&
+MultipathStrategy::MtInfo::getOrCreate(FaceId faceId)
+{
+  shared_ptr<NexthopInfo>& info = nexthops[faceId];
+  if (info == nullptr) {
+    info = make_shared<NexthopInfo>();
+  }
+  return info;
+}
+
+MultipathStrategy::PitInfo::~PitInfo()
+{
+  for (const auto& p : pending) {
+    --p.second->nOutstanding;
+    p.second->recordCongestion();
+  }
+}
+
+void
+MultipathStrategy::PitInfo::addPending(FaceId faceId, const shared_ptr<NexthopInfo>& info)
+{
+  bool isNew = pending.emplace(faceId, info).second;
+  if (isNew) {
+    ++info->nOutstanding;
+  }
+}
+
+shared_ptr<MultipathStrategy::NexthopInfo>
+MultipathStrategy::PitInfo::removePending(FaceId faceId)
+{
+  auto it = pending.find(faceId);
+  if (it == pending.end()) {
+    return nullptr;
+  }
+
+  shared_ptr<NexthopInfo> info = it->second;
+  pending.erase(it);
+  --info->nOutstanding;
+  return info;
+}
+
+void
+MultipathStrategy::PitInfo::clearPending()
+{
+  for (const auto& p : pending) {
+    --p.second->nOutstanding;
+  }
+  pending.clear();
+}
+
+} // namespace fw
+} // namespace nfd
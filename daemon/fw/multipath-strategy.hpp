@@ -0,0 +1,199 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_MULTIPATH_STRATEGY_HPP
+#define NFD_DAEMON_FW_MULTIPATH_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "process-nack-traits.hpp"
+#include "retx-suppression-exponential.hpp"
+#include "core/rtt-estimator.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief RTT-weighted multipath strategy
+ *
+ *  This strategy spreads Interests across all eligible FIB nexthops in proportion to
+ *  their observed capacity. Each new Interest is forwarded to one nexthop chosen at random,
+ *  with probability proportional to
+ *  \code
+ *  weight = penalty / (srtt * (1 + nOutstanding))
+ *  \endcode
+ *  where \p srtt is the smoothed RTT of the nexthop, \p nOutstanding is the number of Interests
+ *  pending on the nexthop, and \p penalty is a factor in (0,1] that is halved when Data carries
+ *  a congestion mark, when a Nack arrives, or when an Interest expires unanswered, and that
+ *  recovers additively with each unmarked Data. A nexthop without RTT samples is given the
+ *  lowest srtt among the other candidates, so that it is explored.
+ *
+ *  Measurements are kept per FIB prefix in the Measurements table.
+ *  A retransmitted Interest (not suppressed by exponential backoff) prefers nexthops that do not
+ *  have an unexpired out-record. Received Nacks are processed with ProcessNackTraits.
+ *
+ *  This strategy returns Nack to all downstreams with reason NoRoute
+ *  if there is no usable nexthop.
+ */
+class MultipathStrategy : public Strategy
+                        , public ProcessNackTraits<MultipathStrategy>
+{
+public:
+  explicit
+  MultipathStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+public: // triggers
+  void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                        const Face& inFace, const Data& data) override;
+
+  void
+  afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE: // StrategyInfo
+  /** \brief measurements of a nexthop under a FIB prefix
+   *
+   *  This is shared between the measurements entry and the PIT entries
+   *  that are waiting for the nexthop.
+   */
+  class NexthopInfo
+  {
+  public:
+    NexthopInfo();
+
+    /** \return forwarding weight
+     *  \param fallbackSrtt srtt to use if there's no RTT sample
+     */
+    double
+    getWeight(RttEstimator::Duration fallbackSrtt) const;
+
+    /** \brief records Data returned from the nexthop
+     */
+    void
+    recordData(RttEstimator::Duration rttSample, bool isCongestionMarked);
+
+    /** \brief records a congestion signal: Nack or expired Interest
+     *  \param isSevere whether the nexthop is unable to deliver, as opposed to being congested
+     */
+    void
+    recordCongestion(bool isSevere = false);
+
+  public:
+    RttEstimator rtt;
+    size_t nOutstanding;
+    double penalty;
+
+    static const double MIN_PENALTY;
+    static const double PENALTY_RECOVERY;
+  };
+
+  /** \brief StrategyInfo in measurements table
+   */
+  class MtInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1050;
+    }
+
+    shared_ptr<NexthopInfo>&
+    getOrCreate(FaceId faceId);
+
+  public:
+    std::unordered_map<FaceId, shared_ptr<NexthopInfo>> nexthops;
+  };
+
+  /** \brief StrategyInfo on PIT entry
+   *
+   *  Each nexthop the Interest is pending on is charged one outstanding Interest,
+   *  until Data or Nack arrives from it. If the PIT entry is erased while still pending,
+   *  the Interest is regarded as lost on that nexthop.
+   */
+  class PitInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1051;
+    }
+
+    ~PitInfo() override;
+
+    void
+    addPending(FaceId faceId, const shared_ptr<NexthopInfo>& info);
+
+    /** \return the nexthop measurements of \p faceId and stop charging it,
+     *          or nullptr if the Interest is not pending on \p faceId
+     */
+    shared_ptr<NexthopInfo>
+    removePending(FaceId faceId);
+
+    /** \brief stop charging all nexthops without penalty
+     */
+    void
+    clearPending();
+
+  public:
+    std::unordered_map<FaceId, shared_ptr<NexthopInfo>> pending;
+  };
+
+private:
+  /** \brief get or create per-prefix measurements for the FIB entry
+   *  \return measurements, or nullptr if the FIB prefix is not under this strategy
+   */
+  MtInfo*
+  getPrefixMeasurements(const fib::Entry& fibEntry);
+
+  /** \brief choose a nexthop at random in proportion to nexthop weights
+   *  \param wantUnused if true, prefer nexthops without unexpired out-record
+   *  \return chosen face, or nullptr if no nexthop is eligible
+   */
+  Face*
+  pickNexthop(const Face& inFace, const Interest& interest,
+              const shared_ptr<pit::Entry>& pitEntry, const fib::Entry& fibEntry,
+              MtInfo* mi, bool wantUnused);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static const time::milliseconds RETX_SUPPRESSION_INITIAL;
+  static const time::milliseconds RETX_SUPPRESSION_MAX;
+  static const time::seconds MEASUREMENTS_LIFETIME;
+  RetxSuppressionExponential m_retxSuppression;
+
+  friend ProcessNackTraits<MultipathStrategy>;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_MULTIPATH_STRATEGY_HPP
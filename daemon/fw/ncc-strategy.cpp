@@ -25,7 +25,6 @@
 
 #include "ncc-strategy.hpp"
 #include "algorithm.hpp"
-#include "core/random.hpp"
 
 namespace nfd {
 namespace fw {
@@ -89,7 +88,7 @@ NccStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
     deferRange = time::microseconds((deferFirst.count() + 1) / 2);
     --nUpstreams;
     this->sendInterest(pitEntry, *bestFace, interest);
-    pitEntryInfo->bestFaceTimeout = scheduler::schedule(
+    pitEntryInfo->bestFaceTimeout = this->getExecutionContext().schedule(
       meInfo.prediction,
       bind(&NccStrategy::timeoutOnBestFace, this, weak_ptr<pit::Entry>(pitEntry)));
   }
@@ -127,7 +126,7 @@ NccStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
     // this maxInterval would be used to determine when the next doPropagate would happen.
     pitEntryInfo->maxInterval = deferFirst;
   }
-  pitEntryInfo->propagateTimer = scheduler::schedule(deferFirst,
+  pitEntryInfo->propagateTimer = this->getExecutionContext().schedule(deferFirst,
     bind(&NccStrategy::doPropagate, this, inFace.getId(), weak_ptr<pit::Entry>(pitEntry)));
 }
 
@@ -176,8 +175,8 @@ NccStrategy::doPropagate(FaceId inFaceId, weak_ptr<pit::Entry> pitEntryWeak)
 
   if (isForwarded) {
     std::uniform_int_distribution<time::nanoseconds::rep> dist(0, pitEntryInfo->maxInterval.count() - 1);
-    time::nanoseconds deferNext = time::nanoseconds(dist(getGlobalRng()));
-    pitEntryInfo->propagateTimer = scheduler::schedule(deferNext,
+    time::nanoseconds deferNext = time::nanoseconds(dist(this->getExecutionContext().getRng()));
+    pitEntryInfo->propagateTimer = this->getExecutionContext().schedule(deferNext,
       bind(&NccStrategy::doPropagate, this, inFaceId, weak_ptr<pit::Entry>(pitEntry)));
   }
 }
@@ -11,10 +11,10 @@
 
 #include "randomwait-strategy.hpp"
 #include "algorithm.hpp"
+#include "face-set.hpp"
 #include "core/logger.hpp"
 
 #include "core/scheduler.hpp"
-#include "core/random.hpp"
 
 namespace nfd {
 namespace fw {
@@ -146,7 +146,7 @@ RandomWaitStrategy::sendInterestLater(Face& outFace, const Interest& interest,
 {
   // 1ms -10ms
   std::uniform_int_distribution <uint64_t> dist( DELAY_MIN_INTEREST.count(), DELAY_MAX_INTEREST.count());
-  time::microseconds delay = time::microseconds(dist(getGlobalRng()));
+  time::microseconds delay = time::microseconds(dist(this->getExecutionContext().getRng()));
 
   NFD_LOG_DEBUG("RandomWaitStrategy::sendInterestLater for "
                 << interest.getName().toUri()
@@ -192,7 +192,7 @@ void
 RandomWaitStrategy::sendDataToAll(const shared_ptr<pit::Entry>& pitEntry,
                                   const Face& inFace, const Data& data)
 {
-  std::set<Face*> pendingDownstreams;
+  FaceSet<> pendingDownstreams;
   auto now = time::steady_clock::now();
 
   // remember pending downstreams
@@ -202,7 +202,7 @@ RandomWaitStrategy::sendDataToAll(const shared_ptr<pit::Entry>& pitEntry,
           inRecord.getFace().getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) {
         continue;
       }
-      pendingDownstreams.insert(&inRecord.getFace());
+      pendingDownstreams.insert(inRecord.getFace());
     }
   }
 
@@ -227,7 +227,7 @@ RandomWaitStrategy::sendDataLater(const Face& outFace, const Data& data)
 {
   // 1ms -10ms
   std::uniform_int_distribution <uint64_t> dist( DELAY_MIN_DATA.count(), DELAY_MAX_DATA.count());
-  time::microseconds delay = time::microseconds(dist(getGlobalRng()));
+  time::microseconds delay = time::microseconds(dist(this->getExecutionContext().getRng()));
 
   NFD_LOG_DEBUG("sendDataLater for data="
                 << data.getName() << " to Face = " << outFace.getId() 
@@ -245,6 +245,12 @@ RandomWaitStrategy::afterContentStoreHit(const shared_ptr<pit::Entry>& pitEntry,
   cs::Entry *csEntry = getForwarder().getCs().findEntry(data.getName());
   if (!csEntry->isExpiredToRelayData()) { // if not expired, cancel scheduled tx
     NFD_LOG_DEBUG("Cancel scheduled Data relay and send now!!!");
+#ifdef WITH_PACKET_TRACE
+    trace::PacketTracer* tracer = getForwarder().getPacketTracer();
+    if (tracer != nullptr) {
+      tracer->record(trace::Event::RELAY_DATA_CANCELED, outFace.getId(), data.getName(), data.getNonce());
+    }
+#endif // WITH_PACKET_TRACE
     scheduler::cancel(csEntry->relayTimerForData);
   }
   this->sendData(pitEntry, data, outFace);
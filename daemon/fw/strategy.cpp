@@ -24,6 +24,7 @@
  */
 
 #include "strategy.hpp"
+#include "face-set.hpp"
 #include "forwarder.hpp"
 #include "core/logger.hpp"
 #include "core/random.hpp"
@@ -208,7 +209,7 @@ Strategy::sendData(const shared_ptr<pit::Entry>& pitEntry, const Data& data, con
 void
 Strategy::sendDataToAll(const shared_ptr<pit::Entry>& pitEntry, const Face& inFace, const Data& data)
 {
-  std::set<Face*> pendingDownstreams;
+  FaceSet<> pendingDownstreams;
   auto now = time::steady_clock::now();
 
   // remember pending downstreams
@@ -218,7 +219,7 @@ Strategy::sendDataToAll(const shared_ptr<pit::Entry>& pitEntry, const Face& inFa
           inRecord.getFace().getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) {
         continue;
       }
-      pendingDownstreams.insert(&inRecord.getFace());
+      pendingDownstreams.insert(inRecord.getFace());
     }
   }
 
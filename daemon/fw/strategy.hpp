@@ -350,6 +350,17 @@ protected: // accessors
     return m_forwarder.getFaceTable();
   }
 
+  /** \return execution context of the owning Forwarder
+   *
+   *  Strategies should schedule timers and draw random numbers through this context,
+   *  so that each node of a simulation has its own reproducible event and RNG streams.
+   */
+  ExecutionContext&
+  getExecutionContext() const
+  {
+    return m_forwarder.getExecutionContext();
+  }
+
 protected: // instance name
   struct ParsedInstanceName
   {
@@ -33,10 +33,14 @@
 #include <ndn-cxx/security/v2/validation-policy-accept-all.hpp>
 #include <ndn-cxx/security/v2/validation-policy-command-interest.hpp>
 #include <ndn-cxx/security/v2/validator.hpp>
+#include <ndn-cxx/security/verification-helpers.hpp>
 #include <ndn-cxx/util/io.hpp>
 
 #include <boost/filesystem.hpp>
 
+#include <list>
+#include <map>
+
 namespace sec2 = ndn::security::v2;
 
 namespace nfd {
@@ -63,11 +67,93 @@ getSignerFromTag(const Interest& interest)
   }
 }
 
+/** \brief a bounded LRU cache of signer certificates that have passed validation
+ *
+ *  Each entry maps a KeyLocator name to the trust anchor that validated a command carrying that
+ *  KeyLocator. The certificate copy retains its full name, including the implicit digest, so that
+ *  an entry can only be used with the exact certificate that was validated.
+ */
+class VerifiedSignerCache : noncopyable
+{
+public:
+  explicit
+  VerifiedSignerCache(size_t capacity)
+    : m_capacity(capacity)
+  {
+    BOOST_ASSERT(m_capacity > 0);
+  }
+
+  /** \return cached certificate for \p klName, or nullptr if not cached
+   *  \note A found entry becomes the most recently used entry.
+   */
+  const sec2::Certificate*
+  find(const Name& klName)
+  {
+    auto it = m_index.find(klName);
+    if (it == m_index.end()) {
+      return nullptr;
+    }
+    m_lru.splice(m_lru.end(), m_lru, it->second);
+    return &it->second->second;
+  }
+
+  void
+  insert(const Name& klName, const sec2::Certificate& cert)
+  {
+    auto it = m_index.find(klName);
+    if (it != m_index.end()) {
+      it->second->second = cert;
+      m_lru.splice(m_lru.end(), m_lru, it->second);
+      return;
+    }
+
+    if (m_index.size() >= m_capacity) {
+      m_index.erase(m_lru.front().first);
+      m_lru.pop_front();
+    }
+    m_lru.emplace_back(klName, cert);
+    m_index.emplace(klName, std::prev(m_lru.end()));
+  }
+
+  void
+  erase(const Name& klName)
+  {
+    auto it = m_index.find(klName);
+    if (it != m_index.end()) {
+      m_lru.erase(it->second);
+      m_index.erase(it);
+    }
+  }
+
+private:
+  using Entry = std::pair<Name, sec2::Certificate>;
+
+  size_t m_capacity;
+  std::list<Entry> m_lru; ///< least recently used entry at front
+  std::map<Name, std::list<Entry>::iterator> m_index;
+};
+
 /** \brief a validation policy that only permits Interest signed by a trust anchor
+ *
+ *  Once a KeyLocator has been validated against a trust anchor, subsequent commands carrying
+ *  the same KeyLocator are checked directly against the cached anchor, skipping the certificate
+ *  retrieval step of the validator. Timestamp checks are performed by the outer
+ *  ValidationPolicyCommandInterest before this policy is invoked, so they are unaffected.
  */
 class CommandAuthenticatorValidationPolicy : public sec2::ValidationPolicy
 {
 public:
+  /** \brief maximum number of signers cached per module
+   */
+  static constexpr size_t SIGNER_CACHE_CAPACITY = 64;
+
+  explicit
+  CommandAuthenticatorValidationPolicy(CommandAuthenticator::Counters& counters)
+    : m_counters(counters)
+    , m_signerCache(SIGNER_CACHE_CAPACITY)
+  {
+  }
+
   void
   checkPolicy(const Interest& interest, const shared_ptr<sec2::ValidationState>& state,
               const ValidationContinuation& continueValidation) final
@@ -83,6 +169,30 @@ public:
     auto state1 = dynamic_pointer_cast<sec2::InterestValidationState>(state);
     state1->getOriginalInterest().setTag(make_shared<SignerTag>(klName));
 
+    const sec2::Certificate* cert = m_signerCache.find(klName);
+    if (cert != nullptr && !cert->isValid()) {
+      m_signerCache.erase(klName);
+      cert = nullptr;
+    }
+
+    if (cert != nullptr) {
+      ++m_counters.nSignerCacheHits;
+      if (!ndn::security::verifySignature(interest, *cert)) {
+        state->fail({sec2::ValidationError::INVALID_SIGNATURE, "Invalid signature of " +
+                     interest.getName().toUri()});
+        return;
+      }
+      continueValidation(nullptr, state);
+      return;
+    }
+
+    ++m_counters.nSignerCacheMisses;
+    state1->afterSuccess.connect([this, klName] (const Interest&) {
+      const sec2::Certificate* anchor = m_validator->findTrustedCert(Interest(klName));
+      if (anchor != nullptr) {
+        m_signerCache.insert(klName, *anchor);
+      }
+    });
     continueValidation(make_shared<sec2::CertificateRequest>(Interest(klName)), state);
   }
 
@@ -94,6 +204,10 @@ public:
     // Non-anchor certificates cannot be retrieved by offline fetcher.
     BOOST_ASSERT_MSG(false, "Data should not be passed to this policy");
   }
+
+private:
+  CommandAuthenticator::Counters& m_counters;
+  VerifiedSignerCache m_signerCache;
 };
 
 shared_ptr<CommandAuthenticator>
@@ -118,7 +232,8 @@ CommandAuthenticator::processConfig(const ConfigSection& section, bool isDryRun,
     NFD_LOG_INFO("clear-authorizations");
     for (auto& kv : m_validators) {
       kv.second = make_shared<sec2::Validator>(
-        make_unique<sec2::ValidationPolicyCommandInterest>(make_unique<CommandAuthenticatorValidationPolicy>()),
+        make_unique<sec2::ValidationPolicyCommandInterest>(
+          make_unique<CommandAuthenticatorValidationPolicy>(m_counters)),
         make_unique<sec2::CertificateFetcherOffline>());
     }
   }
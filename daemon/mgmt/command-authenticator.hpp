@@ -27,6 +27,7 @@
 #define NFD_DAEMON_MGMT_COMMAND_AUTHENTICATOR_HPP
 
 #include "core/config-file.hpp"
+#include "core/counter.hpp"
 
 #include <ndn-cxx/mgmt/dispatcher.hpp>
 
@@ -45,6 +46,17 @@ namespace nfd {
 class CommandAuthenticator : public std::enable_shared_from_this<CommandAuthenticator>, noncopyable
 {
 public:
+  /** \brief signer cache counters
+   *
+   *  A cache hit means a command was verified against a previously validated signer
+   *  certificate, without going through certificate retrieval.
+   */
+  struct Counters
+  {
+    PacketCounter nSignerCacheHits;
+    PacketCounter nSignerCacheMisses;
+  };
+
   static shared_ptr<CommandAuthenticator>
   create();
 
@@ -59,6 +71,12 @@ public:
   ndn::mgmt::Authorization
   makeAuthorization(const std::string& module, const std::string& verb);
 
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
+  }
+
 private:
   CommandAuthenticator();
 
@@ -71,6 +89,7 @@ private:
 private:
   /// module => validator
   std::unordered_map<std::string, shared_ptr<ndn::security::v2::Validator>> m_validators;
+  Counters m_counters;
 };
 
 } // namespace nfd
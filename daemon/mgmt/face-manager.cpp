@@ -40,12 +40,20 @@ namespace nfd {
 
 NFD_LOG_INIT(FaceManager);
 
+/** \brief how long a cached faces/list dataset may be served
+ *
+ *  Face counters change without changing the FaceTable, so the cached dataset expires
+ *  even if no face event has happened.
+ */
+static const time::milliseconds FACE_LIST_MAX_AGE = 1_s;
+
 FaceManager::FaceManager(FaceSystem& faceSystem,
                          Dispatcher& dispatcher,
                          CommandAuthenticator& authenticator)
   : NfdManagerBase(dispatcher, authenticator, "faces")
   , m_faceSystem(faceSystem)
   , m_faceTable(faceSystem.getFaceTable())
+  , m_listCache(FACE_LIST_MAX_AGE)
 {
   // register handlers for ControlCommand
   registerCommandHandler<ndn::nfd::FaceCreateCommand>("create", bind(&FaceManager::createFace, this, _4, _5));
@@ -56,6 +64,8 @@ FaceManager::FaceManager(FaceSystem& faceSystem,
   registerStatusDatasetHandler("list", bind(&FaceManager::listFaces, this, _3));
   registerStatusDatasetHandler("channels", bind(&FaceManager::listChannels, this, _3));
   registerStatusDatasetHandler("query", bind(&FaceManager::queryFaces, this, _2, _3));
+  registerChangeDatasetHandler("changes", [this] { return m_eventLog.getVersion(); },
+                               bind(&FaceManager::listChanges, this, _1, _2));
 
   // register notification stream
   m_postNotification = registerNotificationStream("events");
@@ -307,6 +317,9 @@ FaceManager::updateFace(const Interest& interest,
   }
   updateLinkServiceOptions(*face, parameters);
 
+  // updated properties are not reported as face events
+  m_listCache.invalidate();
+
   // Prepare and send ControlResponse
   response = makeUpdateFaceResponse(*face);
   done(ControlResponse(200, "OK").setBody(response.wireEncode()));
@@ -381,12 +394,13 @@ makeFaceStatus(const Face& face, const time::steady_clock::TimePoint& now)
 void
 FaceManager::listFaces(ndn::mgmt::StatusDatasetContext& context)
 {
-  auto now = time::steady_clock::now();
-  for (const auto& face : m_faceTable) {
-    ndn::nfd::FaceStatus status = makeFaceStatus(face, now);
-    context.append(status.wireEncode());
-  }
-  context.end();
+  m_listCache.serve(m_eventLog.getVersion(), context, [this] (std::vector<Block>& elements) {
+    auto now = time::steady_clock::now();
+    for (const auto& face : m_faceTable) {
+      ndn::nfd::FaceStatus status = makeFaceStatus(face, now);
+      elements.push_back(status.wireEncode());
+    }
+  });
 }
 
 void
@@ -468,6 +482,20 @@ FaceManager::queryFaces(const Interest& interest,
   context.end();
 }
 
+bool
+FaceManager::listChanges(uint64_t since, ndn::mgmt::StatusDatasetContext& context)
+{
+  bool isAvailable = m_eventLog.forEachSince(since, [&context] (const Block& notification) {
+    context.append(notification);
+  });
+  if (!isAvailable) {
+    return false;
+  }
+
+  context.end();
+  return true;
+}
+
 void
 FaceManager::notifyFaceEvent(const Face& face, ndn::nfd::FaceEventKind kind)
 {
@@ -475,7 +503,9 @@ FaceManager::notifyFaceEvent(const Face& face, ndn::nfd::FaceEventKind kind)
   notification.setKind(kind);
   copyFaceProperties(face, notification);
 
-  m_postNotification(notification.wireEncode());
+  const Block& wire = notification.wireEncode();
+  m_eventLog.record(wire);
+  m_postNotification(wire);
 }
 
 void
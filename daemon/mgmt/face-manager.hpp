@@ -27,6 +27,7 @@
 #define NFD_DAEMON_MGMT_FACE_MANAGER_HPP
 
 #include "nfd-manager-base.hpp"
+#include "core/status-dataset-cache.hpp"
 #include "face/face-system.hpp"
 
 namespace nfd {
@@ -72,6 +73,13 @@ private: // StatusDataset
   void
   queryFaces(const Interest& interest, ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief serves the faces/changes dataset
+   *
+   *  The changes are the FaceEventNotifications posted after the given version, in order.
+   */
+  bool
+  listChanges(uint64_t since, ndn::mgmt::StatusDatasetContext& context);
+
 private: // NotificationStream
   void
   notifyFaceEvent(const Face& face, ndn::nfd::FaceEventKind kind);
@@ -83,6 +91,8 @@ private:
   FaceSystem& m_faceSystem;
   FaceTable& m_faceTable;
   ndn::mgmt::PostNotification m_postNotification;
+  TableChangeLog<Block> m_eventLog;
+  StatusDatasetCache m_listCache;
   signal::ScopedConnection m_faceAddConn;
   signal::ScopedConnection m_faceRemoveConn;
 
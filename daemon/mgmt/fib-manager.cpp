@@ -51,6 +51,12 @@ FibManager::FibManager(Fib& fib,
     bind(&FibManager::removeNextHop, this, _2, _3, _4, _5));
 
   registerStatusDatasetHandler("list", bind(&FibManager::listEntries, this, _1, _2, _3));
+  registerChangeDatasetHandler("changes", [this] { return m_changeLog.getVersion(); },
+                               bind(&FibManager::listChanges, this, _1, _2));
+
+  m_fibChangeConn = m_fib.afterChange.connect([this] (const Name& prefix) {
+    m_changeLog.record(prefix);
+  });
 }
 
 void
@@ -78,7 +84,7 @@ FibManager::addNextHop(const Name& topPrefix, const Interest& interest,
   }
 
   fib::Entry* entry = m_fib.insert(prefix).first;
-  entry->addOrUpdateNextHop(*face, 0, cost);
+  m_fib.addOrUpdateNextHop(*entry, *face, 0, cost);
 
   NFD_LOG_TRACE("fib/add-nexthop(" << prefix << ',' << faceId << ',' << cost << "): OK");
   return done(ControlResponse(200, "Success").setBody(parameters.wireEncode()));
@@ -107,9 +113,8 @@ FibManager::removeNextHop(const Name& topPrefix, const Interest& interest,
     return;
   }
 
-  entry->removeNextHop(*face, 0);
-  if (!entry->hasNextHops()) {
-    m_fib.erase(*entry);
+  m_fib.removeNextHop(*entry, *face, 0);
+  if (m_fib.findExactMatch(prefix) == nullptr) {
     NFD_LOG_TRACE("fib/remove-nexthop(" << prefix << ',' << faceId << "): OK entry-erased");
   }
   else {
@@ -117,23 +122,53 @@ FibManager::removeNextHop(const Name& topPrefix, const Interest& interest,
   }
 }
 
+static ndn::nfd::FibEntry
+makeFibEntry(const fib::Entry& entry)
+{
+  const auto& nexthops = entry.getNextHops() |
+                         boost::adaptors::transformed([] (const fib::NextHop& nh) {
+                           return ndn::nfd::NextHopRecord()
+                               .setFaceId(nh.getFace().getId())
+                               .setCost(nh.getCost());
+                         });
+  return ndn::nfd::FibEntry()
+         .setPrefix(entry.getPrefix())
+         .setNextHopRecords(std::begin(nexthops), std::end(nexthops));
+}
+
 void
 FibManager::listEntries(const Name& topPrefix, const Interest& interest,
                         ndn::mgmt::StatusDatasetContext& context)
 {
-  for (const auto& entry : m_fib) {
-    const auto& nexthops = entry.getNextHops() |
-                           boost::adaptors::transformed([] (const fib::NextHop& nh) {
-                             return ndn::nfd::NextHopRecord()
-                                 .setFaceId(nh.getFace().getId())
-                                 .setCost(nh.getCost());
-                           });
-    context.append(ndn::nfd::FibEntry()
-                   .setPrefix(entry.getPrefix())
-                   .setNextHopRecords(std::begin(nexthops), std::end(nexthops))
-                   .wireEncode());
+  m_listCache.serve(m_changeLog.getVersion(), context, [this] (std::vector<Block>& elements) {
+    for (const auto& entry : m_fib) {
+      elements.push_back(makeFibEntry(entry).wireEncode());
+    }
+  });
+}
+
+bool
+FibManager::listChanges(uint64_t since, ndn::mgmt::StatusDatasetContext& context)
+{
+  std::set<Name> prefixes;
+  bool isAvailable = m_changeLog.forEachSince(since, [&prefixes] (const Name& prefix) {
+    prefixes.insert(prefix);
+  });
+  if (!isAvailable) {
+    return false;
+  }
+
+  for (const Name& prefix : prefixes) {
+    const fib::Entry* entry = m_fib.findExactMatch(prefix);
+    if (entry != nullptr) {
+      context.append(makeFibEntry(*entry).wireEncode());
+    }
+    else {
+      context.append(ndn::nfd::FibEntry().setPrefix(prefix).wireEncode());
+    }
   }
   context.end();
+  return true;
 }
 
 void
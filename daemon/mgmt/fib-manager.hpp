@@ -27,6 +27,7 @@
 #define NFD_DAEMON_MGMT_FIB_MANAGER_HPP
 
 #include "nfd-manager-base.hpp"
+#include "core/status-dataset-cache.hpp"
 #include "fw/forwarder.hpp"
 #include "table/fib.hpp"
 
@@ -61,6 +62,14 @@ private:
   listEntries(const Name& topPrefix, const Interest& interest,
               ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief serves the fib/changes dataset
+   *
+   *  Each changed prefix is reported with its current nexthops, or without nexthops if its
+   *  FIB entry has been erased.
+   */
+  bool
+  listChanges(uint64_t since, ndn::mgmt::StatusDatasetContext& context);
+
 private:
   void
   setFaceForSelfRegistration(const Interest& request, ControlParameters& parameters);
@@ -68,6 +77,9 @@ private:
 private:
   Fib& m_fib;
   const FaceTable& m_faceTable;
+  TableChangeLog<Name> m_changeLog;
+  StatusDatasetCache m_listCache;
+  signal::ScopedConnection m_fibChangeConn;
 };
 
 } // namespace nfd
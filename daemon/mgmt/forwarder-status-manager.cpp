@@ -27,6 +27,8 @@
 #include "fw/forwarder.hpp"
 #include "core/version.hpp"
 
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
 namespace nfd {
 
 static const time::milliseconds STATUS_FRESHNESS(5000);
@@ -80,6 +82,13 @@ ForwarderStatusManager::listGeneralStatus(const Name& topPrefix, const Interest&
   for (const auto& subblock : wire.elements()) {
     context.append(subblock);
   }
+
+  const Pit& pit = m_forwarder.getPit();
+  context.append(ndn::makeNonNegativeIntegerBlock(TLV_PIT_MAX_ENTRIES, pit.getLimit()));
+  context.append(ndn::makeNonNegativeIntegerBlock(TLV_PIT_MAX_ENTRIES_PER_FACE,
+                                                  pit.getPerFaceLimit()));
+  context.append(ndn::makeNonNegativeIntegerBlock(TLV_N_PIT_QUOTA_EXCEEDED,
+                                                  m_forwarder.getCounters().nPitQuotaExceeded));
   context.end();
 }
 
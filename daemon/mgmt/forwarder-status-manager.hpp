@@ -39,6 +39,19 @@ class Forwarder;
  */
 class ForwarderStatusManager : noncopyable
 {
+public:
+  /** \brief TLV-TYPE numbers of elements appended after the standard ForwarderStatus fields
+   *
+   *  These report PIT quota settings, which ForwarderStatus has no fields for.
+   *  The numbers are even, so they are non-critical and ignored by decoders that
+   *  do not recognize them.
+   */
+  enum ExtensionTlvType : uint32_t {
+    TLV_PIT_MAX_ENTRIES          = 0x01F0,
+    TLV_PIT_MAX_ENTRIES_PER_FACE = 0x01F2,
+    TLV_N_PIT_QUOTA_EXCEEDED     = 0x01F4
+  };
+
 public:
   ForwarderStatusManager(Forwarder& forwarder, Dispatcher& dispatcher);
 
@@ -0,0 +1,477 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "metrics-exporter.hpp"
+#include "core/logger.hpp"
+#include "face/generic-link-service.hpp"
+#include "fw/forwarder.hpp"
+
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+
+#include <sstream>
+
+namespace nfd {
+
+NFD_LOG_INIT(MetricsExporter);
+
+const size_t MetricsExporter::MAX_REQUEST_SIZE = 8192;
+const time::milliseconds MetricsExporter::MIN_POLL_INTERVAL = 10_ms;
+const time::milliseconds MetricsExporter::MAX_POLL_INTERVAL = 1_s;
+
+static const std::string CFG_METRICS = "metrics";
+
+MetricsExporter::MetricsExporter(Forwarder& forwarder)
+  : m_forwarder(forwarder)
+{
+}
+
+MetricsExporter::~MetricsExporter()
+{
+  this->close();
+}
+
+void
+MetricsExporter::setConfigFile(ConfigFile& configFile)
+{
+  m_isConfigured = false;
+  configFile.addSectionHandler(CFG_METRICS, bind(&MetricsExporter::processConfig, this, _1, _2, _3));
+}
+
+void
+MetricsExporter::ensureConfigured()
+{
+  if (m_isConfigured) {
+    return;
+  }
+
+  this->close();
+  m_tcpEndpoint = nullopt;
+  m_unixPath.clear();
+  m_isConfigured = true;
+}
+
+void
+MetricsExporter::processConfig(const ConfigSection& section, bool isDryRun, const std::string&)
+{
+  optional<uint16_t> tcpPort;
+  auto tcpAddress = boost::asio::ip::address_v4::loopback().to_string();
+  std::string unixPath;
+
+  for (const auto& item : section) {
+    const std::string& key = item.first;
+    if (key == "tcp_port") {
+      tcpPort = ConfigFile::parseNumber<uint16_t>(item, CFG_METRICS);
+    }
+    else if (key == "tcp_address") {
+      tcpAddress = item.second.get_value<std::string>();
+    }
+    else if (key == "unix_path") {
+      unixPath = item.second.get_value<std::string>();
+      if (unixPath.empty()) {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error("Empty \"unix_path\" in \"" + CFG_METRICS + "\" section"));
+      }
+    }
+    else {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option \"" + key + "\" in \"" +
+                                              CFG_METRICS + "\" section"));
+    }
+  }
+
+  optional<boost::asio::ip::tcp::endpoint> tcpEndpoint;
+  if (tcpPort) {
+    boost::system::error_code ec;
+    auto address = boost::asio::ip::address::from_string(tcpAddress, ec);
+    if (ec) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value \"" + tcpAddress +
+                                              "\" for option \"tcp_address\" in \"" +
+                                              CFG_METRICS + "\" section"));
+    }
+    tcpEndpoint = boost::asio::ip::tcp::endpoint(address, *tcpPort);
+  }
+
+  if (isDryRun) {
+    return;
+  }
+  m_isConfigured = true;
+
+  if (tcpEndpoint != m_tcpEndpoint) {
+    if (m_tcpAcceptor != nullptr) {
+      m_tcpAcceptor->close();
+      m_tcpAcceptor.reset();
+    }
+    m_tcpEndpoint = tcpEndpoint;
+    if (m_tcpEndpoint) {
+      this->listenTcp(*m_tcpEndpoint);
+    }
+  }
+
+  if (unixPath != m_unixPath) {
+    if (m_unixAcceptor != nullptr) {
+      m_unixAcceptor->close();
+      m_unixAcceptor.reset();
+      boost::filesystem::remove(m_unixPath);
+    }
+    m_unixPath = unixPath;
+    if (!m_unixPath.empty()) {
+      this->listenUnix(m_unixPath);
+    }
+  }
+
+  if (m_tcpAcceptor == nullptr && m_unixAcceptor == nullptr) {
+    m_pollEvent.cancel();
+  }
+}
+
+void
+MetricsExporter::listenTcp(const boost::asio::ip::tcp::endpoint& endpoint)
+{
+  m_tcpAcceptor = make_unique<boost::asio::ip::tcp::acceptor>(m_io);
+  try {
+    m_tcpAcceptor->open(endpoint.protocol());
+    m_tcpAcceptor->set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+    m_tcpAcceptor->bind(endpoint);
+    m_tcpAcceptor->listen();
+  }
+  catch (const boost::system::system_error& e) {
+    m_tcpAcceptor.reset();
+    BOOST_THROW_EXCEPTION(ConfigFile::Error("Cannot listen on " + boost::lexical_cast<std::string>(endpoint) +
+                                            " for \"" + CFG_METRICS + "\" section: " + e.what()));
+  }
+
+  NFD_LOG_INFO("Serving metrics on tcp " << endpoint);
+  this->accept<boost::asio::ip::tcp>(*m_tcpAcceptor);
+  this->schedulePoll(MIN_POLL_INTERVAL);
+}
+
+void
+MetricsExporter::listenUnix(const std::string& path)
+{
+  namespace fs = boost::filesystem;
+
+  // a stale socket file is left behind if NFD was not shut down cleanly
+  if (fs::symlink_status(path).type() == fs::socket_file) {
+    fs::remove(path);
+  }
+
+  m_unixAcceptor = make_unique<boost::asio::local::stream_protocol::acceptor>(m_io);
+  try {
+    boost::asio::local::stream_protocol::endpoint endpoint(path);
+    m_unixAcceptor->open(endpoint.protocol());
+    m_unixAcceptor->bind(endpoint);
+    m_unixAcceptor->listen();
+  }
+  catch (const boost::system::system_error& e) {
+    m_unixAcceptor.reset();
+    BOOST_THROW_EXCEPTION(ConfigFile::Error("Cannot listen on " + path + " for \"" +
+                                            CFG_METRICS + "\" section: " + e.what()));
+  }
+
+  NFD_LOG_INFO("Serving metrics on unix " << path);
+  this->accept<boost::asio::local::stream_protocol>(*m_unixAcceptor);
+  this->schedulePoll(MIN_POLL_INTERVAL);
+}
+
+void
+MetricsExporter::close()
+{
+  m_pollEvent.cancel();
+  if (m_tcpAcceptor != nullptr) {
+    m_tcpAcceptor->close();
+    m_tcpAcceptor.reset();
+  }
+  if (m_unixAcceptor != nullptr) {
+    m_unixAcceptor->close();
+    m_unixAcceptor.reset();
+    boost::system::error_code ec;
+    boost::filesystem::remove(m_unixPath, ec);
+  }
+}
+
+void
+MetricsExporter::schedulePoll(time::milliseconds interval)
+{
+  m_pollInterval = interval;
+  m_pollEvent = m_forwarder.getExecutionContext().schedule(m_pollInterval, [this] { this->poll(); });
+}
+
+void
+MetricsExporter::poll()
+{
+  size_t nHandlers = m_io.poll();
+  if (m_io.stopped()) { // ran out of work
+    m_io.reset();
+  }
+
+  if (m_tcpAcceptor == nullptr && m_unixAcceptor == nullptr) {
+    return;
+  }
+
+  // back off while nobody is scraping, so that idle nodes are rarely woken up
+  this->schedulePoll(nHandlers > 0 ? MIN_POLL_INTERVAL : std::min(2 * m_pollInterval, MAX_POLL_INTERVAL));
+}
+
+template<typename Protocol>
+void
+MetricsExporter::accept(typename Protocol::acceptor& acceptor)
+{
+  auto socket = make_shared<typename Protocol::socket>(m_io);
+  acceptor.async_accept(*socket, [this, &acceptor, socket] (const boost::system::error_code& error) {
+    if (error == boost::asio::error::operation_aborted) { // acceptor closed
+      return;
+    }
+    if (error) {
+      NFD_LOG_DEBUG("Accept failed: " << error.message());
+    }
+    else {
+      this->respond<Protocol>(socket);
+    }
+    this->accept<Protocol>(acceptor);
+  });
+}
+
+template<typename Protocol>
+void
+MetricsExporter::respond(const shared_ptr<typename Protocol::socket>& socket)
+{
+  auto request = make_shared<boost::asio::streambuf>(MAX_REQUEST_SIZE);
+  boost::asio::async_read_until(*socket, *request, "\r\n\r\n",
+    [this, socket, request] (const boost::system::error_code& error, size_t) {
+      if (error) {
+        // request is malformed or exceeds MAX_REQUEST_SIZE
+        NFD_LOG_DEBUG("Read failed: " << error.message());
+        return;
+      }
+
+      std::ostringstream body;
+      this->writeMetrics(body);
+
+      auto response = make_shared<std::string>(
+        "HTTP/1.0 200 OK\r\n"
+        "Content-Type: text/plain; version=0.0.4\r\n"
+        "Content-Length: " + to_string(body.str().size()) + "\r\n"
+        "Connection: close\r\n"
+        "\r\n" + body.str());
+      boost::asio::async_write(*socket, boost::asio::buffer(*response),
+        [socket, response] (const boost::system::error_code& error, size_t) {
+          boost::system::error_code ec;
+          socket->shutdown(Protocol::socket::shutdown_both, ec);
+          socket->close(ec);
+        });
+    });
+}
+
+/** \brief escape a label value
+ */
+static std::string
+escapeLabel(const std::string& value)
+{
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (char c : value) {
+    switch (c) {
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += c;
+        break;
+    }
+  }
+  return escaped;
+}
+
+static void
+writeFamily(std::ostream& os, const char* name, const char* type, const char* help)
+{
+  os << "# HELP " << name << ' ' << help << '\n'
+     << "# TYPE " << name << ' ' << type << '\n';
+}
+
+static void
+writeScalar(std::ostream& os, const char* name, const char* type, const char* help, uint64_t value)
+{
+  writeFamily(os, name, type, help);
+  os << name << ' ' << value << '\n';
+}
+
+static void
+writeInOut(std::ostream& os, const char* name, const char* help, uint64_t nIn, uint64_t nOut)
+{
+  writeFamily(os, name, "counter", help);
+  os << name << "{direction=\"in\"} " << nIn << '\n'
+     << name << "{direction=\"out\"} " << nOut << '\n';
+}
+
+/** \brief write a per-face counter with one sample per face and direction
+ */
+template<typename GetIn, typename GetOut>
+static void
+writeFaceInOut(std::ostream& os, const FaceTable& faceTable, const char* name, const char* help,
+               const GetIn& getIn, const GetOut& getOut)
+{
+  writeFamily(os, name, "counter", help);
+  for (const Face& face : faceTable) {
+    const auto& counters = face.getCounters();
+    os << name << "{face=\"" << face.getId() << "\",direction=\"in\"} " << getIn(counters) << '\n'
+       << name << "{face=\"" << face.getId() << "\",direction=\"out\"} " << getOut(counters) << '\n';
+  }
+}
+
+/** \brief write a per-face metric of GenericLinkService, with one sample per face that has it
+ */
+template<typename GetValue>
+static void
+writeLpFamily(std::ostream& os, const FaceTable& faceTable, const char* name, const char* type,
+              const char* help, const GetValue& getValue)
+{
+  writeFamily(os, name, type, help);
+  for (const Face& face : faceTable) {
+    auto linkService = dynamic_cast<const face::GenericLinkService*>(face.getLinkService());
+    if (linkService == nullptr) {
+      continue;
+    }
+    os << name << "{face=\"" << face.getId() << "\"} " << getValue(linkService->getCounters()) << '\n';
+  }
+}
+
+void
+MetricsExporter::writeMetrics(std::ostream& os) const
+{
+  using face::FaceCounters;
+  using LpCounters = face::GenericLinkService::Counters;
+
+  const ForwarderCounters& counters = m_forwarder.getCounters();
+  writeInOut(os, "nfd_interests_total", "Interests received and sent by the forwarder",
+             counters.nInInterests, counters.nOutInterests);
+  writeInOut(os, "nfd_data_total", "Data received and sent by the forwarder",
+             counters.nInData, counters.nOutData);
+  writeInOut(os, "nfd_nacks_total", "Nacks received and sent by the forwarder",
+             counters.nInNacks, counters.nOutNacks);
+  writeScalar(os, "nfd_satisfied_interests_total", "counter",
+              "PIT entries satisfied before expiring", counters.nSatisfiedInterests);
+  writeScalar(os, "nfd_unsatisfied_interests_total", "counter",
+              "PIT entries expired without being satisfied", counters.nUnsatisfiedInterests);
+  writeScalar(os, "nfd_cs_hits_total", "counter", "Content Store lookup hits", counters.nCsHits);
+  writeScalar(os, "nfd_cs_misses_total", "counter", "Content Store lookup misses", counters.nCsMisses);
+  writeScalar(os, "nfd_pit_quota_exceeded_total", "counter",
+              "Interests Nacked because a PIT quota was exceeded", counters.nPitQuotaExceeded);
+
+  writeScalar(os, "nfd_name_tree_entries", "gauge", "Entries in the NameTree",
+              m_forwarder.getNameTree().size());
+  writeScalar(os, "nfd_fib_entries", "gauge", "Entries in the FIB", m_forwarder.getFib().size());
+  writeScalar(os, "nfd_pit_entries", "gauge", "Entries in the PIT", m_forwarder.getPit().size());
+  writeScalar(os, "nfd_pit_limit", "gauge", "Maximum number of PIT entries, 0 if unlimited",
+              m_forwarder.getPit().getLimit());
+  writeScalar(os, "nfd_pit_per_face_limit", "gauge",
+              "Maximum number of PIT entries per incoming face, 0 if unlimited",
+              m_forwarder.getPit().getPerFaceLimit());
+  writeScalar(os, "nfd_measurements_entries", "gauge", "Entries in the Measurements table",
+              m_forwarder.getMeasurements().size());
+  writeScalar(os, "nfd_cs_entries", "gauge", "Data packets in the Content Store",
+              m_forwarder.getCs().size());
+  writeScalar(os, "nfd_cs_capacity", "gauge", "Maximum number of Data packets in the Content Store",
+              m_forwarder.getCs().getLimit());
+  writeScalar(os, "nfd_dead_nonce_list_entries", "gauge", "Entries in the Dead Nonce List",
+              m_forwarder.getDeadNonceList().size());
+
+  const FaceTable& faceTable = m_forwarder.getFaceTable();
+  writeScalar(os, "nfd_faces", "gauge", "Faces in the FaceTable", faceTable.size());
+
+  writeFamily(os, "nfd_face_info", "gauge", "Face properties, the value is always 1");
+  for (const Face& face : faceTable) {
+    os << "nfd_face_info{face=\"" << face.getId()
+       << "\",local=\"" << escapeLabel(face.getLocalUri().toString())
+       << "\",remote=\"" << escapeLabel(face.getRemoteUri().toString())
+       << "\",scope=\"" << face.getScope()
+       << "\",persistency=\"" << face.getPersistency()
+       << "\",link_type=\"" << face.getLinkType()
+       << "\"} 1\n";
+  }
+
+  writeFaceInOut(os, faceTable, "nfd_face_interests_total", "Interests received and sent on a face",
+                 [] (const FaceCounters& c) { return uint64_t(c.nInInterests); },
+                 [] (const FaceCounters& c) { return uint64_t(c.nOutInterests); });
+  writeFaceInOut(os, faceTable, "nfd_face_data_total", "Data received and sent on a face",
+                 [] (const FaceCounters& c) { return uint64_t(c.nInData); },
+                 [] (const FaceCounters& c) { return uint64_t(c.nOutData); });
+  writeFaceInOut(os, faceTable, "nfd_face_nacks_total", "Nacks received and sent on a face",
+                 [] (const FaceCounters& c) { return uint64_t(c.nInNacks); },
+                 [] (const FaceCounters& c) { return uint64_t(c.nOutNacks); });
+  writeFaceInOut(os, faceTable, "nfd_face_packets_total", "Link-layer packets received and sent on a face",
+                 [] (const FaceCounters& c) { return uint64_t(c.nInPackets); },
+                 [] (const FaceCounters& c) { return uint64_t(c.nOutPackets); });
+  writeFaceInOut(os, faceTable, "nfd_face_bytes_total", "Link-layer bytes received and sent on a face",
+                 [] (const FaceCounters& c) { return uint64_t(c.nInBytes); },
+                 [] (const FaceCounters& c) { return uint64_t(c.nOutBytes); });
+
+  writeFamily(os, "nfd_face_dropped_interests_total", "counter",
+              "Interests dropped by the link service of a face");
+  for (const Face& face : faceTable) {
+    os << "nfd_face_dropped_interests_total{face=\"" << face.getId() << "\"} "
+       << face.getCounters().nDroppedInterests << '\n';
+  }
+
+  writeLpFamily(os, faceTable, "nfd_face_lp_fragmentation_errors_total", "counter",
+                "Failed fragmentations of outgoing packets",
+                [] (const LpCounters& c) { return uint64_t(c.nFragmentationErrors); });
+  writeLpFamily(os, faceTable, "nfd_face_lp_out_over_mtu_total", "counter",
+                "Outgoing packets dropped because they exceed MTU and fragmentation is disabled",
+                [] (const LpCounters& c) { return uint64_t(c.nOutOverMtu); });
+  writeLpFamily(os, faceTable, "nfd_face_lp_in_invalid_total", "counter",
+                "Incoming LpPackets that could not be decoded",
+                [] (const LpCounters& c) { return uint64_t(c.nInLpInvalid); });
+  writeLpFamily(os, faceTable, "nfd_face_lp_reassembling", "gauge",
+                "Partial network-layer packets being reassembled",
+                [] (const LpCounters& c) { return uint64_t(c.nReassembling); });
+  writeLpFamily(os, faceTable, "nfd_face_lp_reassembly_timeouts_total", "counter",
+                "Partial packets dropped because of reassembly timeout",
+                [] (const LpCounters& c) { return uint64_t(c.nReassemblyTimeouts); });
+  writeLpFamily(os, faceTable, "nfd_face_net_in_invalid_total", "counter",
+                "Incoming network-layer packets that could not be decoded",
+                [] (const LpCounters& c) { return uint64_t(c.nInNetInvalid); });
+  writeLpFamily(os, faceTable, "nfd_face_lp_acknowledged_total", "counter",
+                "Fragments acknowledged by the link reliability feature",
+                [] (const LpCounters& c) { return uint64_t(c.nAcknowledged); });
+  writeLpFamily(os, faceTable, "nfd_face_lp_retransmitted_total", "counter",
+                "Fragments retransmitted by the link reliability feature",
+                [] (const LpCounters& c) { return uint64_t(c.nRetransmitted); });
+  writeLpFamily(os, faceTable, "nfd_face_lp_retx_exhausted_total", "counter",
+                "Network-layer packets dropped because a fragment reached the retransmission limit",
+                [] (const LpCounters& c) { return uint64_t(c.nRetxExhausted); });
+  writeLpFamily(os, faceTable, "nfd_face_congestion_marked_total", "counter",
+                "Outgoing packets marked with a congestion mark",
+                [] (const LpCounters& c) { return uint64_t(c.nCongestionMarked); });
+}
+
+} // namespace nfd
@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_MGMT_METRICS_EXPORTER_HPP
+#define NFD_DAEMON_MGMT_METRICS_EXPORTER_HPP
+
+#include "core/config-file.hpp"
+#include "core/scheduler.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+namespace nfd {
+
+class Forwarder;
+
+/** \brief serves forwarder counters in Prometheus text exposition format
+ *
+ *  This class recognizes a config section that looks like
+ *  \code{.unparsed}
+ *  metrics
+ *  {
+ *    tcp_port 9696
+ *    tcp_address 127.0.0.1
+ *    unix_path /run/nfd-metrics.sock
+ *  }
+ *  \endcode
+ *
+ *  The exporter listens on TCP if tcp_port is present, and on a Unix stream socket if unix_path
+ *  is present. tcp_address defaults to 127.0.0.1. Listeners are closed if the section is omitted
+ *  during a configuration reload.
+ *
+ *  Every connection receives one HTTP/1.0 response containing all metrics, regardless of the
+ *  request target, and is then closed. Values are read from the live tables and counters while
+ *  the response is being generated, without encoding any status dataset.
+ *
+ *  The global io of this forwarder is driven by the simulator and cannot host sockets, so
+ *  listeners and connections run on an io_service owned by the exporter. Only while a listener
+ *  is open, that io_service is polled from the forwarder's execution context; handlers therefore
+ *  run on the forwarder thread and read tables without locking. The poll interval starts at
+ *  MIN_POLL_INTERVAL and doubles up to MAX_POLL_INTERVAL while no handler is ready, so that
+ *  a node that is not being scraped is rarely woken up.
+ */
+class MetricsExporter : noncopyable
+{
+public:
+  explicit
+  MetricsExporter(Forwarder& forwarder);
+
+  ~MetricsExporter();
+
+  void
+  setConfigFile(ConfigFile& configFile);
+
+  /** \brief close listeners, if metrics section was omitted in configuration file
+   */
+  void
+  ensureConfigured();
+
+  /** \brief write all metrics in Prometheus text exposition format
+   */
+  void
+  writeMetrics(std::ostream& os) const;
+
+private:
+  void
+  processConfig(const ConfigSection& section, bool isDryRun, const std::string& filename);
+
+  void
+  listenTcp(const boost::asio::ip::tcp::endpoint& endpoint);
+
+  void
+  listenUnix(const std::string& path);
+
+  void
+  close();
+
+  void
+  schedulePoll(time::milliseconds interval);
+
+  /** \brief run ready handlers on m_io, and schedule the next poll while a listener is open
+   */
+  void
+  poll();
+
+  template<typename Protocol>
+  void
+  accept(typename Protocol::acceptor& acceptor);
+
+  template<typename Protocol>
+  void
+  respond(const shared_ptr<typename Protocol::socket>& socket);
+
+public:
+  /** \brief maximum size of an HTTP request header
+   */
+  static const size_t MAX_REQUEST_SIZE;
+
+  /** \brief interval at which the exporter io_service is polled while connections are served
+   */
+  static const time::milliseconds MIN_POLL_INTERVAL;
+
+  /** \brief interval at which the exporter io_service is polled while idle
+   */
+  static const time::milliseconds MAX_POLL_INTERVAL;
+
+private:
+  Forwarder& m_forwarder;
+  bool m_isConfigured = false;
+  scheduler::ScopedEventId m_pollEvent;
+  time::milliseconds m_pollInterval = MIN_POLL_INTERVAL;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  boost::asio::io_service m_io;
+
+private:
+  optional<boost::asio::ip::tcp::endpoint> m_tcpEndpoint;
+  unique_ptr<boost::asio::ip::tcp::acceptor> m_tcpAcceptor;
+  std::string m_unixPath;
+  unique_ptr<boost::asio::local::stream_protocol::acceptor> m_unixAcceptor;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_MGMT_METRICS_EXPORTER_HPP
@@ -47,6 +47,12 @@ StrategyChoiceManager::StrategyChoiceManager(StrategyChoice& strategyChoice,
 
   registerStatusDatasetHandler("list",
     bind(&StrategyChoiceManager::listChoices, this, _3));
+  registerChangeDatasetHandler("changes", [this] { return m_changeLog.getVersion(); },
+    bind(&StrategyChoiceManager::listChanges, this, _1, _2));
+
+  m_tableChangeConn = m_table.afterChange.connect([this] (const Name& prefix) {
+    m_changeLog.record(prefix);
+  });
 }
 
 void
@@ -87,13 +93,35 @@ StrategyChoiceManager::unsetStrategy(ControlParameters parameters,
 void
 StrategyChoiceManager::listChoices(ndn::mgmt::StatusDatasetContext& context)
 {
-  for (const auto& i : m_table) {
+  m_listCache.serve(m_changeLog.getVersion(), context, [this] (std::vector<Block>& elements) {
+    for (const auto& i : m_table) {
+      ndn::nfd::StrategyChoice entry;
+      entry.setName(i.getPrefix())
+           .setStrategy(i.getStrategyInstanceName());
+      elements.push_back(entry.wireEncode());
+    }
+  });
+}
+
+bool
+StrategyChoiceManager::listChanges(uint64_t since, ndn::mgmt::StatusDatasetContext& context)
+{
+  std::set<Name> prefixes;
+  bool isAvailable = m_changeLog.forEachSince(since, [&prefixes] (const Name& prefix) {
+    prefixes.insert(prefix);
+  });
+  if (!isAvailable) {
+    return false;
+  }
+
+  for (const Name& prefix : prefixes) {
     ndn::nfd::StrategyChoice entry;
-    entry.setName(i.getPrefix())
-         .setStrategy(i.getStrategyInstanceName());
+    entry.setName(prefix)
+         .setStrategy(m_table.get(prefix).second);
     context.append(entry.wireEncode());
   }
   context.end();
+  return true;
 }
 
 } // namespace nfd
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_MGMT_STRATEGY_CHOICE_MANAGER_HPP
 
 #include "nfd-manager-base.hpp"
+#include "core/status-dataset-cache.hpp"
 
 namespace nfd {
 
@@ -57,8 +58,19 @@ private:
   void
   listChoices(ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief serves the strategy-choice/changes dataset
+   *
+   *  Each changed prefix is reported with its current strategy, or with an empty strategy
+   *  name if its strategy has been unset.
+   */
+  bool
+  listChanges(uint64_t since, ndn::mgmt::StatusDatasetContext& context);
+
 private:
   strategy_choice::StrategyChoice& m_table;
+  TableChangeLog<Name> m_changeLog;
+  StatusDatasetCache m_listCache;
+  signal::ScopedConnection m_tableChangeConn;
 };
 
 } // namespace nfd
@@ -53,6 +53,8 @@ TablesConfigSection::ensureConfigured()
   m_forwarder.getCs().setLimit(DEFAULT_CS_MAX_PACKETS);
   // Don't set default cs_policy because it's already created by CS itself.
   m_forwarder.setUnsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>());
+  m_forwarder.getPit().setLimit(0);
+  m_forwarder.getPit().setPerFaceLimit(0);
 
   m_isConfigured = true;
 }
@@ -91,6 +93,19 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     unsolicitedDataPolicy = make_unique<fw::DefaultUnsolicitedDataPolicy>();
   }
 
+  size_t nPitMaxEntries = 0;
+  OptionalConfigSection pitMaxEntriesNode = section.get_child_optional("pit_max_entries");
+  if (pitMaxEntriesNode) {
+    nPitMaxEntries = ConfigFile::parseNumber<size_t>(*pitMaxEntriesNode, "pit_max_entries", "tables");
+  }
+
+  size_t nPitMaxEntriesPerFace = 0;
+  OptionalConfigSection pitMaxEntriesPerFaceNode = section.get_child_optional("pit_max_entries_per_face");
+  if (pitMaxEntriesPerFaceNode) {
+    nPitMaxEntriesPerFace = ConfigFile::parseNumber<size_t>(*pitMaxEntriesPerFaceNode,
+                                                            "pit_max_entries_per_face", "tables");
+  }
+
   OptionalConfigSection strategyChoiceSection = section.get_child_optional("strategy_choice");
   if (strategyChoiceSection) {
     processStrategyChoiceSection(*strategyChoiceSection, isDryRun);
@@ -113,6 +128,10 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
 
   m_forwarder.setUnsolicitedDataPolicy(std::move(unsolicitedDataPolicy));
 
+  Pit& pit = m_forwarder.getPit();
+  pit.setLimit(nPitMaxEntries);
+  pit.setPerFaceLimit(nPitMaxEntriesPerFace);
+
   m_isConfigured = true;
 }
 
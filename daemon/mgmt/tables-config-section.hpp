@@ -40,6 +40,8 @@ namespace nfd {
  *    cs_max_packets 65536
  *    cs_policy lru
  *    cs_unsolicited_policy drop-all
+ *    pit_max_entries 0
+ *    pit_max_entries_per_face 0
  *
  *    strategy_choice
  *    {
@@ -60,6 +62,8 @@ namespace nfd {
  *  During a configuration reload,
  *  \li cs_max_packets, cs_policy, and cs_unsolicited_policy are applied;
  *      defaults are used if an option is omitted.
+ *  \li pit_max_entries and pit_max_entries_per_face are applied;
+ *      0 or an omitted option means unlimited. Existing PIT entries are not evicted.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
  *
@@ -38,6 +38,7 @@
 #include "mgmt/fib-manager.hpp"
 #include "mgmt/forwarder-status-manager.hpp"
 #include "mgmt/general-config-section.hpp"
+#include "mgmt/metrics-exporter.hpp"
 #include "mgmt/strategy-choice-manager.hpp"
 #include "mgmt/tables-config-section.hpp"
 
@@ -145,6 +146,7 @@ Nfd::initializeManagement()
                                        *m_dispatcher, *m_authenticator);
   m_strategyChoiceManager = make_unique<StrategyChoiceManager>(m_forwarder->getStrategyChoice(),
                                                                *m_dispatcher, *m_authenticator);
+  m_metricsExporter = make_unique<MetricsExporter>(*m_forwarder);
 
   ConfigFile config(&ignoreRibAndLogSections);
   general::setConfigFile(config);
@@ -154,6 +156,7 @@ Nfd::initializeManagement()
 
   m_authenticator->setConfigFile(config);
   m_faceSystem->setConfigFile(config);
+  m_metricsExporter->setConfigFile(config);
 
   // parse config file
   if (!m_configFile.empty()) {
@@ -166,10 +169,12 @@ Nfd::initializeManagement()
   }
 
   tablesConfig.ensureConfigured();
+  m_metricsExporter->ensureConfigured();
 
   // add FIB entry for NFD Management Protocol
   Name topPrefix("/localhost/nfd");
-  m_forwarder->getFib().insert(topPrefix).first->addOrUpdateNextHop(*m_internalFace, 0, 0);
+  Fib& fib = m_forwarder->getFib();
+  fib.addOrUpdateNextHop(*fib.insert(topPrefix).first, *m_internalFace, 0, 0);
   m_dispatcher->addTopPrefix(topPrefix, false);
 }
 
@@ -186,6 +191,7 @@ Nfd::reloadConfigFile()
 
   m_authenticator->setConfigFile(config);
   m_faceSystem->setConfigFile(config);
+  m_metricsExporter->setConfigFile(config);
 
   if (!m_configFile.empty()) {
     config.parse(m_configFile, false);
@@ -193,6 +199,8 @@ Nfd::reloadConfigFile()
   else {
     config.parse(m_configSection, false, INTERNAL_CONFIG);
   }
+
+  m_metricsExporter->ensureConfigured();
 }
 
 void
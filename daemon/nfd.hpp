@@ -43,6 +43,7 @@ namespace nfd {
 
 class Forwarder;
 class CommandAuthenticator;
+class MetricsExporter;
 
 // forward-declare management modules, in the order as defined in management protocol
 class ForwarderStatusManager;
@@ -125,6 +126,7 @@ private:
   unique_ptr<FibManager> m_fibManager;
   unique_ptr<CsManager> m_csManager;
   unique_ptr<StrategyChoiceManager> m_strategyChoiceManager;
+  unique_ptr<MetricsExporter> m_metricsExporter;
 
   shared_ptr<ndn::net::NetworkMonitor> m_netmon;
   scheduler::ScopedEventId m_reloadConfigEvent;
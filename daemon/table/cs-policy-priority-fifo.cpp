@@ -117,8 +117,9 @@ PriorityFifoPolicy::attachQueue(iterator i)
   }
   else {
     entryInfo->queueType = QUEUE_FIFO;
-    entryInfo->moveStaleEventId = scheduler::schedule(i->getData().getFreshnessPeriod(),
-                                                      [=] { moveToStaleQueue(i); });
+    BOOST_ASSERT(this->getCs() != nullptr);
+    entryInfo->moveStaleEventId = this->getCs()->getExecutionContext().schedule(
+      i->getData().getFreshnessPeriod(), [=] { moveToStaleQueue(i); });
   }
 
   Queue& queue = m_queues[entryInfo->queueType];
@@ -44,7 +44,8 @@ makeDefaultPolicy()
 }
 
 Cs::Cs(size_t nMaxPackets)
-  : m_shouldAdmit(true)
+  : m_context(&getGlobalExecutionContext())
+  , m_shouldAdmit(true)
   , m_shouldServe(true)
 {
   this->setPolicyImpl(makeDefaultPolicy());
@@ -29,6 +29,7 @@
 #include "cs-policy.hpp"
 #include "cs-internal.hpp"
 #include "cs-entry-impl.hpp"
+#include "core/execution-context.hpp"
 #include <ndn-cxx/util/signal.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 
@@ -121,6 +122,24 @@ public: // configuration
   void
   setPolicy(unique_ptr<Policy> policy);
 
+  /** \brief get execution context used by the replacement policy
+   */
+  ExecutionContext&
+  getExecutionContext() const
+  {
+    return *m_context;
+  }
+
+  /** \brief change execution context used by the replacement policy
+   *
+   *  Timers already scheduled by the policy keep running on the previous context.
+   */
+  void
+  setExecutionContext(ExecutionContext& context)
+  {
+    m_context = &context;
+  }
+
   /** \brief get CS_ENABLE_ADMIT flag
    *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt#Update-config
    */
@@ -207,6 +226,7 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
 private:
   Table m_table;
+  ExecutionContext* m_context;
   unique_ptr<Policy> m_policy;
   signal::ScopedConnection m_beforeEvictConnection;
 
@@ -42,8 +42,9 @@ const double DeadNonceList::CAPACITY_UP = 1.2;
 const double DeadNonceList::CAPACITY_DOWN = 0.9;
 const size_t DeadNonceList::EVICT_LIMIT = (1 << 6);
 
-DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime)
-  : m_lifetime(lifetime)
+DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime, ExecutionContext& context)
+  : m_context(context)
+  , m_lifetime(lifetime)
   , m_queue(m_index.get<0>())
   , m_ht(m_index.get<1>())
   , m_capacity(INITIAL_CAPACITY)
@@ -58,8 +59,8 @@ DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime)
     m_queue.push_back(MARK);
   }
 
-  m_markEvent = scheduler::schedule(m_markInterval, [this] { mark(); });
-  m_adjustCapacityEvent = scheduler::schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
+  m_markEvent = m_context.schedule(m_markInterval, [this] { mark(); });
+  m_adjustCapacityEvent = m_context.schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
 }
 
 DeadNonceList::~DeadNonceList()
@@ -124,7 +125,7 @@ DeadNonceList::mark()
 
   NFD_LOG_TRACE("mark nMarks=" << nMarks);
 
-  m_markEvent = scheduler::schedule(m_markInterval, [this] { mark(); });
+  m_markEvent = m_context.schedule(m_markInterval, [this] { mark(); });
 }
 
 void
@@ -147,7 +148,7 @@ DeadNonceList::adjustCapacity()
   m_actualMarkCounts.clear();
   this->evictEntries();
 
-  m_adjustCapacityEvent = scheduler::schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
+  m_adjustCapacityEvent = m_context.schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
 }
 
 void
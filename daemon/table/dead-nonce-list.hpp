@@ -30,7 +30,7 @@
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index/hashed_index.hpp>
-#include "core/scheduler.hpp"
+#include "core/execution-context.hpp"
 
 namespace nfd {
 
@@ -59,10 +59,13 @@ public:
    *         must be no less than MIN_LIFETIME.
    *         This should be set to the duration in which most loops would have occured.
    *         A loop cannot be detected if delay of the cycle is greater than lifetime.
+   *  \param context execution context whose scheduler drives the mark and
+   *         capacity adjustment timers
    *  \throw std::invalid_argument if lifetime is less than MIN_LIFETIME
    */
   explicit
-  DeadNonceList(const time::nanoseconds& lifetime = DEFAULT_LIFETIME);
+  DeadNonceList(const time::nanoseconds& lifetime = DEFAULT_LIFETIME,
+                ExecutionContext& context = getGlobalExecutionContext());
 
   ~DeadNonceList();
 
@@ -139,6 +142,7 @@ public:
   static const time::nanoseconds MIN_LIFETIME;
 
 private:
+  ExecutionContext& m_context;
   time::nanoseconds m_lifetime;
   Index m_index;
   Queue& m_queue;
@@ -98,19 +98,29 @@ Fib::insert(const Name& prefix)
 
   nte.setFibEntry(make_unique<Entry>(prefix));
   ++m_nItems;
+  this->afterChange(prefix);
   return {nte.getFibEntry(), true};
 }
 
+void
+Fib::addOrUpdateNextHop(Entry& entry, Face& face, uint64_t endpointId, uint64_t cost)
+{
+  entry.addOrUpdateNextHop(face, endpointId, cost);
+  this->afterChange(entry.getPrefix());
+}
+
 void
 Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 {
   BOOST_ASSERT(nte != nullptr);
 
+  Name prefix = nte->getName();
   nte->setFibEntry(nullptr);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
   }
   --m_nItems;
+  this->afterChange(prefix);
 }
 
 void
@@ -134,26 +144,33 @@ Fib::erase(const Entry& entry)
 }
 
 void
-Fib::eraseIfEmpty(Entry& entry)
+Fib::eraseIfEmpty(Entry& entry, size_t nNextHopsBefore, bool canDeleteNte)
 {
   if (!entry.hasNextHops()) {
     name_tree::Entry* nte = m_nameTree.getEntry(entry);
-    this->erase(nte, false);
+    this->erase(nte, canDeleteNte);
+  }
+  else if (entry.getNextHops().size() != nNextHopsBefore) {
+    this->afterChange(entry.getPrefix());
   }
 }
 
 void
 Fib::removeNextHop(Entry& entry, const Face& face, uint64_t endpointId)
 {
+  size_t nNextHops = entry.getNextHops().size();
   entry.removeNextHop(face, endpointId);
-  this->eraseIfEmpty(entry);
+  this->eraseIfEmpty(entry, nNextHops, true);
 }
 
 void
 Fib::removeNextHopByFace(Entry& entry, const Face& face)
 {
+  size_t nNextHops = entry.getNextHops().size();
   entry.removeNextHopByFace(face);
-  this->eraseIfEmpty(entry);
+  // cleanupOnFaceRemoval calls this while enumerating the NameTree, and erases empty
+  // NameTree entries afterwards
+  this->eraseIfEmpty(entry, nNextHops, false);
 }
 
 Fib::Range
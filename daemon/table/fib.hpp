@@ -99,6 +99,13 @@ public: // mutation
   std::pair<Entry*, bool>
   insert(const Name& prefix);
 
+  /** \brief adds a NextHop record to \p entry, or updates the cost of an existing record
+   *
+   *  Unlike Entry::addOrUpdateNextHop, this emits \p afterChange.
+   */
+  void
+  addOrUpdateNextHop(Entry& entry, Face& face, uint64_t endpointId, uint64_t cost);
+
   void
   erase(const Name& prefix);
 
@@ -106,6 +113,8 @@ public: // mutation
   erase(const Entry& entry);
 
   /** \brief removes the NextHop record for \p face with a given \p endpointId
+   *
+   *  \p entry is erased if it has no NextHop records left.
    */
   void
   removeNextHop(Entry& entry, const Face& face, uint64_t endpointId);
@@ -115,6 +124,13 @@ public: // mutation
   void
   removeNextHopByFace(Entry& entry, const Face& face);
 
+public: // signals
+  /** \brief signals after a FIB entry is inserted or erased, or its nexthops are changed
+   *
+   *  The argument is the entry prefix. Changes made directly on a fib::Entry are not signaled.
+   */
+  signal::Signal<Fib, Name> afterChange;
+
 public: // enumeration
   typedef boost::transformed_range<name_tree::GetTableEntry<Entry>, const name_tree::Range> Range;
   typedef boost::range_iterator<Range>::type const_iterator;
@@ -150,9 +166,12 @@ private:
   erase(name_tree::Entry* nte, bool canDeleteNte = true);
 
   /** \brief erase \p entry if it contains no nexthop record
+   *  \param nNextHopsBefore number of nexthops before a removal, to tell whether
+   *                         \p afterChange should be emitted for a remaining entry
+   *  \param canDeleteNte whether the NameTree entry may be erased if it becomes empty
    */
   void
-  eraseIfEmpty(Entry& entry);
+  eraseIfEmpty(Entry& entry, size_t nNextHopsBefore, bool canDeleteNte);
 
   Range
   getRange() const;
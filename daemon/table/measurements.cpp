@@ -31,8 +31,9 @@
 namespace nfd {
 namespace measurements {
 
-Measurements::Measurements(NameTree& nameTree)
+Measurements::Measurements(NameTree& nameTree, ExecutionContext& context)
   : m_nameTree(nameTree)
+  , m_context(context)
   , m_nItems(0)
 {
 }
@@ -50,7 +51,7 @@ Measurements::get(name_tree::Entry& nte)
   entry = nte.getMeasurementsEntry();
 
   entry->m_expiry = time::steady_clock::now() + getInitialLifetime();
-  entry->m_cleanup = scheduler::schedule(getInitialLifetime(), [=] { cleanup(*entry); });
+  entry->m_cleanup = m_context.schedule(getInitialLifetime(), [=] { cleanup(*entry); });
 
   return *entry;
 }
@@ -136,7 +137,7 @@ Measurements::extendLifetime(Entry& entry, const time::nanoseconds& lifetime)
 
   scheduler::cancel(entry.m_cleanup);
   entry.m_expiry = expiry;
-  entry.m_cleanup = scheduler::schedule(lifetime, [&] { cleanup(entry); });
+  entry.m_cleanup = m_context.schedule(lifetime, [&] { cleanup(entry); });
 }
 
 void
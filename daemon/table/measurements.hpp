@@ -28,6 +28,7 @@
 
 #include "measurements-entry.hpp"
 #include "name-tree.hpp"
+#include "core/execution-context.hpp"
 
 namespace nfd {
 
@@ -79,8 +80,11 @@ public:
 class Measurements : noncopyable
 {
 public:
+  /** \param nameTree the NameTree shared with other tables
+   *  \param context execution context whose scheduler drives entry cleanup
+   */
   explicit
-  Measurements(NameTree& nameTree);
+  Measurements(NameTree& nameTree, ExecutionContext& context = getGlobalExecutionContext());
 
   /** \brief maximum depth of a Measurements entry
    */
@@ -161,6 +165,7 @@ private:
 
 private:
   NameTree& m_nameTree;
+  ExecutionContext& m_context;
   size_t m_nItems;
 };
 
@@ -28,6 +28,10 @@
 
 #include "name-tree-entry.hpp"
 
+#include "core/fib-max-depth.hpp"
+
+#include <boost/container/small_vector.hpp>
+
 namespace nfd {
 namespace name_tree {
 
@@ -38,9 +42,12 @@ class Entry;
 using HashValue = size_t;
 
 /** \brief a sequence of hash values
+ *
+ *  Hash sequences are computed for names no longer than the maximum NameTree depth,
+ *  so they are kept on the stack to avoid a heap allocation on every lookup.
  *  \sa computeHashes
  */
-using HashSequence = std::vector<HashValue>;
+using HashSequence = boost::container::small_vector<HashValue, FIB_MAX_DEPTH + 1>;
 
 /** \brief computes hash value of \p name.getPrefix(prefixLen)
  */
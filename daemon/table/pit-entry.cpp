@@ -35,6 +35,7 @@ Entry::Entry(const Interest& interest)
   , dataFreshnessPeriod(0_ms)
   , m_interest(interest.shared_from_this())
   , m_nameTreeEntry(nullptr)
+  , m_quotaFace(face::INVALID_FACEID)
   ,retxCount(0)  // retransmission count. Jiangtao Luo. 23 Mar 2020
 {
   // initilize timepoints. Jiangtao Luo. 25 Mar
@@ -265,8 +265,10 @@ private:
   OutRecordCollection m_outRecords;
 
   name_tree::Entry* m_nameTreeEntry;
+  FaceId m_quotaFace; ///< face charged for this entry in Pit per-face quota
 
   friend class name_tree::Entry;
+  friend class Pit;
 };
 
 } // namespace pit
@@ -37,11 +37,13 @@ nteHasPitEntries(const name_tree::Entry& nte)
 Pit::Pit(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_limit(0)
+  , m_perFaceLimit(0)
 {
 }
 
 std::pair<shared_ptr<Entry>, bool>
-Pit::findOrInsert(const Interest& interest, bool allowInsert)
+Pit::findOrInsert(const Interest& interest, bool allowInsert, FaceId inFace)
 {
   // determine which NameTree entry should the PIT entry be attached onto
   const Name& name = interest.getName();
@@ -77,20 +79,43 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
     return {nullptr, true};
   }
 
+  // enforce quotas before creating a new entry
+  bool isOverLimit = m_limit > 0 && m_nItems >= m_limit;
+  if (!isOverLimit && m_perFaceLimit > 0 && inFace != face::INVALID_FACEID) {
+    isOverLimit = this->getFaceUsage(inFace) >= m_perFaceLimit;
+  }
+  if (isOverLimit) {
+    m_nameTree.eraseIfEmpty(nte);
+    return {nullptr, false};
+  }
+
   auto entry = make_shared<Entry>(interest);
   nte->insertPitEntry(entry);
   ++m_nItems;
+  if (inFace != face::INVALID_FACEID) {
+    entry->m_quotaFace = inFace;
+    ++m_faceUsage[inFace];
+  }
   return {entry, true};
 }
 
+size_t
+Pit::getFaceUsage(FaceId face) const
+{
+  auto it = m_faceUsage.find(face);
+  return it == m_faceUsage.end() ? 0 : it->second;
+}
+
 DataMatchResult
 Pit::findAllDataMatches(const Data& data) const
 {
-  auto&& ntMatches = m_nameTree.findAllMatches(data.getName(), &nteHasPitEntries);
+  // every ancestor of the longest prefix match is also a prefix of Data name,
+  // so parent links enumerate all matches without allocating a NameTree range
+  const name_tree::Entry* nte = m_nameTree.findLongestPrefixMatch(data.getName(), &nteHasPitEntries);
 
   DataMatchResult matches;
-  for (const name_tree::Entry& nte : ntMatches) {
-    for (const shared_ptr<Entry>& pitEntry : nte.getPitEntries()) {
+  for (; nte != nullptr; nte = nte->getParent()) {
+    for (const shared_ptr<Entry>& pitEntry : nte->getPitEntries()) {
       if (pitEntry->getInterest().matchesData(data))
         matches.emplace_back(pitEntry);
     }
@@ -105,6 +130,14 @@ Pit::erase(Entry* entry, bool canDeleteNte)
   name_tree::Entry* nte = m_nameTree.getEntry(*entry);
   BOOST_ASSERT(nte != nullptr);
 
+  if (entry->m_quotaFace != face::INVALID_FACEID) {
+    auto it = m_faceUsage.find(entry->m_quotaFace);
+    BOOST_ASSERT(it != m_faceUsage.end() && it->second > 0);
+    if (--it->second == 0) {
+      m_faceUsage.erase(it);
+    }
+  }
+
   nte->erasePitEntry(entry);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
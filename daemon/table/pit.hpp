@@ -29,6 +29,8 @@
 #include "pit-entry.hpp"
 #include "pit-iterator.hpp"
 
+#include <boost/container/small_vector.hpp>
+
 namespace nfd {
 namespace pit {
 
@@ -39,8 +41,11 @@ namespace pit {
  *  - `iterator<shared_ptr<Entry>> begin()`
  *  - `iterator<shared_ptr<Entry>> end()`
  *  - `size_t size() const`
+ *
+ *  Up to eight matches are stored inline, so that the common case
+ *  does not allocate from the heap.
  */
-using DataMatchResult = std::vector<shared_ptr<Entry>>;
+using DataMatchResult = boost::container::small_vector<shared_ptr<Entry>, 8>;
 
 /** \brief represents the Interest Table
  */
@@ -71,16 +76,33 @@ public:
   /** \brief inserts a PIT entry for Interest
    *  \param interest the Interest; must be created with make_shared
    *  \return a new or existing entry with same Name and Selectors,
-   *          and true for new entry, false for existing entry
+   *          and true for new entry, false for existing entry;
+   *          or {nullptr, false} if a new entry would exceed the global limit
    */
   std::pair<shared_ptr<Entry>, bool>
   insert(const Interest& interest)
   {
-    return this->findOrInsert(interest, true);
+    return this->findOrInsert(interest, true, face::INVALID_FACEID);
+  }
+
+  /** \brief inserts a PIT entry for Interest, charging a new entry to \p inFace
+   *  \param interest the Interest; must be created with make_shared
+   *  \param inFace the face whose per-face quota is charged if a new entry is created
+   *  \return a new or existing entry with same Name and Selectors,
+   *          and true for new entry, false for existing entry;
+   *          or {nullptr, false} if a new entry would exceed the global or per-face limit
+   */
+  std::pair<shared_ptr<Entry>, bool>
+  insert(const Interest& interest, FaceId inFace)
+  {
+    return this->findOrInsert(interest, true, inFace);
   }
 
   /** \brief performs a Data match
    *  \return an iterable of all PIT entries matching data
+   *
+   *  The NameTree is walked upwards from the longest matching prefix through parent links,
+   *  so no enumeration state is allocated.
    */
   DataMatchResult
   findAllDataMatches(const Data& data) const;
@@ -98,6 +120,52 @@ public:
   void
   deleteInOutRecords(Entry* entry, const Face& face);
 
+public: // quota
+  /** \return maximum number of entries, or 0 if unlimited
+   */
+  size_t
+  getLimit() const
+  {
+    return m_limit;
+  }
+
+  /** \brief sets maximum number of entries
+   *  \param nMaxEntries maximum number of entries, or 0 for unlimited
+   *
+   *  Existing entries are not evicted when the limit is lowered;
+   *  the limit only applies to subsequent insertions.
+   */
+  void
+  setLimit(size_t nMaxEntries)
+  {
+    m_limit = nMaxEntries;
+  }
+
+  /** \return maximum number of entries charged to a single face, or 0 if unlimited
+   */
+  size_t
+  getPerFaceLimit() const
+  {
+    return m_perFaceLimit;
+  }
+
+  /** \brief sets maximum number of entries charged to a single face
+   *  \param nMaxEntries maximum number of entries per face, or 0 for unlimited
+   *
+   *  A new entry is charged to the face that triggered its creation,
+   *  until the entry is deleted.
+   */
+  void
+  setPerFaceLimit(size_t nMaxEntries)
+  {
+    m_perFaceLimit = nMaxEntries;
+  }
+
+  /** \return number of entries charged to \p face
+   */
+  size_t
+  getFaceUsage(FaceId face) const;
+
 public: // enumeration
   typedef Iterator const_iterator;
 
@@ -125,17 +193,22 @@ private:
   /** \brief finds or inserts a PIT entry for Interest
    *  \param interest the Interest; must be created with make_shared if allowInsert
    *  \param allowInsert whether inserting new entry is allowed.
+   *  \param inFace face charged for a new entry; INVALID_FACEID is exempt from per-face limit
    *  \return if allowInsert, a new or existing entry with same Name+Selectors,
-   *          and true for new entry, false for existing entry;
+   *          and true for new entry, false for existing entry,
+   *          or {nullptr, false} if a new entry would exceed a limit;
    *          if not allowInsert, an existing entry with same Name+Selectors and false,
    *          or {nullptr, true} if there's no existing entry
    */
   std::pair<shared_ptr<Entry>, bool>
-  findOrInsert(const Interest& interest, bool allowInsert);
+  findOrInsert(const Interest& interest, bool allowInsert, FaceId inFace = face::INVALID_FACEID);
 
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  size_t m_limit;
+  size_t m_perFaceLimit;
+  std::unordered_map<FaceId, size_t> m_faceUsage;
 };
 
 } // namespace pit
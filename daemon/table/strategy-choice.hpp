@@ -152,6 +152,13 @@ public: // effective strategy
   fw::Strategy&
   findEffectiveStrategy(const measurements::Entry& measurementsEntry) const;
 
+public: // signals
+  /** \brief signals after the strategy of a prefix is set or unset
+   *
+   *  The argument is the prefix. Setting the strategy that a prefix already has is not signaled.
+   */
+  signal::Signal<StrategyChoice, Name> afterChange;
+
 public: // enumeration
   typedef boost::transformed_range<name_tree::GetTableEntry<Entry>, const name_tree::Range> Range;
   typedef boost::range_iterator<Range>::type const_iterator;
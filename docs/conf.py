@@ -168,6 +168,7 @@ man_pages = [
     ('manpages/nfdc-route', 'nfdc-route', u'Show and manipulate NFD routes', '', 1),
     ('manpages/nfdc-cs', 'nfdc-cs', u'Show and manipulate NFD Content Store', '', 1),
     ('manpages/nfdc-strategy', 'nfdc-strategy', u'Show and manipulate NFD strategy choices', '', 1),
+    ('manpages/nfdc-batch', 'nfdc-batch', u'Execute many nfdc commands over one connection', '', 1),
     ('manpages/nfd-status', 'nfd-status', u'Comprehensive report of NFD status', '', 1),
     ('manpages/nfd-status-http-server', 'nfd-status-http-server', u'NFD status HTTP server', '', 1),
     ('manpages/ndn-autoconfig-server', 'ndn-autoconfig-server', u'NDN auto-configuration server', '', 1),
@@ -175,6 +176,7 @@ man_pages = [
     ('manpages/ndn-autoconfig.conf', 'ndn-autoconfig.conf', u'NDN auto-configuration client configuration file', '', 5),
     ('manpages/nfd-autoreg', 'nfd-autoreg', u'NFD auto-registration server', '', 1),
     ('manpages/nfd-asf-strategy', 'nfd-asf-strategy', u'NFD ASF strategy', '', 7),
+    ('manpages/nfd-multipath-strategy', 'nfd-multipath-strategy', u'NFD multipath strategy', '', 7),
 ]
 
 
@@ -64,6 +64,36 @@ FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
   sendUpdatesForBatchFaceId(onSuccess, onFailure);
 }
 
+void
+FibUpdater::computeAndSendFibUpdatesForRemovedFace(const RibUpdateBatch& batch,
+                                                   const RibUpdateApplier& applyUpdate,
+                                                   const FibUpdateSuccessCallback& onSuccess,
+                                                   const FibUpdateFailureCallback& onFailure)
+{
+  m_batchFaceId = batch.getFaceId();
+
+  m_inheritedRoutes.clear();
+  m_updatesForBatchFaceId.clear();
+  m_updatesForNonBatchFaceId.clear();
+
+  NFD_LOG_DEBUG("Computing updates for " << batch.size() << " routes of removed face: " <<
+                m_batchFaceId);
+
+  for (const RibUpdate& update : batch) {
+    BOOST_ASSERT(update.getAction() == RibUpdate::REMOVE_FACE);
+    computeUpdatesForUnregistration(update);
+
+    // Do not apply updates with the same face ID as the destroyed face
+    // since they will be rejected by the FIB
+    m_updatesForBatchFaceId.clear();
+
+    applyUpdate(update, m_inheritedRoutes);
+    m_inheritedRoutes.clear();
+  }
+
+  sendUpdatesForNonBatchFaceId(onSuccess, onFailure);
+}
+
 void
 FibUpdater::computeUpdates(const RibUpdateBatch& batch)
 {
@@ -125,19 +155,8 @@ FibUpdater::computeUpdatesForRegistration(const RibUpdate& update)
   }
   else {
     // New name in RIB
-    // Find prefix's parent
-    shared_ptr<RibEntry> parent = m_rib.findParent(prefix);
-
-    Rib::RibEntryList descendants = m_rib.findDescendantsForNonInsertedName(prefix);
-    Rib::RibEntryList children;
-
-    for (const auto& descendant : descendants) {
-      // If the child has the same parent as the new entry,
-      // the new entry must be the child's new parent
-      if (descendant->getParent() == parent) {
-        children.push_back(descendant);
-      }
-    }
+    // The new entry will be the new parent of the nearest entries under prefix
+    Rib::RibEntryList children = m_rib.findChildren(prefix);
 
     createFibUpdatesForNewRibEntry(prefix, route, children);
   }
@@ -193,6 +212,11 @@ FibUpdater::sendUpdates(const FibUpdateList& updates,
   std::string updateString = (updates.size() == 1) ? " update" : " updates";
   NFD_LOG_DEBUG("Applying " << updates.size() << updateString << " to FIB");
 
+  if (m_localFibApplier != nullptr) {
+    applyUpdatesLocally(updates, onSuccess, onFailure);
+    return;
+  }
+
   for (const FibUpdate& update : updates) {
     NFD_LOG_DEBUG("Sending FIB update: " << update);
 
@@ -205,6 +229,46 @@ FibUpdater::sendUpdates(const FibUpdateList& updates,
   }
 }
 
+void
+FibUpdater::applyUpdatesLocally(const FibUpdateList& updates,
+                                const FibUpdateSuccessCallback& onSuccess,
+                                const FibUpdateFailureCallback& onFailure)
+{
+  bool isBatchFaceIdList = &updates == &m_updatesForBatchFaceId;
+
+  for (const FibUpdate& update : updates) {
+    NFD_LOG_DEBUG("Applying FIB update locally: " << update);
+
+    uint32_t code = m_localFibApplier(update);
+    if (code == 200) {
+      continue;
+    }
+
+    NFD_LOG_DEBUG("Failed to apply " << update << " (code: " << code << ")");
+
+    if (code == ERROR_FACE_NOT_FOUND) {
+      if (update.faceId == m_batchFaceId) {
+        onFailure(code, "Face not found");
+        return;
+      }
+      // Updates for other faces that no longer exist are ignored
+    }
+    else {
+      BOOST_THROW_EXCEPTION(Error("Non-recoverable error applying FIB update, code: " +
+                                  to_string(code)));
+    }
+  }
+
+  if (isBatchFaceIdList) {
+    m_updatesForBatchFaceId.clear();
+    sendUpdatesForNonBatchFaceId(onSuccess, onFailure);
+  }
+  else {
+    m_updatesForNonBatchFaceId.clear();
+    onSuccess(m_inheritedRoutes);
+  }
+}
+
 void
 FibUpdater::sendUpdatesForBatchFaceId(const FibUpdateSuccessCallback& onSuccess,
                                       const FibUpdateFailureCallback& onFailure)
@@ -645,50 +709,64 @@ FibUpdater::modifyChildrensInheritedRoutes(const Rib::RibEntryList& children,
 }
 
 void
-FibUpdater::traverseSubTree(const RibEntry& entry, Rib::Rib::RouteSet routesToAdd,
-                            Rib::Rib::RouteSet routesToRemove)
+FibUpdater::traverseSubTree(const RibEntry& entry, const Rib::RouteSet& routesToAdd,
+                            const Rib::RouteSet& routesToRemove)
 {
+  // Nothing changes in this subtree
+  if (routesToAdd.empty() && routesToRemove.empty()) {
+    return;
+  }
+
   // If a route on the namespace has the capture flag set, ignore self and children
   if (entry.hasCapture()) {
     return;
   }
 
+  // Routes that this namespace overrides are not passed on to its children;
+  // the sets are only copied when such a route exists
+  optional<Rib::RouteSet> childRoutesToRemove;
+  optional<Rib::RouteSet> childRoutesToAdd;
+
   // Remove inherited routes from current namespace
-  for (auto removeIt = routesToRemove.begin(); removeIt != routesToRemove.end(); ) {
+  for (const Route& route : routesToRemove) {
     // If a route on the namespace has the same face ID and child inheritance set,
     // ignore this route
-    if (entry.hasChildInheritOnFaceId(removeIt->faceId)) {
-      removeIt = routesToRemove.erase(removeIt);
+    if (entry.hasChildInheritOnFaceId(route.faceId)) {
+      if (!childRoutesToRemove) {
+        childRoutesToRemove = routesToRemove;
+      }
+      childRoutesToRemove->erase(route);
       continue;
     }
 
     // Only remove route if it removes an existing inherited route
-    if (entry.hasInheritedRoute(*removeIt)) {
-      removeInheritedRoute(entry.getName(), *removeIt);
-      addFibUpdate(FibUpdate::createRemoveUpdate(entry.getName(), removeIt->faceId));
+    if (entry.hasInheritedRoute(route)) {
+      removeInheritedRoute(entry.getName(), route);
+      addFibUpdate(FibUpdate::createRemoveUpdate(entry.getName(), route.faceId));
     }
-
-    ++removeIt;
   }
 
   // Add inherited routes to current namespace
-  for (auto addIt = routesToAdd.begin(); addIt != routesToAdd.end(); ) {
+  for (const Route& route : routesToAdd) {
     // If a route on the namespace has the same face ID and child inherit set, ignore this face
-    if (entry.hasChildInheritOnFaceId(addIt->faceId)) {
-      addIt = routesToAdd.erase(addIt);
+    if (entry.hasChildInheritOnFaceId(route.faceId)) {
+      if (!childRoutesToAdd) {
+        childRoutesToAdd = routesToAdd;
+      }
+      childRoutesToAdd->erase(route);
       continue;
     }
 
     // Only add route if it does not override an existing route
-    if (!entry.hasFaceId(addIt->faceId)) {
-      addInheritedRoute(entry.getName(), *addIt);
-      addFibUpdate(FibUpdate::createAddUpdate(entry.getName(), addIt->faceId, addIt->cost));
+    if (!entry.hasFaceId(route.faceId)) {
+      addInheritedRoute(entry.getName(), route);
+      addFibUpdate(FibUpdate::createAddUpdate(entry.getName(), route.faceId, route.cost));
     }
-
-    ++addIt;
   }
 
-  modifyChildrensInheritedRoutes(entry.getChildren(), routesToAdd, routesToRemove);
+  modifyChildrensInheritedRoutes(entry.getChildren(),
+                                 childRoutesToAdd ? *childRoutesToAdd : routesToAdd,
+                                 childRoutesToRemove ? *childRoutesToRemove : routesToRemove);
 }
 
 void
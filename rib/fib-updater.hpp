@@ -56,9 +56,28 @@ public:
 
   typedef std::function<void(RibUpdateList inheritedRoutes)> FibUpdateSuccessCallback;
   typedef std::function<void(uint32_t code, const std::string& error)> FibUpdateFailureCallback;
+  typedef std::function<void(const RibUpdate& update,
+                             const RibUpdateList& inheritedRoutes)> RibUpdateApplier;
+
+  /** \brief applies a FibUpdate to a forwarder in the same process
+   *  \return status code, as returned by the fib/add-nexthop or fib/remove-nexthop command
+   */
+  typedef std::function<uint32_t(const FibUpdate& update)> LocalFibApplier;
 
   FibUpdater(Rib& rib, ndn::nfd::Controller& controller);
 
+  /** \brief applies FibUpdates through \p applier instead of sending commands to NFD
+   *
+   *  When the forwarder runs in the same process, this avoids signing and dispatching a
+   *  command Interest for every FibUpdate: each list of updates is applied synchronously
+   *  in a single pass. An empty \p applier restores the use of commands.
+   */
+  void
+  setLocalFibApplier(const LocalFibApplier& applier)
+  {
+    m_localFibApplier = applier;
+  }
+
   /** \brief computes FibUpdates using the provided RibUpdateBatch and then sends the
    *         updates to NFD's FIB
    *
@@ -70,6 +89,26 @@ public:
                            const FibUpdateSuccessCallback& onSuccess,
                            const FibUpdateFailureCallback& onFailure);
 
+  /** \brief computes FibUpdates for the REMOVE_FACE updates of a destroyed face and then
+   *         sends them to NFD's FIB
+   *
+   *  The routes of a face may be in the same namespace, so updates are computed one at a
+   *  time and \p applyUpdate is invoked after each of them, with the inherited routes
+   *  calculated for it, to remove the route from the RIB before the next one is computed.
+   *  FibUpdates for the destroyed face itself are dropped since NFD has already removed its
+   *  nexthops; the FibUpdates for other faces are coalesced and sent together.
+   *
+   *  \note The RIB is modified regardless of whether sending the FibUpdates succeeds;
+   *        onSuccess receives an empty list of inherited routes.
+   *  \note Caller must guarantee that the previous batch has either succeeded or failed
+   *         before calling this method
+   */
+  void
+  computeAndSendFibUpdatesForRemovedFace(const RibUpdateBatch& batch,
+                                         const RibUpdateApplier& applyUpdate,
+                                         const FibUpdateSuccessCallback& onSuccess,
+                                         const FibUpdateFailureCallback& onFailure);
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief determines the type of action that will be performed on the RIB and calls the
   *          corresponding computation method
@@ -82,14 +121,27 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   *   onSuccess or onFailure will be called based on the results in
   *   onUpdateSuccess or onUpdateFailure
   *
+  *   If a LocalFibApplier is set, the updates are applied through it instead.
+  *
   *   \see FibUpdater::onUpdateSuccess
   *   \see FibUpdater::onUpdateFailure
+  *   \see FibUpdater::applyUpdatesLocally
   */
   void
   sendUpdates(const FibUpdateList& updates,
               const FibUpdateSuccessCallback& onSuccess,
               const FibUpdateFailureCallback& onFailure);
 
+  /** \brief applies the passed updates through the LocalFibApplier in a single pass
+  *
+  *   Results are handled the same way as command responses in onUpdateError, except
+  *   that there are no timeouts to retry.
+  */
+  void
+  applyUpdatesLocally(const FibUpdateList& updates,
+                      const FibUpdateSuccessCallback& onSuccess,
+                      const FibUpdateFailureCallback& onFailure);
+
   /** \brief sends the updates in m_updatesForBatchFaceId to NFD if any exist,
   *          otherwise calls FibUpdater::sendUpdatesForNonBatchFaceId.
   */
@@ -239,9 +291,12 @@ private:
                                  const Rib::RouteSet& routesToRemove);
 
   /** \brief traverses the entry's children adding and removing the passed routes
+  *
+  *   The traversal stops at subtrees where no route is left to add or remove.
   */
   void
-  traverseSubTree(const RibEntry& entry, Rib::RouteSet routesToAdd, Rib::RouteSet routesToRemove);
+  traverseSubTree(const RibEntry& entry, const Rib::RouteSet& routesToAdd,
+                  const Rib::RouteSet& routesToRemove);
 
 private:
   /** \brief creates a record of a calculated inherited route that should be added to the entry
@@ -257,6 +312,7 @@ private:
 private:
   const Rib& m_rib;
   ndn::nfd::Controller& m_controller;
+  LocalFibApplier m_localFibApplier;
   uint64_t m_batchFaceId;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
@@ -25,7 +25,6 @@
 
 #include "readvertise.hpp"
 #include "core/logger.hpp"
-#include "core/random.hpp"
 
 namespace nfd {
 namespace rib {
@@ -35,18 +34,12 @@ NFD_LOG_INIT(Readvertise);
 const time::milliseconds Readvertise::RETRY_DELAY_MIN = 50_s;
 const time::milliseconds Readvertise::RETRY_DELAY_MAX = 3600_s;
 
-static time::milliseconds
-randomizeTimer(time::milliseconds baseTimer)
-{
-  std::uniform_int_distribution<uint64_t> dist(-5, 5);
-  time::milliseconds newTime = baseTimer + time::milliseconds(dist(getGlobalRng()));
-  return std::max(newTime, 0_ms);
-}
-
 Readvertise::Readvertise(Rib& rib, ndn::util::Scheduler& scheduler,
                          unique_ptr<ReadvertisePolicy> policy,
-                         unique_ptr<ReadvertiseDestination> destination)
+                         unique_ptr<ReadvertiseDestination> destination,
+                         ExecutionContext& context)
   : m_scheduler(scheduler)
+  , m_context(context)
   , m_policy(std::move(policy))
   , m_destination(std::move(destination))
 {
@@ -63,6 +56,24 @@ Readvertise::Readvertise(Rib& rib, ndn::util::Scheduler& scheduler,
   });
 }
 
+time::milliseconds
+Readvertise::randomizeTimer(time::milliseconds baseTimer)
+{
+  std::uniform_int_distribution<uint64_t> dist(-5, 5);
+  time::milliseconds newTime = baseTimer + time::milliseconds(dist(m_context.getRng()));
+  return std::max(newTime, 0_ms);
+}
+
+void
+Readvertise::setPacingOptions(const PacingOptions& options)
+{
+  BOOST_ASSERT(options.maxBurst > 0);
+  m_pacing = options;
+  m_nTokens = static_cast<double>(m_pacing.maxBurst);
+  m_lastRefill = time::steady_clock::now();
+  this->processPending();
+}
+
 void
 Readvertise::afterAddRoute(const RibRouteRef& ribRoute)
 {
@@ -98,7 +109,7 @@ Readvertise::afterAddRoute(const RibRouteRef& ribRoute)
                 ',' << ribRoute.route->origin << ") readvertising-as " << action->prefix <<
                 " signer " << action->signer);
   rrIt->retryDelay = RETRY_DELAY_MIN;
-  this->advertise(rrIt);
+  this->scheduleUpdate(rrIt);
 }
 
 void
@@ -121,7 +132,7 @@ Readvertise::beforeRemoveRoute(const RibRouteRef& ribRoute)
   }
 
   rrIt->retryDelay = RETRY_DELAY_MIN;
-  this->withdraw(rrIt);
+  this->scheduleUpdate(rrIt);
 }
 
 void
@@ -129,14 +140,23 @@ Readvertise::afterDestinationAvailable()
 {
   for (auto rrIt = m_rrs.begin(); rrIt != m_rrs.end(); ++rrIt) {
     rrIt->retryDelay = RETRY_DELAY_MIN;
-    this->advertise(rrIt);
+    if (!rrIt->isPending) {
+      this->requestUpdate(rrIt);
+    }
   }
 }
 
 void
 Readvertise::afterDestinationUnavailable()
 {
+  // everything is advertised again when the destination becomes available
+  m_holding.clear();
+  m_ready.clear();
+  m_processEvt.cancel();
+
   for (auto rrIt = m_rrs.begin(); rrIt != m_rrs.end();) {
+    rrIt->isAdvertised = false;
+    rrIt->isPending = false;
     if (rrIt->nRibRoutes > 0) {
       rrIt->retryEvt.cancel(); // stop retrying or refreshing
       ++rrIt;
@@ -147,6 +167,117 @@ Readvertise::afterDestinationUnavailable()
   }
 }
 
+void
+Readvertise::scheduleUpdate(ReadvertisedRouteContainer::iterator rrIt)
+{
+  if (!this->isPacingEnabled()) {
+    this->sendUpdate(rrIt);
+    return;
+  }
+
+  if (rrIt->isPending) {
+    NFD_LOG_DEBUG("schedule " << rrIt->prefix << " coalesced");
+    ++m_counters.nCoalesced;
+    return;
+  }
+
+  rrIt->isPending = true;
+  rrIt->holdUntil = time::steady_clock::now() + m_pacing.coalesceWindow;
+  m_holding.push_back(rrIt);
+  this->processPending();
+}
+
+void
+Readvertise::requestUpdate(ReadvertisedRouteContainer::iterator rrIt)
+{
+  if (rrIt->isPending) {
+    return; // the pending command takes care of it
+  }
+
+  if (!this->isPacingEnabled()) {
+    this->sendUpdate(rrIt);
+    return;
+  }
+
+  rrIt->isPending = true;
+  m_ready.push_back(rrIt);
+  this->processPending();
+}
+
+void
+Readvertise::processPending()
+{
+  auto now = time::steady_clock::now();
+
+  while (!m_holding.empty() && m_holding.front()->holdUntil <= now) {
+    auto rrIt = m_holding.front();
+    m_holding.pop_front();
+
+    bool isNeeded = rrIt->nRibRoutes > 0;
+    if (isNeeded != rrIt->isAdvertised) {
+      m_ready.push_back(rrIt);
+      continue;
+    }
+
+    // changes within the window have canceled each other
+    NFD_LOG_DEBUG("schedule " << rrIt->prefix << " canceled");
+    ++m_counters.nCoalesced;
+    rrIt->isPending = false;
+    if (!isNeeded) {
+      m_rrs.erase(rrIt);
+    }
+  }
+
+  bool isRateLimited = m_pacing.maxRate > 0.0;
+  if (isRateLimited) {
+    time::duration<double> elapsed = now - m_lastRefill;
+    m_nTokens = std::min(static_cast<double>(m_pacing.maxBurst),
+                         m_nTokens + elapsed.count() * m_pacing.maxRate);
+    m_lastRefill = now;
+  }
+
+  while (!m_ready.empty() && (!isRateLimited || m_nTokens >= 1.0)) {
+    auto rrIt = m_ready.front();
+    m_ready.pop_front();
+    if (isRateLimited) {
+      m_nTokens -= 1.0;
+    }
+    rrIt->isPending = false;
+    this->sendUpdate(rrIt);
+  }
+
+  time::nanoseconds delay = time::nanoseconds::max();
+  if (!m_ready.empty()) { // wait for the next token
+    delay = time::duration_cast<time::nanoseconds>(
+              time::duration<double>((1.0 - m_nTokens) / m_pacing.maxRate));
+  }
+  if (!m_holding.empty()) { // wait for the end of the next coalescing window
+    delay = std::min<time::nanoseconds>(delay, m_holding.front()->holdUntil - now);
+  }
+
+  if (delay == time::nanoseconds::max()) {
+    m_processEvt.cancel();
+  }
+  else {
+    m_processEvt = m_scheduler.scheduleEvent(delay, [this] { processPending(); });
+  }
+}
+
+void
+Readvertise::sendUpdate(ReadvertisedRouteContainer::iterator rrIt)
+{
+  if (rrIt->nRibRoutes > 0) {
+    this->advertise(rrIt);
+  }
+  else if (rrIt->isAdvertised) {
+    this->withdraw(rrIt);
+  }
+  else {
+    NFD_LOG_DEBUG("withdraw " << rrIt->prefix << " not-advertised");
+    m_rrs.erase(rrIt);
+  }
+}
+
 void
 Readvertise::advertise(ReadvertisedRouteContainer::iterator rrIt)
 {
@@ -157,18 +288,20 @@ Readvertise::advertise(ReadvertisedRouteContainer::iterator rrIt)
     return;
   }
 
+  rrIt->isAdvertised = true;
+  ++m_counters.nEmitted;
   m_destination->advertise(*rrIt,
     [=] {
       NFD_LOG_DEBUG("advertise " << rrIt->prefix << " success");
       rrIt->retryDelay = RETRY_DELAY_MIN;
       rrIt->retryEvt = m_scheduler.scheduleEvent(randomizeTimer(m_policy->getRefreshInterval()),
-                                                 [=] { advertise(rrIt); });
+                                                 [=] { requestUpdate(rrIt); });
     },
     [=] (const std::string& msg) {
       NFD_LOG_DEBUG("advertise " << rrIt->prefix << " failure " << msg);
       rrIt->retryDelay = std::min(RETRY_DELAY_MAX, rrIt->retryDelay * 2);
       rrIt->retryEvt = m_scheduler.scheduleEvent(randomizeTimer(rrIt->retryDelay),
-                                                 [=] { advertise(rrIt); });
+                                                 [=] { requestUpdate(rrIt); });
     });
 }
 
@@ -183,16 +316,27 @@ Readvertise::withdraw(ReadvertisedRouteContainer::iterator rrIt)
     return;
   }
 
+  rrIt->retryEvt.cancel(); // stop refreshing
+  ++m_counters.nEmitted;
   m_destination->withdraw(*rrIt,
     [=] {
       NFD_LOG_DEBUG("withdraw " << rrIt->prefix << " success");
-      m_rrs.erase(rrIt);
+      rrIt->isAdvertised = false;
+      if (rrIt->nRibRoutes > 0) {
+        // needed again while withdrawing: the destination no longer has the prefix, even if
+        // the re-addition was coalesced away or an advertise was sent before this response
+        this->requestUpdate(rrIt);
+        return;
+      }
+      if (!rrIt->isPending) {
+        m_rrs.erase(rrIt);
+      }
     },
     [=] (const std::string& msg) {
       NFD_LOG_DEBUG("withdraw " << rrIt->prefix << " failure " << msg);
       rrIt->retryDelay = std::min(RETRY_DELAY_MAX, rrIt->retryDelay * 2);
       rrIt->retryEvt = m_scheduler.scheduleEvent(randomizeTimer(rrIt->retryDelay),
-                                                 [=] { withdraw(rrIt); });
+                                                 [=] { requestUpdate(rrIt); });
     });
 }
 
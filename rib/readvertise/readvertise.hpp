@@ -31,6 +31,11 @@
 #include "readvertised-route.hpp"
 #include "../rib.hpp"
 
+#include "core/counter.hpp"
+#include "core/execution-context.hpp"
+
+#include <deque>
+
 namespace nfd {
 namespace rib {
 
@@ -45,10 +50,47 @@ class Readvertise : noncopyable
 {
 
 public:
+  /** \brief options of the coalescing and rate limiting stage
+   *
+   *  Changes of a readvertised prefix are held for \p coalesceWindow, so that an advertise
+   *  and a withdraw of the same prefix within the window cancel each other. Commands that
+   *  survive, as well as refreshes and retries, are sent through a token bucket that allows
+   *  \p maxBurst commands back to back and \p maxRate commands per second on average.
+   */
+  struct PacingOptions
+  {
+    time::milliseconds coalesceWindow = 0_ms; ///< zero sends each change immediately
+    double maxRate = 0.0; ///< commands per second; zero means unlimited
+    size_t maxBurst = 1;
+  };
+
+  struct Counters
+  {
+    PacketCounter nCoalesced; ///< route changes that did not need a command of their own
+    PacketCounter nEmitted; ///< advertise and withdraw commands sent to the destination
+  };
+
+public:
+  /** \param context provides the RNG that jitters refresh and retry timers
+   */
   Readvertise(Rib& rib,
               ndn::util::Scheduler& scheduler,
               unique_ptr<ReadvertisePolicy> policy,
-              unique_ptr<ReadvertiseDestination> destination);
+              unique_ptr<ReadvertiseDestination> destination,
+              ExecutionContext& context = getGlobalExecutionContext());
+
+  /** \brief changes the coalescing and rate limiting options
+   *
+   *  By default, changes are neither coalesced nor rate limited.
+   */
+  void
+  setPacingOptions(const PacingOptions& options);
+
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
+  }
 
 private:
   void
@@ -63,12 +105,45 @@ private:
   void
   afterDestinationUnavailable();
 
+  bool
+  isPacingEnabled() const
+  {
+    return m_pacing.coalesceWindow > 0_ms || m_pacing.maxRate > 0.0;
+  }
+
+  /** \brief sends the command needed after a RIB change, after the coalescing window
+   */
+  void
+  scheduleUpdate(ReadvertisedRouteContainer::iterator rrIt);
+
+  /** \brief sends the command needed for a refresh or a retry, subject to the rate limit
+   */
+  void
+  requestUpdate(ReadvertisedRouteContainer::iterator rrIt);
+
+  /** \brief moves routes whose coalescing window has ended to the ready queue,
+   *         and sends ready commands while tokens are available
+   */
+  void
+  processPending();
+
+  /** \brief advertises or withdraws the route, according to whether RIB routes still need it
+   */
+  void
+  sendUpdate(ReadvertisedRouteContainer::iterator rrIt);
+
   void
   advertise(ReadvertisedRouteContainer::iterator rrIt);
 
   void
   withdraw(ReadvertisedRouteContainer::iterator rrIt);
 
+  /** \return \p baseTimer with a small random offset, so that timers of many routes
+   *          do not fire together
+   */
+  time::milliseconds
+  randomizeTimer(time::milliseconds baseTimer);
+
 private:
   /** \brief maps from RIB route to readvertised route derived from RIB route(s)
    */
@@ -78,12 +153,21 @@ private:
   static const time::milliseconds RETRY_DELAY_MAX;
 
   ndn::util::Scheduler& m_scheduler;
+  ExecutionContext& m_context;
   unique_ptr<ReadvertisePolicy> m_policy;
   unique_ptr<ReadvertiseDestination> m_destination;
 
   ReadvertisedRouteContainer m_rrs;
   RouteRrIndex m_routeToRr;
 
+  PacingOptions m_pacing;
+  std::deque<ReadvertisedRouteContainer::iterator> m_holding; ///< in coalescing window
+  std::deque<ReadvertisedRouteContainer::iterator> m_ready; ///< waiting for a token
+  double m_nTokens = 0.0;
+  time::steady_clock::TimePoint m_lastRefill;
+  ndn::util::scheduler::ScopedEventId m_processEvt;
+  Counters m_counters;
+
   signal::ScopedConnection m_addRouteConn;
   signal::ScopedConnection m_removeRouteConn;
 };
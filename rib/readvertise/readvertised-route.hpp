@@ -53,6 +53,9 @@ public:
   mutable size_t nRibRoutes; ///< number of RIB routes that cause the readvertisement
   mutable time::milliseconds retryDelay; ///< retry interval (not used for refresh)
   mutable ndn::util::scheduler::ScopedEventId retryEvt; ///< retry or refresh event
+  mutable bool isAdvertised = false; ///< whether the destination may have the prefix
+  mutable bool isPending = false; ///< whether a command is held for coalescing or rate limiting
+  mutable time::steady_clock::TimePoint holdUntil; ///< end of the coalescing window
 };
 
 inline bool
@@ -44,6 +44,13 @@ static const std::string MGMT_MODULE_NAME = "rib";
 static const Name LOCALHOST_TOP_PREFIX = "/localhost/nfd";
 static const time::seconds ACTIVE_FACE_FETCH_INTERVAL = 5_min;
 
+/** \brief how long a cached rib/list dataset may be served
+ *
+ *  The dataset contains the remaining lifetime of each route, which decreases
+ *  without changing the RIB.
+ */
+static const time::milliseconds RIB_LIST_MAX_AGE = 1_s;
+
 const Name RibManager::LOCALHOP_TOP_PREFIX = "/localhop/nfd";
 
 RibManager::RibManager(Rib& rib, ndn::Face& face, ndn::KeyChain& keyChain,
@@ -59,6 +66,7 @@ RibManager::RibManager(Rib& rib, ndn::Face& face, ndn::KeyChain& keyChain,
   , m_localhostValidator(face)
   , m_localhopValidator(face)
   , m_isLocalhopEnabled(false)
+  , m_listCache(RIB_LIST_MAX_AGE)
 {
   registerCommandHandler<ndn::nfd::RibRegisterCommand>("register",
     bind(&RibManager::registerEntry, this, _2, _3, _4, _5));
@@ -66,6 +74,15 @@ RibManager::RibManager(Rib& rib, ndn::Face& face, ndn::KeyChain& keyChain,
     bind(&RibManager::unregisterEntry, this, _2, _3, _4, _5));
 
   registerStatusDatasetHandler("list", bind(&RibManager::listEntries, this, _1, _2, _3));
+  registerChangeDatasetHandler("changes", [this] { return m_changeLog.getVersion(); },
+                               bind(&RibManager::listChanges, this, _1, _2));
+
+  auto recordChange = [this] (const RibRouteRef& ref) {
+    m_changeLog.record(ref.entry->getName());
+  };
+  m_addRouteConn = m_rib.afterAddRoute.connect(recordChange);
+  m_updateRouteConn = m_rib.afterUpdateRoute.connect(recordChange);
+  m_removeRouteConn = m_rib.beforeRemoveRoute.connect(recordChange);
 }
 
 void
@@ -261,29 +278,60 @@ RibManager::unregisterEntry(const Name& topPrefix, const Interest& interest,
   beginRemoveRoute(parameters.getName(), route, [] (RibUpdateResult) {});
 }
 
+static ndn::nfd::RibEntry
+makeRibEntry(const RibEntry& entry, const time::steady_clock::TimePoint& now)
+{
+  ndn::nfd::RibEntry item;
+  item.setName(entry.getName());
+  for (const Route& route : entry.getRoutes()) {
+    ndn::nfd::Route r;
+    r.setFaceId(route.faceId);
+    r.setOrigin(route.origin);
+    r.setCost(route.cost);
+    r.setFlags(route.flags);
+    if (route.expires) {
+      r.setExpirationPeriod(time::duration_cast<time::milliseconds>(*route.expires - now));
+    }
+    item.addRoute(r);
+  }
+  return item;
+}
+
 void
 RibManager::listEntries(const Name& topPrefix, const Interest& interest,
                         ndn::mgmt::StatusDatasetContext& context)
 {
+  m_listCache.serve(m_changeLog.getVersion(), context, [this] (std::vector<Block>& elements) {
+    auto now = time::steady_clock::now();
+    for (const auto& kv : m_rib) {
+      elements.push_back(makeRibEntry(*kv.second, now).wireEncode());
+    }
+  });
+}
+
+bool
+RibManager::listChanges(uint64_t since, ndn::mgmt::StatusDatasetContext& context)
+{
+  std::set<Name> prefixes;
+  bool isAvailable = m_changeLog.forEachSince(since, [&prefixes] (const Name& prefix) {
+    prefixes.insert(prefix);
+  });
+  if (!isAvailable) {
+    return false;
+  }
+
   auto now = time::steady_clock::now();
-  for (const auto& kv : m_rib) {
-    const RibEntry& entry = *kv.second;
-    ndn::nfd::RibEntry item;
-    item.setName(entry.getName());
-    for (const Route& route : entry.getRoutes()) {
-      ndn::nfd::Route r;
-      r.setFaceId(route.faceId);
-      r.setOrigin(route.origin);
-      r.setCost(route.cost);
-      r.setFlags(route.flags);
-      if (route.expires) {
-        r.setExpirationPeriod(time::duration_cast<time::milliseconds>(*route.expires - now));
-      }
-      item.addRoute(r);
+  for (const Name& prefix : prefixes) {
+    auto it = m_rib.find(prefix);
+    if (it != m_rib.end()) {
+      context.append(makeRibEntry(*it->second, now).wireEncode());
+    }
+    else {
+      context.append(ndn::nfd::RibEntry().setName(prefix).wireEncode());
     }
-    context.append(item.wireEncode());
   }
   context.end();
+  return true;
 }
 
 void
@@ -31,6 +31,7 @@
 
 #include "core/config-file.hpp"
 #include "core/manager-base.hpp"
+#include "core/status-dataset-cache.hpp"
 
 #include <ndn-cxx/security/validator-config.hpp>
 #include <ndn-cxx/mgmt/nfd/controller.hpp>
@@ -213,6 +214,14 @@ private: // management Dispatcher related
   listEntries(const Name& topPrefix, const Interest& interest,
               ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief Serve rib/changes dataset.
+   *
+   *  Each changed prefix is reported with its current routes, or without routes
+   *  if its RIB entry has been erased.
+   */
+  bool
+  listChanges(uint64_t since, ndn::mgmt::StatusDatasetContext& context);
+
   void
   setFaceForSelfRegistration(const Interest& request, ControlParameters& parameters);
 
@@ -254,6 +263,12 @@ private:
   ndn::ValidatorConfig m_localhopValidator;
   bool m_isLocalhopEnabled;
 
+  TableChangeLog<Name> m_changeLog;
+  StatusDatasetCache m_listCache;
+  ndn::util::signal::ScopedConnection m_addRouteConn;
+  ndn::util::signal::ScopedConnection m_updateRouteConn;
+  ndn::util::signal::ScopedConnection m_removeRouteConn;
+
   ndn::util::scheduler::ScopedEventId m_activeFaceFetchEvent;
   using FaceIdSet = std::set<uint64_t>;
   FaceIdSet m_registeredFaces; ///< contains FaceIds with one or more Routes in the RIB
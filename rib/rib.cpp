@@ -32,6 +32,8 @@ namespace rib {
 
 NFD_LOG_INIT(Rib);
 
+const size_t Rib::MAX_BATCH_SIZE = 1024;
+
 bool
 operator<(const RibRouteRef& lhs, const RibRouteRef& rhs)
 {
@@ -46,7 +48,8 @@ sortRoutes(const Route& lhs, const Route& rhs)
 }
 
 Rib::Rib()
-  : m_nItems(0)
+  : m_trieRoot(make_unique<TrieNode>())
+  , m_nItems(0)
   , m_isUpdateInProgress(false)
 {
 }
@@ -114,7 +117,7 @@ Rib::insert(const Name& prefix, const Route& route)
       afterAddRoute(RibRouteRef{entry, entryIt});
 
       // Register with face lookup table
-      m_faceMap[route.faceId].push_back(entry);
+      m_faceMap[route.faceId].insert(RibRouteRef{entry, entryIt});
     }
     else {
       // Route exists, update fields
@@ -125,6 +128,8 @@ Rib::insert(const Name& prefix, const Route& route)
       }
 
       *entryIt = route;
+
+      afterUpdateRoute(RibRouteRef{entry, entryIt});
     }
   }
   else {
@@ -137,6 +142,8 @@ Rib::insert(const Name& prefix, const Route& route)
     entry->setName(prefix);
     auto routeIt = entry->insertRoute(route).first;
 
+    const TrieNode& node = insertTrieNode(entry);
+
     // Find prefix's parent
     shared_ptr<RibEntry> parent = findParent(prefix);
 
@@ -145,21 +152,22 @@ Rib::insert(const Name& prefix, const Route& route)
       parent->addChild(entry);
     }
 
-    RibEntryList children = findDescendants(prefix);
+    RibEntryList children;
+    collectChildEntries(node, children);
 
     for (const auto& child : children) {
-      if (child->getParent() == parent) {
-        // Remove child from parent and inherit parent's child
-        if (parent != nullptr) {
-          parent->removeChild(child);
-        }
+      BOOST_ASSERT(child->getParent() == parent);
 
-        entry->addChild(child);
+      // Remove child from parent and inherit parent's child
+      if (parent != nullptr) {
+        parent->removeChild(child);
       }
+
+      entry->addChild(child);
     }
 
     // Register with face lookup table
-    m_faceMap[route.faceId].push_back(entry);
+    m_faceMap[route.faceId].insert(RibRouteRef{entry, routeIt});
 
     // do something after inserting an entry
     afterInsertEntry(prefix);
@@ -180,15 +188,17 @@ Rib::erase(const Name& prefix, const Route& route)
     if (routeIt != entry->end()) {
       beforeRemoveRoute(RibRouteRef{entry, routeIt});
 
-      auto faceId = route.faceId;
+      // Unregister from face lookup table before the route is gone
+      auto faceIt = m_faceMap.find(routeIt->faceId);
+      BOOST_ASSERT(faceIt != m_faceMap.end());
+      faceIt->second.erase(RibRouteRef{entry, routeIt});
+      if (faceIt->second.empty()) {
+        m_faceMap.erase(faceIt);
+      }
+
       entry->eraseRoute(routeIt);
       m_nItems--;
 
-      // If this RibEntry no longer has this faceId, unregister from face lookup table
-      if (!entry->hasFaceId(faceId)) {
-        m_faceMap[faceId].remove(entry);
-      }
-
       // If a RibEntry's route list is empty, remove it from the tree
       if (entry->getRoutes().empty()) {
         eraseEntry(ribIt);
@@ -213,14 +223,23 @@ Rib::onRouteExpiration(const Name& prefix, const Route& route)
 shared_ptr<RibEntry>
 Rib::findParent(const Name& prefix) const
 {
-  for (int i = prefix.size() - 1; i >= 0; i--) {
-    auto it = m_rib.find(prefix.getPrefix(i));
-    if (it != m_rib.end()) {
-      return it->second;
+  shared_ptr<RibEntry> parent;
+
+  // Walk down the trie; the deepest entry above prefix is its parent
+  const TrieNode* node = m_trieRoot.get();
+  for (const name::Component& component : prefix) {
+    if (node->entry != nullptr) {
+      parent = node->entry;
+    }
+
+    auto it = node->children.find(component);
+    if (it == node->children.end()) {
+      break;
     }
+    node = it->second.get();
   }
 
-  return nullptr;
+  return parent;
 }
 
 std::list<shared_ptr<RibEntry>>
@@ -249,15 +268,97 @@ Rib::findDescendantsForNonInsertedName(const Name& prefix) const
 {
   std::list<shared_ptr<RibEntry>> children;
 
-  for (const auto& pair : m_rib) {
-    if (prefix.isPrefixOf(pair.first)) {
-      children.push_back(pair.second);
+  // Names under prefix immediately follow it in canonical order
+  for (auto it = m_rib.lower_bound(prefix); it != m_rib.end(); ++it) {
+    if (!prefix.isPrefixOf(it->first)) {
+      break;
     }
+    children.push_back(it->second);
   }
 
   return children;
 }
 
+std::list<shared_ptr<RibEntry>>
+Rib::findChildren(const Name& prefix) const
+{
+  std::list<shared_ptr<RibEntry>> children;
+
+  const TrieNode* node = findTrieNode(prefix);
+  if (node != nullptr) {
+    collectChildEntries(*node, children);
+  }
+
+  return children;
+}
+
+const Rib::TrieNode*
+Rib::findTrieNode(const Name& prefix) const
+{
+  const TrieNode* node = m_trieRoot.get();
+  for (const name::Component& component : prefix) {
+    auto it = node->children.find(component);
+    if (it == node->children.end()) {
+      return nullptr;
+    }
+    node = it->second.get();
+  }
+
+  return node;
+}
+
+const Rib::TrieNode&
+Rib::insertTrieNode(const shared_ptr<RibEntry>& entry)
+{
+  TrieNode* node = m_trieRoot.get();
+  for (const name::Component& component : entry->getName()) {
+    unique_ptr<TrieNode>& child = node->children[component];
+    if (child == nullptr) {
+      child = make_unique<TrieNode>();
+    }
+    node = child.get();
+  }
+
+  BOOST_ASSERT(node->entry == nullptr);
+  node->entry = entry;
+  return *node;
+}
+
+void
+Rib::eraseTrieNode(const Name& prefix)
+{
+  std::vector<TrieNode*> path{m_trieRoot.get()};
+  path.reserve(prefix.size() + 1);
+  for (const name::Component& component : prefix) {
+    auto it = path.back()->children.find(component);
+    BOOST_ASSERT(it != path.back()->children.end());
+    path.push_back(it->second.get());
+  }
+
+  path.back()->entry = nullptr;
+
+  // Prune nodes that no longer lead to any entry, but never the root
+  for (size_t i = prefix.size(); i > 0; --i) {
+    if (path[i]->entry != nullptr || !path[i]->children.empty()) {
+      break;
+    }
+    path[i - 1]->children.erase(prefix[i - 1]);
+  }
+}
+
+void
+Rib::collectChildEntries(const TrieNode& node, RibEntryList& entries)
+{
+  for (const auto& child : node.children) {
+    if (child.second->entry != nullptr) {
+      entries.push_back(child.second->entry);
+    }
+    else {
+      collectChildEntries(*child.second, entries);
+    }
+  }
+}
+
 Rib::RibTable::iterator
 Rib::eraseEntry(RibTable::iterator it)
 {
@@ -290,6 +391,7 @@ Rib::eraseEntry(RibTable::iterator it)
     }
   }
 
+  eraseTrieNode(entry->getName());
   auto nextIt = m_rib.erase(it);
 
   // do something after erasing an entry.
@@ -361,15 +463,23 @@ Rib::beginApplyUpdate(const RibUpdate& update,
 void
 Rib::beginRemoveFace(uint64_t faceId)
 {
+  RibUpdateBatch batch(faceId);
   for (const auto& nameAndRoute : findRoutesWithFaceId(faceId)) {
     RibUpdate update;
     update.setAction(RibUpdate::REMOVE_FACE)
           .setName(nameAndRoute.first)
           .setRoute(nameAndRoute.second);
 
-    addUpdateToQueue(update, nullptr, nullptr);
+    batch.add(update);
   }
 
+  if (batch.size() == 0) {
+    return;
+  }
+
+  UpdateQueueItem item{std::move(batch), nullptr, nullptr};
+  m_updateBatches.push_back(std::move(item));
+
   sendBatchFromQueue();
 }
 
@@ -385,6 +495,27 @@ Rib::addUpdateToQueue(const RibUpdate& update,
   m_updateBatches.push_back(std::move(item));
 }
 
+static bool
+isRemoveFaceBatch(const RibUpdateBatch& batch)
+{
+  return batch.size() > 0 && batch.begin()->getAction() == RibUpdate::REMOVE_FACE;
+}
+
+/** \brief determines whether \p name is equal to, a prefix of, or under a name in \p names
+ */
+static bool
+hasRelatedName(const std::set<Name>& names, const Name& name)
+{
+  for (size_t i = 0; i <= name.size(); ++i) {
+    if (names.count(name.getPrefix(i)) > 0) {
+      return true;
+    }
+  }
+
+  auto it = names.lower_bound(name);
+  return it != names.end() && name.isPrefixOf(*it);
+}
+
 void
 Rib::sendBatchFromQueue()
 {
@@ -394,20 +525,21 @@ Rib::sendBatchFromQueue()
 
   m_isUpdateInProgress = true;
 
-  UpdateQueueItem item = std::move(m_updateBatches.front());
-  m_updateBatches.pop_front();
-
+  UpdateQueueItem item = mergeUpdatesFromQueue();
   RibUpdateBatch& batch = item.batch;
 
-  // Until task #1698, each RibUpdateBatch contains exactly one RIB update
-  BOOST_ASSERT(batch.size() == 1);
-
   auto fibSuccessCb = bind(&Rib::onFibUpdateSuccess, this, batch, _1, item.managerSuccessCallback);
   auto fibFailureCb = bind(&Rib::onFibUpdateFailure, this, item.managerFailureCallback, _1, _2);
 
+  if (batch.size() == 0) {
+    // All merged updates cancelled each other out; neither the RIB nor the FIB changes
+    fibSuccessCb(RibUpdateList());
+    return;
+  }
+
 #ifdef WITH_TESTS
   if (mockFibResponse != nullptr) {
-    m_fibUpdater->computeAndSendFibUpdates(batch, bind([]{}), bind([]{}));
+    computeAndSendFibUpdates(batch, bind([]{}), bind([]{}));
     bool shouldFibSucceed = mockFibResponse(batch);
     if (wantMockFibResponseOnce) {
       mockFibResponse = nullptr;
@@ -422,7 +554,126 @@ Rib::sendBatchFromQueue()
   }
 #endif
 
-  m_fibUpdater->computeAndSendFibUpdates(batch, fibSuccessCb, fibFailureCb);
+  computeAndSendFibUpdates(batch, fibSuccessCb, fibFailureCb);
+}
+
+void
+Rib::computeAndSendFibUpdates(const RibUpdateBatch& batch,
+                              const std::function<void(RibUpdateList)>& onSuccess,
+                              const Rib::UpdateFailureCallback& onFailure)
+{
+  if (isRemoveFaceBatch(batch)) {
+    // The routes of a destroyed face are removed from the RIB while their FibUpdates
+    // are computed, so that routes in the same namespace see each other's removal
+    m_fibUpdater->computeAndSendFibUpdatesForRemovedFace(batch,
+      bind(&Rib::applyRemoveFaceUpdate, this, _1, _2), onSuccess, onFailure);
+  }
+  else {
+    m_fibUpdater->computeAndSendFibUpdates(batch, onSuccess, onFailure);
+  }
+}
+
+Rib::UpdateQueueItem
+Rib::mergeUpdatesFromQueue()
+{
+  BOOST_ASSERT(!m_updateBatches.empty());
+
+  if (isRemoveFaceBatch(m_updateBatches.front().batch)) {
+    UpdateQueueItem item = std::move(m_updateBatches.front());
+    m_updateBatches.pop_front();
+    return item;
+  }
+
+  const uint64_t faceId = m_updateBatches.front().batch.getFaceId();
+
+  // The last update of each route in the batch, or nullopt if the updates cancelled out.
+  // All routes in a batch have the same Face ID, so (name, origin) identifies a route.
+  std::map<std::pair<Name, ndn::nfd::RouteOrigin>, optional<RibUpdate>> routeUpdates;
+  std::set<Name> names;
+  std::vector<Rib::UpdateSuccessCallback> successCallbacks;
+  std::vector<Rib::UpdateFailureCallback> failureCallbacks;
+  size_t nMerged = 0;
+
+  while (!m_updateBatches.empty() && nMerged < MAX_BATCH_SIZE) {
+    const UpdateQueueItem& item = m_updateBatches.front();
+    if (item.batch.getFaceId() != faceId || isRemoveFaceBatch(item.batch)) {
+      break;
+    }
+
+    // addUpdateToQueue places each update in its own queue item
+    BOOST_ASSERT(item.batch.size() == 1);
+    const RibUpdate& update = *item.batch.begin();
+
+    auto key = std::make_pair(update.getName(), update.getRoute().origin);
+    auto it = routeUpdates.find(key);
+    if (it == routeUpdates.end()) {
+      // FibUpdater computes every update in a batch against the same RIB state,
+      // so an update must not touch the namespace of another update in the batch
+      if (hasRelatedName(names, update.getName())) {
+        break;
+      }
+      names.insert(update.getName());
+      routeUpdates.emplace(key, update);
+    }
+    else {
+      optional<RibUpdate>& mergedUpdate = it->second;
+      bool isSupersededRegistration = mergedUpdate &&
+                                      mergedUpdate->getAction() == RibUpdate::REGISTER;
+
+      if (isSupersededRegistration) {
+        // The superseded route will never be inserted, so it must not expire either
+        Route supersededRoute = mergedUpdate->getRoute();
+        supersededRoute.cancelExpirationEvent();
+      }
+
+      if (isSupersededRegistration && update.getAction() == RibUpdate::UNREGISTER &&
+          find(update.getName(), update.getRoute()) == nullptr) {
+        NFD_LOG_TRACE("Cancelling registration and unregistration of " << update.getRoute() <<
+                      " for " << update.getName());
+        mergedUpdate = nullopt;
+      }
+      else {
+        mergedUpdate = update;
+      }
+    }
+
+    if (item.managerSuccessCallback != nullptr) {
+      successCallbacks.push_back(item.managerSuccessCallback);
+    }
+    if (item.managerFailureCallback != nullptr) {
+      failureCallbacks.push_back(item.managerFailureCallback);
+    }
+
+    m_updateBatches.pop_front();
+    ++nMerged;
+  }
+
+  UpdateQueueItem merged{RibUpdateBatch(faceId), nullptr, nullptr};
+  for (const auto& routeUpdate : routeUpdates) {
+    if (routeUpdate.second) {
+      merged.batch.add(*routeUpdate.second);
+    }
+  }
+
+  NFD_LOG_DEBUG("Merged " << nMerged << " queued updates into a batch of " <<
+                merged.batch.size() << " for faceId: " << faceId);
+
+  if (!successCallbacks.empty()) {
+    merged.managerSuccessCallback = [successCallbacks] {
+      for (const auto& onSuccess : successCallbacks) {
+        onSuccess();
+      }
+    };
+  }
+  if (!failureCallbacks.empty()) {
+    merged.managerFailureCallback = [failureCallbacks] (uint32_t code, const std::string& error) {
+      for (const auto& onFailure : failureCallbacks) {
+        onFailure(code, error);
+      }
+    };
+  }
+
+  return merged;
 }
 
 void
@@ -455,6 +706,13 @@ Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
   sendBatchFromQueue();
 }
 
+void
+Rib::applyRemoveFaceUpdate(const RibUpdate& update, const RibUpdateList& inheritedRoutes)
+{
+  erase(update.getName(), update.getRoute());
+  modifyInheritedRoutes(inheritedRoutes);
+}
+
 void
 Rib::onFibUpdateFailure(const Rib::UpdateFailureCallback& onFailure,
                         uint32_t code, const std::string& error)
@@ -501,14 +759,8 @@ Rib::findRoutesWithFaceId(uint64_t faceId)
     return routes;
   }
 
-  // For each RIB entry that has faceId
-  for (const auto& entry : lookupIt->second) {
-    // Find the routes in the entry
-    for (const Route& route : *entry) {
-      if (route.faceId == faceId) {
-        routes.emplace_back(entry->getName(), route);
-      }
-    }
+  for (const RibRouteRef& ref : lookupIt->second) {
+    routes.emplace_back(ref.entry->getName(), *ref.route);
   }
 
   return routes;
@@ -62,7 +62,10 @@ public:
   typedef std::list<shared_ptr<RibEntry>> RibEntryList;
   typedef std::map<Name, shared_ptr<RibEntry>> RibTable;
   typedef RibTable::const_iterator const_iterator;
-  typedef std::map<uint64_t, std::list<shared_ptr<RibEntry>>> FaceLookupTable;
+  /** \brief index of the routes of each face, so that a face's routes can be found without
+   *         searching RIB entries
+   */
+  typedef std::map<uint64_t, std::set<RibRouteRef>> FaceLookupTable;
   typedef bool (*RouteComparePredicate)(const Route&, const Route&);
   typedef std::set<Route, RouteComparePredicate> RouteSet;
 
@@ -112,11 +115,25 @@ public:
   std::list<shared_ptr<RibEntry>>
   findDescendantsForNonInsertedName(const Name& prefix) const;
 
+  /** \brief finds the nearest namespaces under the passed prefix
+   *
+   *  The cost is proportional to the number of names between the prefix and the
+   *  returned entries, rather than to the size of the RIB or of the subtree.
+   *
+   *  \return{ a list of entries which are, or would be if the prefix existed in the RIB,
+   *  the children of the passed prefix }
+   */
+  std::list<shared_ptr<RibEntry>>
+  findChildren(const Name& prefix) const;
+
 public:
   using UpdateSuccessCallback = std::function<void()>;
   using UpdateFailureCallback = std::function<void(uint32_t code, const std::string& error)>;
 
-  /** \brief passes the provided RibUpdateBatch to FibUpdater to calculate and send FibUpdates.
+  /** \brief queues the provided RibUpdate to be applied to the RIB and the FIB.
+   *
+   *  Queued updates are merged into a RibUpdateBatch, which is passed to FibUpdater to
+   *  calculate and send FibUpdates.
    *
    *  If the FIB is updated successfully, onFibUpdateSuccess() will be called, and the
    *  RIB will be updated
@@ -130,6 +147,8 @@ public:
                    const UpdateFailureCallback& onFailure);
 
   /** \brief starts the FIB update process when a face has been destroyed
+   *
+   *  All routes of the face are removed in a single RibUpdateBatch of REMOVE_FACE updates.
    */
   void
   beginRemoveFace(uint64_t faceId);
@@ -167,14 +186,50 @@ private:
 
   /** \brief Attempts to send the front update batch in the queue.
   *
-  *   If an update is not in progress, the front update batch in the queue will be
-  *   sent to the RIB for processing.
+  *   If an update is not in progress, the updates at the front of the queue will be
+  *   merged into one batch and sent to the RIB for processing.
   *
   *   If an update is in progress, nothing will be done.
   */
   void
   sendBatchFromQueue();
 
+  /** \brief passes \p batch to FibUpdater to calculate and send FibUpdates
+   *
+   *  A batch of REMOVE_FACE updates is applied to the RIB while it is calculated.
+   *  \sa FibUpdater::computeAndSendFibUpdatesForRemovedFace
+   */
+  void
+  computeAndSendFibUpdates(const RibUpdateBatch& batch,
+                           const std::function<void(RibUpdateList)>& onSuccess,
+                           const Rib::UpdateFailureCallback& onFailure);
+
+  /** \brief removes the route of a REMOVE_FACE update from the RIB, along with the inherited
+   *         routes that were calculated for it
+   */
+  void
+  applyRemoveFaceUpdate(const RibUpdate& update, const RibUpdateList& inheritedRoutes);
+
+  struct UpdateQueueItem;
+
+  /** \brief removes the longest run of updates at the front of the queue that can be
+  *          applied as one RibUpdateBatch, and merges them.
+  *
+  *   REGISTER and UNREGISTER updates are merged while they have the same Face ID and
+  *   do not affect each other's FIB computation: their names are not prefixes of one
+  *   another, unless they refer to the same route. The REMOVE_FACE batch of a destroyed
+  *   face is already complete, and is not merged with anything.
+  *
+  *   Updates of the same route are coalesced so that only the last one is applied.
+  *   A registration followed by an unregistration of a route that is not in the RIB
+  *   cancels out, and produces no update at all.
+  *
+  *   \return an item whose callbacks invoke the callbacks of every merged update;
+  *           its batch may be empty if all updates were cancelled out
+  */
+  UpdateQueueItem
+  mergeUpdatesFromQueue();
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 #ifdef WITH_TESTS
   /** \brief In unit tests, mock FIB update result.
@@ -194,6 +249,31 @@ private:
   RibTable::iterator
   eraseEntry(RibTable::iterator it);
 
+  struct TrieNode;
+
+  /** \brief finds the trie node of \p prefix
+   *  \return{ the node, or nullptr if no RIB entry is at or under \p prefix }
+   */
+  const TrieNode*
+  findTrieNode(const Name& prefix) const;
+
+  /** \brief attaches \p entry to the trie, creating the nodes on its path as necessary
+   *  \return{ the node of \p entry }
+   */
+  const TrieNode&
+  insertTrieNode(const shared_ptr<RibEntry>& entry);
+
+  /** \brief detaches the entry of \p prefix from the trie, and prunes the nodes on its
+   *         path that no longer lead to any entry
+   */
+  void
+  eraseTrieNode(const Name& prefix);
+
+  /** \brief appends to \p entries the nearest entries strictly under \p node
+   */
+  static void
+  collectChildEntries(const TrieNode& node, RibEntryList& entries);
+
   void
   updateRib(const RibUpdateBatch& batch);
 
@@ -245,12 +325,29 @@ public:
    */
   ndn::util::signal::Signal<Rib, RibRouteRef> afterAddRoute;
 
+  /** \brief signals after an existing Route is updated, e.g. by a repeated registration
+   */
+  ndn::util::signal::Signal<Rib, RibRouteRef> afterUpdateRoute;
+
   /** \brief signals before a route is removed
    */
   ndn::util::signal::Signal<Rib, RibRouteRef> beforeRemoveRoute;
 
 private:
-  RibTable m_rib;
+  /** \brief a node of the name component trie that indexes RIB entries by name
+   *
+   *  The trie mirrors the structure of the namespace, so that the parent and the children
+   *  of a name can be found by walking only the components near that name.
+   *  It has a node for every prefix of the name of every RIB entry.
+   */
+  struct TrieNode
+  {
+    std::map<name::Component, unique_ptr<TrieNode>> children;
+    shared_ptr<RibEntry> entry; ///< RIB entry with this node's name, if any
+  };
+
+  RibTable m_rib; ///< RIB entries in name order, for lookup and enumeration
+  unique_ptr<TrieNode> m_trieRoot; ///< trie node of ndn:/
   FaceLookupTable m_faceMap;
   FibUpdater* m_fibUpdater;
 
@@ -262,15 +359,18 @@ private:
   struct UpdateQueueItem
   {
     RibUpdateBatch batch;
-    const Rib::UpdateSuccessCallback managerSuccessCallback;
-    const Rib::UpdateFailureCallback managerFailureCallback;
+    Rib::UpdateSuccessCallback managerSuccessCallback;
+    Rib::UpdateFailureCallback managerFailureCallback;
   };
 
+  /** \brief maximum number of queued updates merged into one RibUpdateBatch
+   */
+  static const size_t MAX_BATCH_SIZE;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   typedef std::list<UpdateQueueItem> UpdateQueue;
   UpdateQueue m_updateBatches;
 
-private:
   bool m_isUpdateInProgress;
 };
 
@@ -33,6 +33,7 @@
 
 #include "core/global-io.hpp"
 #include "core/logger.hpp"
+#include "fw/forwarder.hpp"
 
 #include "ns3/node-list.h"
 #include "ns3/node.h"
@@ -50,10 +51,42 @@ static const std::string CFG_LOCALHOST_SECURITY = "localhost_security";
 static const std::string CFG_LOCALHOP_SECURITY = "localhop_security";
 static const std::string CFG_PREFIX_PROPAGATE = "auto_prefix_propagate";
 static const std::string CFG_READVERTISE_NLSR = "readvertise_nlsr";
+static const std::string CFG_READVERTISE_PACING = "readvertise_pacing";
 static const Name READVERTISE_NLSR_PREFIX = "/localhost/nlsr";
 static const uint64_t PROPAGATE_DEFAULT_COST = 15;
 static const time::milliseconds PROPAGATE_DEFAULT_TIMEOUT = 10_s;
 
+/** \brief applies \p update to the FIB of \p forwarder, as FibManager would
+ *  \return status code of the equivalent fib/add-nexthop or fib/remove-nexthop command
+ */
+static uint32_t
+applyFibUpdate(Forwarder& forwarder, const FibUpdate& update)
+{
+  Face* face = forwarder.getFace(update.faceId);
+  Fib& fib = forwarder.getFib();
+
+  if (update.action == FibUpdate::ADD_NEXTHOP) {
+    if (update.name.size() > Fib::getMaxDepth()) {
+      return 414;
+    }
+    if (face == nullptr) {
+      return 410;
+    }
+    fib.addOrUpdateNextHop(*fib.insert(update.name).first, *face, 0, update.cost);
+    return 200;
+  }
+
+  // like fib/remove-nexthop, removing a nonexistent nexthop succeeds
+  if (face == nullptr) {
+    return 200;
+  }
+  fib::Entry* entry = fib.findExactMatch(update.name);
+  if (entry != nullptr) {
+    fib.removeNextHop(*entry, *face, 0);
+  }
+  return 200;
+}
+
 Service::Service(const ConfigSection& configSection, ndn::Face& face, ndn::KeyChain& keyChain)
   : Service(keyChain, face,
             [&configSection] (ConfigFile& config, bool isDryRun) {
@@ -67,6 +100,7 @@ Service::Service(ndn::KeyChain& keyChain, ndn::Face& face, const ConfigParseFunc
   : m_keyChain(keyChain)
   , m_face(face)
   , m_scheduler(m_face.getIoService())
+  , m_context(makeExecutionContext())
   , m_nfdController(m_face, m_keyChain)
   , m_fibUpdater(m_rib, m_nfdController)
   , m_dispatcher(m_face, m_keyChain)
@@ -77,6 +111,8 @@ Service::Service(ndn::KeyChain& keyChain, ndn::Face& face, const ConfigParseFunc
   configParse(config, true);
   configParse(config, false);
 
+  enableLocalFibUpdates();
+
   m_ribManager.registerWithNfd();
   m_ribManager.enableLocalFields();
 }
@@ -93,6 +129,48 @@ Service::get()
   return l3->getRibService();
 }
 
+unique_ptr<ExecutionContext>
+Service::makeExecutionContext()
+{
+  uint32_t context = ::ns3::Simulator::GetContext();
+  if (context >= ::ns3::NodeList::GetNNodes()) {
+    return make_unique<ExecutionContext>();
+  }
+
+  auto l3 = ::ns3::NodeList::GetNode(context)->GetObject<::ns3::ndn::L3Protocol>();
+  if (l3 == nullptr || l3->getForwarder() == nullptr) {
+    return make_unique<ExecutionContext>();
+  }
+
+  return make_unique<ExecutionContext>(l3->getForwarder()->getExecutionContext().getRng()());
+}
+
+void
+Service::enableLocalFibUpdates()
+{
+  uint32_t context = ::ns3::Simulator::GetContext();
+  if (context >= ::ns3::NodeList::GetNNodes()) {
+    return;
+  }
+
+  auto l3 = ::ns3::NodeList::GetNode(context)->GetObject<::ns3::ndn::L3Protocol>();
+  if (l3 == nullptr || l3->getForwarder() == nullptr) {
+    return;
+  }
+
+  // The forwarder lives in the same node, so FIB updates need not go through
+  // signed fib/add-nexthop and fib/remove-nexthop commands
+  weak_ptr<Forwarder> weakForwarder = l3->getForwarder();
+  m_fibUpdater.setLocalFibApplier([weakForwarder] (const FibUpdate& update) -> uint32_t {
+    auto forwarder = weakForwarder.lock();
+    if (forwarder == nullptr) {
+      return 410;
+    }
+    return applyFibUpdate(*forwarder, update);
+  });
+  NFD_LOG_DEBUG("Applying FIB updates directly to the forwarder of node " << context);
+}
+
 void
 Service::processConfig(const ConfigSection& section, bool isDryRun, const std::string& filename)
 {
@@ -126,11 +204,45 @@ Service::checkConfig(const ConfigSection& section, const std::string& filename)
   }
 }
 
+static Readvertise::PacingOptions
+parsePacingOptions(const ConfigSection& section)
+{
+  const std::string sectionName = CFG_SECTION + "." + CFG_READVERTISE_PACING;
+  Readvertise::PacingOptions options;
+
+  for (const auto& item : section) {
+    if (item.first == "coalesce_window") {
+      auto window = ConfigFile::parseNumber<uint32_t>(item, sectionName);
+      options.coalesceWindow = time::milliseconds(window);
+    }
+    else if (item.first == "max_rate") {
+      options.maxRate = ConfigFile::parseNumber<double>(item, sectionName);
+      if (options.maxRate < 0.0) {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error("max_rate in " + sectionName +
+                                                " cannot be negative"));
+      }
+    }
+    else if (item.first == "max_burst") {
+      options.maxBurst = ConfigFile::parseNumber<uint32_t>(item, sectionName);
+      if (options.maxBurst == 0) {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error("max_burst in " + sectionName +
+                                                " must be positive"));
+      }
+    }
+    else {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option " + sectionName + "." +
+                                              item.first));
+    }
+  }
+  return options;
+}
+
 void
 Service::applyConfig(const ConfigSection& section, const std::string& filename)
 {
   bool wantPrefixPropagate = false;
   bool wantReadvertiseNlsr = false;
+  Readvertise::PacingOptions pacing;
 
   for (const auto& item : section) {
     const std::string& key = item.first;
@@ -167,12 +279,16 @@ Service::applyConfig(const ConfigSection& section, const std::string& filename)
           m_rib,
           m_scheduler,
           make_unique<HostToGatewayReadvertisePolicy>(m_keyChain, item.second),
-          make_unique<NfdRibReadvertiseDestination>(m_nfdController, m_rib, options, parameters));
+          make_unique<NfdRibReadvertiseDestination>(m_nfdController, m_rib, options, parameters),
+          *m_context);
       }
     }
     else if (key == CFG_READVERTISE_NLSR) {
       wantReadvertiseNlsr = ConfigFile::parseYesNo(item, CFG_SECTION + "." + CFG_READVERTISE_NLSR);
     }
+    else if (key == CFG_READVERTISE_PACING) {
+      pacing = parsePacingOptions(value);
+    }
     else {
       BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option " + CFG_SECTION + "." + key));
     }
@@ -190,12 +306,20 @@ Service::applyConfig(const ConfigSection& section, const std::string& filename)
       m_rib,
       m_scheduler,
       make_unique<ClientToNlsrReadvertisePolicy>(),
-      make_unique<NfdRibReadvertiseDestination>(m_nfdController, m_rib, options));
+      make_unique<NfdRibReadvertiseDestination>(m_nfdController, m_rib, options),
+      *m_context);
   }
   else if (!wantReadvertiseNlsr && m_readvertiseNlsr != nullptr) {
     NFD_LOG_DEBUG("Disabling readvertise-to-nlsr");
     m_readvertiseNlsr.reset();
   }
+
+  if (m_readvertisePropagation != nullptr) {
+    m_readvertisePropagation->setPacingOptions(pacing);
+  }
+  if (m_readvertiseNlsr != nullptr) {
+    m_readvertiseNlsr->setPacingOptions(pacing);
+  }
 }
 
 } // namespace rib
@@ -29,6 +29,7 @@
 #include "rib-manager.hpp"
 
 #include "core/config-file.hpp"
+#include "core/execution-context.hpp"
 
 #include <ndn-cxx/face.hpp>
 #include <ndn-cxx/mgmt/dispatcher.hpp>
@@ -77,6 +78,20 @@ private:
   Service(ndn::KeyChain& keyChain, ndn::Face& face,
           const ConfigParseFunc& configParse);
 
+  /** \brief lets FibUpdater apply FIB updates directly to the forwarder of the current
+   *         node, if it is available
+   */
+  void
+  enableLocalFibUpdates();
+
+  /** \brief creates the execution context of this RIB
+   *
+   *  The context's RNG is seeded from the forwarder of the current node, if it is available,
+   *  so that RIB timers are reproducible and independent across nodes.
+   */
+  static unique_ptr<ExecutionContext>
+  makeExecutionContext();
+
   void
   processConfig(const ConfigSection& section, bool isDryRun, const std::string& filename);
 
@@ -90,6 +105,7 @@ private:
   ndn::KeyChain& m_keyChain;
   ndn::Face& m_face;
   ndn::util::Scheduler m_scheduler;
+  unique_ptr<ExecutionContext> m_context;
   ndn::nfd::Controller m_nfdController;
 
   Rib m_rib;
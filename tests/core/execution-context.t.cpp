@@ -0,0 +1,77 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/execution-context.hpp"
+#include "core/random.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestExecutionContext, UnitTestTimeFixture)
+
+BOOST_AUTO_TEST_CASE(DefaultDelegatesToGlobal)
+{
+  ExecutionContext context;
+  BOOST_CHECK_EQUAL(&context.getRng(), &getGlobalRng());
+  BOOST_CHECK_EQUAL(&context.getScheduler(), &scheduler::getGlobalScheduler());
+  BOOST_CHECK_EQUAL(&getGlobalExecutionContext().getRng(), &getGlobalRng());
+}
+
+BOOST_AUTO_TEST_CASE(SeededRng)
+{
+  ExecutionContext context1(42);
+  ExecutionContext context2(42);
+  ExecutionContext context3(43);
+  BOOST_CHECK_NE(&context1.getRng(), &getGlobalRng());
+  BOOST_CHECK_EQUAL(&context1.getScheduler(), &scheduler::getGlobalScheduler());
+
+  std::vector<uint32_t> seq1, seq2, seq3;
+  for (int i = 0; i < 16; ++i) {
+    seq1.push_back(context1.getRng()());
+    seq2.push_back(context2.getRng()());
+    seq3.push_back(context3.getRng()());
+  }
+  BOOST_CHECK_EQUAL_COLLECTIONS(seq1.begin(), seq1.end(), seq2.begin(), seq2.end());
+  BOOST_CHECK(seq1 != seq3);
+}
+
+BOOST_AUTO_TEST_CASE(Schedule)
+{
+  ExecutionContext context(1);
+  int count = 0;
+  context.schedule(100_ms, [&] { ++count; });
+  scheduler::EventId eid = context.schedule(200_ms, [&] { ++count; });
+  scheduler::cancel(eid);
+
+  this->advanceClocks(50_ms, 500_ms);
+  BOOST_CHECK_EQUAL(count, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestExecutionContext
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/packet-trace.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/filesystem.hpp>
+#include <cstring>
+
+namespace nfd {
+namespace trace {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_FIXTURE_TEST_SUITE(TestPacketTrace, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(RingPushPop)
+{
+  RecordRing ring(3);
+  BOOST_CHECK_EQUAL(ring.capacity(), 4);
+  BOOST_CHECK_EQUAL(ring.size(), 0);
+
+  Record record{};
+  for (uint32_t i = 0; i < 4; ++i) {
+    record.nonce = i;
+    BOOST_CHECK_EQUAL(ring.push(record), true);
+  }
+  BOOST_CHECK_EQUAL(ring.push(record), false);
+  BOOST_CHECK_EQUAL(ring.size(), 4);
+
+  Record out[8];
+  BOOST_REQUIRE_EQUAL(ring.pop(out, 3), 3);
+  BOOST_CHECK_EQUAL(out[0].nonce, 0);
+  BOOST_CHECK_EQUAL(out[2].nonce, 2);
+
+  // wrap around
+  record.nonce = 4;
+  BOOST_CHECK_EQUAL(ring.push(record), true);
+  BOOST_REQUIRE_EQUAL(ring.pop(out, 8), 2);
+  BOOST_CHECK_EQUAL(out[0].nonce, 3);
+  BOOST_CHECK_EQUAL(out[1].nonce, 4);
+  BOOST_CHECK_EQUAL(ring.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(NameHash)
+{
+  BOOST_CHECK_EQUAL(computeNameHash("/A/B"), computeNameHash("/A/B"));
+  BOOST_CHECK_NE(computeNameHash("/A/B"), computeNameHash("/A/C"));
+}
+
+BOOST_AUTO_TEST_CASE(WriteFile)
+{
+  auto path = boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "packet-trace.bin";
+  boost::filesystem::create_directories(path.parent_path());
+
+  {
+    // capacity smaller than the number of records forces flushes while recording
+    PacketTracer tracer(path.string(), 2);
+    for (uint32_t i = 0; i < 5; ++i) {
+      tracer.record(Event::INCOMING_INTEREST, 300, "/A", i, i * 10);
+    }
+    BOOST_CHECK_EQUAL(tracer.getNDropped(), 0);
+  }
+
+  std::ifstream is(path.string(), std::ios::binary);
+  FileHeader header;
+  BOOST_REQUIRE(is.read(reinterpret_cast<char*>(&header), sizeof(header)));
+  BOOST_CHECK_EQUAL(std::memcmp(header.magic, FILE_MAGIC, sizeof(header.magic)), 0);
+  BOOST_CHECK_EQUAL(header.version, FILE_VERSION);
+  BOOST_CHECK_EQUAL(header.recordSize, sizeof(Record));
+
+  Record record;
+  uint32_t n = 0;
+  while (is.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+    BOOST_CHECK_EQUAL(record.event, static_cast<uint8_t>(Event::INCOMING_INTEREST));
+    BOOST_CHECK_EQUAL(record.faceId, 300);
+    BOOST_CHECK_EQUAL(record.nameHash, computeNameHash("/A"));
+    BOOST_CHECK_EQUAL(record.nonce, n);
+    BOOST_CHECK_EQUAL(record.arg, n * 10);
+    ++n;
+  }
+  BOOST_CHECK_EQUAL(n, 5);
+
+  is.close();
+  boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPacketTrace
+
+} // namespace tests
+} // namespace trace
+} // namespace nfd
@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/spsc-ring.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <thread>
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestSpscRing, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(PushPop)
+{
+  SpscRing<unique_ptr<int>> ring(2);
+  BOOST_CHECK_EQUAL(ring.capacity(), 2);
+  BOOST_CHECK(ring.empty());
+
+  BOOST_CHECK_EQUAL(ring.push(make_unique<int>(1)), true);
+  BOOST_CHECK_EQUAL(ring.push(make_unique<int>(2)), true);
+  auto third = make_unique<int>(3);
+  BOOST_CHECK_EQUAL(ring.push(std::move(third)), false);
+  BOOST_CHECK(third != nullptr);
+  BOOST_CHECK_EQUAL(ring.size(), 2);
+
+  unique_ptr<int> out[4];
+  BOOST_REQUIRE_EQUAL(ring.pop(out, 4), 2);
+  BOOST_CHECK_EQUAL(*out[0], 1);
+  BOOST_CHECK_EQUAL(*out[1], 2);
+  BOOST_CHECK(ring.empty());
+  BOOST_CHECK_EQUAL(ring.pop(out, 4), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TwoThreads)
+{
+  const size_t nItems = 100000;
+  SpscRing<size_t> ring(64);
+
+  std::thread producer([&] {
+    for (size_t i = 0; i < nItems; ++i) {
+      while (!ring.push(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  size_t expected = 0;
+  bool isInOrder = true;
+  size_t buffer[16];
+  while (expected < nItems) {
+    size_t n = ring.pop(buffer, 16);
+    for (size_t i = 0; i < n; ++i) {
+      isInOrder = isInOrder && buffer[i] == expected;
+      ++expected;
+    }
+  }
+  producer.join();
+
+  BOOST_CHECK(isInOrder);
+  BOOST_CHECK(ring.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSpscRing
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/status-dataset-cache.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestTableChangeLog, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(ForEachSince)
+{
+  TableChangeLog<int> log;
+  BOOST_CHECK_EQUAL(log.getVersion(), 0);
+
+  log.record(1);
+  log.record(2);
+  log.record(3);
+  BOOST_CHECK_EQUAL(log.getVersion(), 3);
+
+  std::vector<int> items;
+  BOOST_CHECK(log.forEachSince(1, [&items] (int item) { items.push_back(item); }));
+  std::vector<int> expected{2, 3};
+  BOOST_CHECK_EQUAL_COLLECTIONS(items.begin(), items.end(), expected.begin(), expected.end());
+
+  items.clear();
+  BOOST_CHECK(log.forEachSince(3, [&items] (int item) { items.push_back(item); }));
+  BOOST_CHECK(items.empty());
+
+  BOOST_CHECK(!log.forEachSince(4, [&items] (int item) { items.push_back(item); }));
+  BOOST_CHECK(items.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  TableChangeLog<int> log(2);
+  log.record(1);
+  log.record(2);
+  log.record(3);
+  BOOST_CHECK_EQUAL(log.getVersion(), 3);
+
+  std::vector<int> items;
+  BOOST_CHECK(!log.forEachSince(0, [&items] (int item) { items.push_back(item); }));
+  BOOST_CHECK(items.empty());
+
+  BOOST_CHECK(log.forEachSince(1, [&items] (int item) { items.push_back(item); }));
+  std::vector<int> expected{2, 3};
+  BOOST_CHECK_EQUAL_COLLECTIONS(items.begin(), items.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTableChangeLog
+
+} // namespace tests
+} // namespace nfd
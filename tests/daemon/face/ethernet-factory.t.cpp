@@ -190,6 +190,32 @@ BOOST_AUTO_TEST_CASE(EnableDisableMcast)
   BOOST_CHECK_EQUAL(this->countEtherMcastFaces(), 0);
 }
 
+#ifdef __linux__
+BOOST_AUTO_TEST_CASE(PacketRing)
+{
+  SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
+
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        mcast yes
+        packet_ring yes
+        packet_ring_blocks 4
+        packet_ring_tx_frames 64
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  checkChannelListEqual(factory, this->listUrisOfAvailableNetifs());
+  BOOST_CHECK_EQUAL(this->countEtherMcastFaces(), netifs.size());
+}
+#endif // __linux__
+
 BOOST_AUTO_TEST_CASE(McastAdHoc)
 {
   SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
@@ -413,6 +439,50 @@ BOOST_AUTO_TEST_CASE(BadMcastGroup)
   BOOST_CHECK_THROW(parseConfig(CONFIG2, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BadPacketRing)
+{
+  const std::string CONFIG1 = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        packet_ring hello
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG1, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG1, false), ConfigFile::Error);
+
+  const std::string CONFIG2 = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        packet_ring yes
+        packet_ring_blocks 0
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, false), ConfigFile::Error);
+
+  const std::string CONFIG3 = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        packet_ring yes
+        packet_ring_tx_frames 100000
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG3, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG3, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(UnknownOption)
 {
   const std::string CONFIG = R"CONFIG(
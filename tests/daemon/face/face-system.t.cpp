@@ -24,7 +24,9 @@
  */
 
 #include "face/face-system.hpp"
+#include "face/generic-link-service.hpp"
 #include "face-system-fixture.hpp"
+#include "dummy-transport.hpp"
 
 #include "tests/test-common.hpp"
 
@@ -159,6 +161,51 @@ BOOST_AUTO_TEST_CASE(ChangeProvidedSchemes)
   BOOST_CHECK_EQUAL(faceSystem.getFactoryByScheme("s3"), f1);
 }
 
+BOOST_AUTO_TEST_CASE(AllowBareNetPacket)
+{
+  auto getOptions = [] (const Face& face) {
+    return static_cast<const GenericLinkService*>(face.getLinkService())->getOptions();
+  };
+
+  auto face1 = make_shared<Face>(make_unique<GenericLinkService>(), make_unique<DummyTransport>());
+  faceTable.add(face1);
+  BOOST_CHECK_EQUAL(getOptions(*face1).allowBareNetPacket, false);
+
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        allow_bare_net_packet yes
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  BOOST_CHECK_EQUAL(getOptions(*face1).allowBareNetPacket, false);
+
+  // existing faces are updated
+  parseConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(getOptions(*face1).allowBareNetPacket, true);
+
+  // faces added later, including those not created by a ProtocolFactory, get the option
+  auto face2 = make_shared<Face>(make_unique<GenericLinkService>(), make_unique<DummyTransport>());
+  faceTable.add(face2);
+  BOOST_CHECK_EQUAL(getOptions(*face2).allowBareNetPacket, true);
+
+  const std::string CONFIG_INVALID = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        allow_bare_net_packet maybe
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG_INVALID, true), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // ProcessConfig
 
 BOOST_AUTO_TEST_SUITE_END() // TestFaceSystem
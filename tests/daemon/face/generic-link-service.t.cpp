@@ -272,6 +272,34 @@ BOOST_AUTO_TEST_CASE(ReceiveIdlePacket)
   BOOST_CHECK_EQUAL(receivedNacks.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(SendBareNetPacket)
+{
+  GenericLinkService::Options options;
+  options.allowLocalFields = false;
+  options.allowBareNetPacket = true;
+  initialize(options);
+
+  // no tags: the Interest is sent without LpPacket wrapping
+  shared_ptr<Interest> interest1 = makeInterest("/localhost/test");
+  face->sendInterest(*interest1);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(transport->sentPackets.back().packet, interest1->wireEncode());
+
+  // HopCountTag present: LpPacket carries it
+  shared_ptr<Data> data1 = makeData("/localhost/test");
+  data1->setTag(make_shared<lp::HopCountTag>(3));
+  face->sendData(*data1);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+  lp::Packet data1pkt;
+  BOOST_REQUIRE_NO_THROW(data1pkt.wireDecode(transport->sentPackets.back().packet));
+  BOOST_CHECK_EQUAL(data1pkt.get<lp::HopCountTagField>(), 3);
+
+  // a bare Interest is accepted on receive
+  transport->receivePacket(interest1->wireEncode());
+  BOOST_REQUIRE_EQUAL(receivedInterests.size(), 1);
+  BOOST_CHECK_EQUAL(receivedInterests.back().getName(), interest1->getName());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // SimpleSendReceive
 
 BOOST_AUTO_TEST_SUITE(Fragmentation)
@@ -828,6 +856,119 @@ BOOST_AUTO_TEST_CASE(DefaultThreshold)
 
 BOOST_AUTO_TEST_SUITE_END() // CongestionMark
 
+BOOST_AUTO_TEST_SUITE(EgressScheduler)
+
+using TrafficClass = LpEgressScheduler::TrafficClass;
+
+static Name
+getSentName(const Transport::Packet& tp)
+{
+  lp::Packet pkt(tp.packet);
+  ndn::Buffer::const_iterator fragBegin, fragEnd;
+  std::tie(fragBegin, fragEnd) = pkt.get<lp::FragmentField>();
+  Block netPkt(&*fragBegin, std::distance(fragBegin, fragEnd));
+  netPkt.parse();
+  return Name(netPkt.get(tlv::Name));
+}
+
+BOOST_AUTO_TEST_CASE(PassThrough)
+{
+  GenericLinkService::Options options;
+  options.schedulerOptions.isEnabled = true;
+  initialize(options);
+
+  transport->setSendQueueLength(0);
+  face->sendInterest(*makeInterest("/A"));
+  face->sendData(*makeData("/B"));
+
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_CHECK_EQUAL(service->getEgressScheduler().getCounters(TrafficClass::INTEREST).nSent, 1);
+  BOOST_CHECK_EQUAL(service->getEgressScheduler().getCounters(TrafficClass::DATA).nSent, 1);
+}
+
+BOOST_AUTO_TEST_CASE(StrictPriority)
+{
+  GenericLinkService::Options options;
+  options.schedulerOptions.isEnabled = true;
+  options.schedulerOptions.maxTransportBacklog = 65536;
+  initialize(options);
+  const auto& scheduler = service->getEgressScheduler();
+
+  // transport is backlogged, packets are held in the scheduler
+  transport->setSendQueueLength(100000);
+  face->sendData(*makeData("/bulk/1"));
+  face->sendData(*makeData("/bulk/2"));
+  face->sendNack(makeNack("/nack", 323, lp::NackReason::CONGESTION));
+  auto emergency = makeData("/emergency");
+  emergency->setEmergencyInd("Emergency");
+  face->sendData(*emergency);
+
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(TrafficClass::DATA), 2);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(TrafficClass::NACK), 1);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(TrafficClass::EMERGENCY), 1);
+
+  advanceClocks(1_ms, 5);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+
+  transport->setSendQueueLength(0);
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 4);
+  BOOST_CHECK_EQUAL(getSentName(transport->sentPackets[0]), "/emergency");
+  BOOST_CHECK_EQUAL(scheduler.getCounters(TrafficClass::EMERGENCY).nSent, 1);
+  BOOST_CHECK_EQUAL(scheduler.getCounters(TrafficClass::NACK).nSent, 1);
+  BOOST_CHECK_EQUAL(scheduler.getCounters(TrafficClass::DATA).nSent, 2);
+}
+
+BOOST_AUTO_TEST_CASE(QueueOverflow)
+{
+  GenericLinkService::Options options;
+  options.schedulerOptions.isEnabled = true;
+  options.schedulerOptions.queueCapacity[static_cast<size_t>(TrafficClass::DATA)] = 2;
+  initialize(options);
+  const auto& scheduler = service->getEgressScheduler();
+
+  transport->setSendQueueLength(100000);
+  face->sendData(*makeData("/bulk/1"));
+  face->sendData(*makeData("/bulk/2"));
+  face->sendData(*makeData("/bulk/3"));
+  face->sendInterest(*makeInterest("/A"));
+
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(TrafficClass::DATA), 2);
+  BOOST_CHECK_EQUAL(scheduler.getCounters(TrafficClass::DATA).nDropped, 1);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(TrafficClass::INTEREST), 1);
+  BOOST_CHECK_EQUAL(scheduler.getCounters(TrafficClass::INTEREST).nDropped, 0);
+
+  transport->setSendQueueLength(0);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(EgressRate)
+{
+  GenericLinkService::Options options;
+  options.schedulerOptions.isEnabled = true;
+  options.schedulerOptions.egressRate = 100000; // 100 octets per millisecond
+  options.schedulerOptions.maxBurstSize = 0;
+  initialize(options);
+
+  auto interest = makeInterest("/A");
+  for (int i = 0; i < 10; ++i) {
+    face->sendInterest(*interest);
+  }
+  // with an empty bucket, the first packet goes out immediately and puts the bucket in deficit
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+  size_t packetSize = transport->sentPackets.front().packet.size();
+  BOOST_REQUIRE_LT(packetSize, 100);
+
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK_GT(transport->sentPackets.size(), 5);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size() +
+                    service->getEgressScheduler().getQueueLength(TrafficClass::INTEREST), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // EgressScheduler
+
 BOOST_AUTO_TEST_SUITE(LpFields)
 
 BOOST_AUTO_TEST_CASE(ReceiveNextHopFaceId)
@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/lp-ack-range.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <ndn-cxx/lp/packet.hpp>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestLpAckRange, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Advertisement)
+{
+  LpAckRange ackRange;
+  BOOST_CHECK(ackRange.empty());
+  BOOST_CHECK(ackRange.getSequences().empty());
+
+  lp::Packet pkt;
+  pkt.add<AckRangeField>(ackRange);
+  BOOST_CHECK_EQUAL(pkt.get<AckRangeField>().getEncodedSize(), 4);
+
+  lp::Packet decoded(pkt.wireEncode());
+  BOOST_REQUIRE(decoded.has<AckRangeField>());
+  BOOST_CHECK(decoded.get<AckRangeField>().empty());
+}
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  LpAckRange ackRange(1000);
+  BOOST_CHECK(ackRange.add(1000)); // base is already acknowledged
+  BOOST_CHECK(ackRange.add(1001));
+  BOOST_CHECK(ackRange.add(1009));
+  BOOST_CHECK(ackRange.add(1256));
+  BOOST_CHECK(!ackRange.add(1257)); // beyond MAX_BITMAP_SIZE
+  BOOST_CHECK(!ackRange.add(999));
+  BOOST_CHECK(!ackRange.add(1020, 1));
+  BOOST_CHECK_EQUAL(ackRange.getEncodedSize(),
+                    3 + 1 + LpAckRange::RANGE_BASE_SIZE + LpAckRange::MAX_BITMAP_SIZE);
+
+  lp::Packet pkt;
+  pkt.add<lp::AckField>(1);
+  pkt.add<AckRangeField>(ackRange);
+
+  lp::Packet decoded(pkt.wireEncode());
+  BOOST_CHECK_EQUAL(decoded.get<lp::AckField>(), 1);
+  std::vector<lp::Sequence> seqs = decoded.get<AckRangeField>().getSequences();
+  std::vector<lp::Sequence> expectedSeqs{1000, 1001, 1009, 1256};
+  BOOST_CHECK_EQUAL_COLLECTIONS(seqs.begin(), seqs.end(), expectedSeqs.begin(), expectedSeqs.end());
+}
+
+BOOST_AUTO_TEST_CASE(MultipleRanges)
+{
+  LpAckRange ackRange(2000);
+  for (lp::Sequence seq = 2001; seq < 2100; ++seq) {
+    BOOST_CHECK(ackRange.add(seq));
+  }
+  ackRange.addRange(2300);
+  ackRange.addRange(1999);
+  BOOST_CHECK_EQUAL(ackRange.getNRanges(), 3);
+  BOOST_CHECK_EQUAL(ackRange.getValueSize(), 3 * LpAckRange::RANGE_BASE_SIZE + 13);
+
+  lp::Packet pkt;
+  pkt.add<AckRangeField>(ackRange);
+  ndn::Buffer payload(100);
+  pkt.add<lp::FragmentField>(std::make_pair(payload.begin(), payload.end()));
+
+  // decoded by the lp::Packet a receiver uses, which sees one ignorable field
+  lp::Packet decoded;
+  BOOST_REQUIRE_NO_THROW(decoded.wireDecode(pkt.wireEncode()));
+  BOOST_CHECK(decoded.has<lp::FragmentField>());
+  BOOST_REQUIRE_EQUAL(decoded.count<AckRangeField>(), 1);
+
+  LpAckRange decodedRange = decoded.get<AckRangeField>();
+  BOOST_CHECK_EQUAL(decodedRange.getNRanges(), 3);
+  std::vector<lp::Sequence> seqs = decodedRange.getSequences();
+  std::vector<lp::Sequence> expectedSeqs;
+  for (lp::Sequence seq = 2000; seq < 2100; ++seq) {
+    expectedSeqs.push_back(seq);
+  }
+  expectedSeqs.push_back(2300);
+  expectedSeqs.push_back(1999);
+  BOOST_CHECK_EQUAL_COLLECTIONS(seqs.begin(), seqs.end(), expectedSeqs.begin(), expectedSeqs.end());
+}
+
+BOOST_AUTO_TEST_CASE(DecodeTruncated)
+{
+  // base without bitmap length
+  const uint8_t wire1[] = {0xfd, 0x03, 0xbc, 0x08, 0, 0, 0, 0, 0, 0, 0x03, 0xe8};
+  BOOST_CHECK_THROW(LpAckRange(Block(wire1, sizeof(wire1))), LpAckRange::Error);
+
+  // bitmap length exceeds remaining octets
+  const uint8_t wire2[] = {0xfd, 0x03, 0xbc, 0x0a, 0, 0, 0, 0, 0, 0, 0x03, 0xe8, 0x02, 0x80};
+  BOOST_CHECK_THROW(LpAckRange(Block(wire2, sizeof(wire2))), LpAckRange::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Wraparound)
+{
+  LpAckRange ackRange(0xFFFFFFFFFFFFFFFE);
+  BOOST_CHECK(ackRange.add(0xFFFFFFFFFFFFFFFF));
+  BOOST_CHECK(ackRange.add(1));
+
+  ndn::EncodingBuffer encoder;
+  ackRange.wireEncode(encoder);
+  LpAckRange decoded(encoder.block());
+  std::vector<lp::Sequence> seqs = decoded.getSequences();
+  std::vector<lp::Sequence> expectedSeqs{0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFF, 1};
+  BOOST_CHECK_EQUAL_COLLECTIONS(seqs.begin(), seqs.end(), expectedSeqs.begin(), expectedSeqs.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLpAckRange
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
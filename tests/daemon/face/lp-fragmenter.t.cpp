@@ -152,6 +152,45 @@ BOOST_AUTO_TEST_CASE(FragmentMultipleFragments)
                                 reassembledPayload.begin(), reassembledPayload.end());
 }
 
+BOOST_AUTO_TEST_CASE(FragmentWithSequence)
+{
+  size_t mtu = Transport::MIN_MTU;
+
+  lp::Packet packet;
+  packet.add<lp::IncomingFaceIdField>(123);
+
+  shared_ptr<Data> data = makeData("/test/data1/123456789/987654321/123456789");
+  packet.add<lp::FragmentField>(std::make_pair(data->wireEncode().begin(),
+                                               data->wireEncode().end()));
+
+  bool isOk = false;
+  std::vector<lp::Packet> frags;
+  std::tie(isOk, frags) = fragmenter.fragmentPacket(packet, mtu, lp::Sequence(1000));
+
+  BOOST_REQUIRE(isOk);
+  BOOST_REQUIRE_EQUAL(frags.size(), 5);
+
+  ndn::Buffer reassembledPayload;
+  for (size_t i = 0; i < frags.size(); ++i) {
+    BOOST_CHECK_EQUAL(frags[i].get<lp::SequenceField>(), 1000 + i);
+    BOOST_CHECK_EQUAL(frags[i].get<lp::FragIndexField>(), i);
+    BOOST_CHECK_EQUAL(frags[i].get<lp::FragCountField>(), 5);
+    BOOST_CHECK_EQUAL(frags[i].has<lp::IncomingFaceIdField>(), i == 0);
+    BOOST_CHECK_LE(frags[i].wireEncode().size(), mtu);
+
+    // each fragment must decode to the same fields after a round trip
+    lp::Packet decoded(frags[i].wireEncode());
+    BOOST_CHECK_EQUAL(decoded.get<lp::SequenceField>(), 1000 + i);
+
+    ndn::Buffer::const_iterator fragBegin, fragEnd;
+    std::tie(fragBegin, fragEnd) = frags[i].get<lp::FragmentField>();
+    reassembledPayload.insert(reassembledPayload.end(), fragBegin, fragEnd);
+  }
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(data->wireEncode().begin(), data->wireEncode().end(),
+                                reassembledPayload.begin(), reassembledPayload.end());
+}
+
 BOOST_AUTO_TEST_CASE(FragmentMtuTooSmall)
 {
   size_t mtu = 20;
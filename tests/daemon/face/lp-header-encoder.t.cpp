@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/lp-header-encoder.hpp"
+#include "face/transport.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <ndn-cxx/lp/packet.hpp>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestLpHeaderEncoder, BaseFixture)
+
+/** \brief joins the header encoded by \p header with \p netPkt, as a transport would send them
+ */
+static Block
+encodeLpPacket(const LpHeaderEncoder& header, const Block& netPkt)
+{
+  Transport::Packet packet{Block(netPkt)};
+  packet.header = header.encode(netPkt.size());
+  packet.join();
+  return packet.packet;
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  LpHeaderEncoder header;
+  BOOST_CHECK(header.empty());
+
+  shared_ptr<Data> data = makeData("/test/data1");
+  Block wire = encodeLpPacket(header, data->wireEncode());
+
+  lp::Packet expected(data->wireEncode());
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(),
+                                expected.wireEncode().begin(), expected.wireEncode().end());
+}
+
+BOOST_AUTO_TEST_CASE(SameAsLpPacket)
+{
+  shared_ptr<Interest> interest = makeInterest("/test/interest1", 0x7a23);
+  lp::NackHeader nackHeader;
+  nackHeader.setReason(lp::NackReason::CONGESTION);
+
+  // fields are added out of TLV-TYPE order
+  LpHeaderEncoder header;
+  header.add<lp::CchTagField>(1);
+  header.add<lp::HopCountTagField>(5);
+  header.add<lp::CongestionMarkField>(2);
+  header.add<lp::IncomingFaceIdField>(300);
+  header.add<lp::NonDiscoveryField>(lp::EmptyValue{});
+  header.add<lp::NackField>(nackHeader);
+  BOOST_CHECK(!header.empty());
+
+  lp::Packet expected(interest->wireEncode());
+  expected.add<lp::CchTagField>(1);
+  expected.add<lp::HopCountTagField>(5);
+  expected.add<lp::CongestionMarkField>(2);
+  expected.add<lp::IncomingFaceIdField>(300);
+  expected.add<lp::NonDiscoveryField>(lp::EmptyValue{});
+  expected.add<lp::NackField>(nackHeader);
+
+  Block wire = encodeLpPacket(header, interest->wireEncode());
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(),
+                                expected.wireEncode().begin(), expected.wireEncode().end());
+
+  lp::Packet decoded;
+  BOOST_REQUIRE_NO_THROW(decoded.wireDecode(wire));
+  BOOST_CHECK_EQUAL(decoded.get<lp::HopCountTagField>(), 5);
+  BOOST_CHECK_EQUAL(decoded.get<lp::IncomingFaceIdField>(), 300);
+  BOOST_CHECK_EQUAL(decoded.get<lp::NackField>().getReason(), lp::NackReason::CONGESTION);
+}
+
+BOOST_AUTO_TEST_CASE(LargePacket)
+{
+  // the header does not contain the packet, and its TLV-LENGTH fields are correct
+  shared_ptr<Data> data = makeData("/test/data2");
+  data->setContent(std::vector<uint8_t>(8000, 0xBB).data(), 8000);
+  signData(data);
+
+  LpHeaderEncoder header;
+  header.add<lp::HopCountTagField>(0);
+
+  lp::Packet expected(data->wireEncode());
+  expected.add<lp::HopCountTagField>(0);
+
+  BOOST_CHECK_LT(header.encode(data->wireEncode().size())->size(), LpHeaderEncoder::HEADROOM);
+
+  Block wire = encodeLpPacket(header, data->wireEncode());
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(),
+                                expected.wireEncode().begin(), expected.wireEncode().end());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLpHeaderEncoder
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -321,6 +321,81 @@ BOOST_AUTO_TEST_CASE(Timeout)
   BOOST_REQUIRE(!isComplete);
 }
 
+BOOST_AUTO_TEST_CASE(UnevenFragments)
+{
+  // payload sizes 3, 5, 2: the second fragment is larger than the first,
+  // and the last fragment arrives first
+  ndn::Buffer data0Buffer(data, 3);
+  ndn::Buffer data1Buffer(data + 3, 5);
+  ndn::Buffer data2Buffer(data + 8, 2);
+
+  lp::Packet frag0;
+  frag0.add<lp::FragmentField>(std::make_pair(data0Buffer.begin(), data0Buffer.end()));
+  frag0.add<lp::FragIndexField>(0);
+  frag0.add<lp::FragCountField>(3);
+  frag0.add<lp::SequenceField>(1000);
+  frag0.add<lp::NextHopFaceIdField>(200);
+
+  lp::Packet frag1;
+  frag1.add<lp::FragmentField>(std::make_pair(data1Buffer.begin(), data1Buffer.end()));
+  frag1.add<lp::FragIndexField>(1);
+  frag1.add<lp::FragCountField>(3);
+  frag1.add<lp::SequenceField>(1001);
+
+  lp::Packet frag2;
+  frag2.add<lp::FragmentField>(std::make_pair(data2Buffer.begin(), data2Buffer.end()));
+  frag2.add<lp::FragIndexField>(2);
+  frag2.add<lp::FragCountField>(3);
+  frag2.add<lp::SequenceField>(1002);
+
+  bool isComplete = false;
+  Block netPacket;
+  lp::Packet packet;
+
+  std::tie(isComplete, std::ignore, std::ignore) = reassembler.receiveFragment(0, frag2);
+  BOOST_REQUIRE(!isComplete);
+
+  std::tie(isComplete, std::ignore, std::ignore) = reassembler.receiveFragment(0, frag0);
+  BOOST_REQUIRE(!isComplete);
+
+  std::tie(isComplete, netPacket, packet) = reassembler.receiveFragment(0, frag1);
+  BOOST_REQUIRE(isComplete);
+  BOOST_CHECK(packet.has<lp::NextHopFaceIdField>());
+  BOOST_CHECK_EQUAL_COLLECTIONS(data, data + sizeof(data), netPacket.begin(), netPacket.end());
+}
+
+BOOST_AUTO_TEST_CASE(TimeoutExtendedByFragment)
+{
+  ndn::Buffer data0Buffer(data, 4);
+  ndn::Buffer data1Buffer(data + 4, 4);
+
+  lp::Packet frag0;
+  frag0.add<lp::FragmentField>(std::make_pair(data0Buffer.begin(), data0Buffer.end()));
+  frag0.add<lp::FragIndexField>(0);
+  frag0.add<lp::FragCountField>(3);
+  frag0.add<lp::SequenceField>(1000);
+
+  lp::Packet frag1;
+  frag1.add<lp::FragmentField>(std::make_pair(data1Buffer.begin(), data1Buffer.end()));
+  frag1.add<lp::FragIndexField>(1);
+  frag1.add<lp::FragCountField>(3);
+  frag1.add<lp::SequenceField>(1001);
+
+  reassembler.receiveFragment(0, frag0);
+  advanceClocks(time::milliseconds(1), 400);
+  reassembler.receiveFragment(0, frag1);
+
+  // 800ms after the first fragment, but only 400ms after the second
+  advanceClocks(time::milliseconds(1), 400);
+  BOOST_CHECK_EQUAL(reassembler.size(), 1);
+  BOOST_CHECK(timeoutHistory.empty());
+
+  advanceClocks(time::milliseconds(1), 200);
+  BOOST_CHECK_EQUAL(reassembler.size(), 0);
+  BOOST_REQUIRE_EQUAL(timeoutHistory.size(), 1);
+  BOOST_CHECK_EQUAL(std::get<1>(timeoutHistory.back()), 2);
+}
+
 BOOST_AUTO_TEST_CASE(MissingSequence)
 {
   ndn::Buffer data1Buffer(data, 4);
@@ -379,6 +454,44 @@ BOOST_AUTO_TEST_CASE(FragCountOverLimit)
   BOOST_REQUIRE(!isComplete);
 }
 
+BOOST_AUTO_TEST_CASE(PacketSizeOverLimit)
+{
+  ndn::Buffer payload(4000);
+  bool isComplete = false;
+
+  // 100 fragments of 4000 octets each cannot form a packet under MAX_NDN_PACKET_SIZE,
+  // so the buffer for them is not allocated
+  lp::Packet large0;
+  large0.add<lp::FragmentField>(std::make_pair(payload.begin(), payload.end()));
+  large0.add<lp::FragIndexField>(0);
+  large0.add<lp::FragCountField>(100);
+  large0.add<lp::SequenceField>(1000);
+
+  std::tie(isComplete, std::ignore, std::ignore) = reassembler.receiveFragment(0, large0);
+  BOOST_CHECK(!isComplete);
+  BOOST_CHECK_EQUAL(reassembler.size(), 0);
+
+  // 3 fragments of 4000 octets fit in the buffer, but the packet exceeds MAX_NDN_PACKET_SIZE
+  // once the third fragment arrives, and the partial packet is dropped
+  lp::Packet frags[3];
+  for (size_t i = 0; i < 3; ++i) {
+    frags[i].add<lp::FragmentField>(std::make_pair(payload.begin(), payload.end()));
+    frags[i].add<lp::FragIndexField>(i);
+    frags[i].add<lp::FragCountField>(3);
+    frags[i].add<lp::SequenceField>(2000 + i);
+  }
+
+  std::tie(isComplete, std::ignore, std::ignore) = reassembler.receiveFragment(0, frags[0]);
+  BOOST_CHECK(!isComplete);
+  std::tie(isComplete, std::ignore, std::ignore) = reassembler.receiveFragment(0, frags[1]);
+  BOOST_CHECK(!isComplete);
+  BOOST_CHECK_EQUAL(reassembler.size(), 1);
+
+  std::tie(isComplete, std::ignore, std::ignore) = reassembler.receiveFragment(0, frags[2]);
+  BOOST_CHECK(!isComplete);
+  BOOST_CHECK_EQUAL(reassembler.size(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(MissingFragCount)
 {
   ndn::Buffer data1Buffer(data, 4);
@@ -26,6 +26,7 @@
 #include "face/lp-reliability.hpp"
 #include "face/face.hpp"
 #include "face/generic-link-service.hpp"
+#include "face/lp-ack-range.hpp"
 
 #include "tests/test-common.hpp"
 #include "dummy-face.hpp"
@@ -928,6 +929,91 @@ BOOST_AUTO_TEST_CASE(IdleAckTimerMtu)
   BOOST_CHECK(expectedAcks.empty());
 }
 
+BOOST_AUTO_TEST_CASE(AckRangeNegotiation)
+{
+  GenericLinkService::Options options;
+  options.reliabilityOptions.isEnabled = true;
+  options.reliabilityOptions.allowAckRanges = true;
+  linkService->setOptions(options);
+
+  // peer support unknown: Acks are sent individually, along with an AckRange advertisement
+  for (lp::Sequence i = 1000; i < 1010; i++) {
+    reliability->m_ackQueue.push(i);
+  }
+  reliability->startIdleAckTimer();
+  advanceClocks(time::milliseconds(1), 5);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  lp::Packet sentPkt1(transport->sentPackets.back().packet);
+  BOOST_CHECK_EQUAL(sentPkt1.count<lp::AckField>(), 10);
+  BOOST_REQUIRE_EQUAL(sentPkt1.count<AckRangeField>(), 1);
+  BOOST_CHECK(sentPkt1.get<AckRangeField>().empty());
+
+  // peer advertises support
+  lp::Packet advertisement;
+  advertisement.add<AckRangeField>(LpAckRange());
+  reliability->processIncomingPacket(advertisement);
+  BOOST_CHECK(reliability->m_isPeerAckRangeCapable);
+
+  // Acks are sent as AckRanges, out-of-order and duplicate Acks included
+  std::set<lp::Sequence> expectedAcks;
+  for (lp::Sequence i = 2000; i < 2100; i++) {
+    reliability->m_ackQueue.push(i);
+    expectedAcks.insert(i);
+  }
+  reliability->m_ackQueue.push(2300);
+  reliability->m_ackQueue.push(2050);
+  reliability->m_ackQueue.push(1999);
+  expectedAcks.insert(2300);
+  expectedAcks.insert(1999);
+  reliability->startIdleAckTimer();
+  advanceClocks(time::milliseconds(1), 5);
+  BOOST_CHECK_EQUAL(reliability->m_ackQueue.size(), 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+
+  lp::Packet sentPkt2(transport->sentPackets.back().packet);
+  BOOST_CHECK_EQUAL(sentPkt2.count<lp::AckField>(), 0);
+  BOOST_REQUIRE_EQUAL(sentPkt2.count<AckRangeField>(), 1);
+  LpAckRange sentRange = sentPkt2.get<AckRangeField>();
+  BOOST_CHECK_EQUAL(sentRange.getNRanges(), 3); // 2000-2099, 2300, 1999
+  std::set<lp::Sequence> sentAcks;
+  for (lp::Sequence ack : sentRange.getSequences()) {
+    sentAcks.insert(ack);
+  }
+  BOOST_CHECK_EQUAL_COLLECTIONS(sentAcks.begin(), sentAcks.end(),
+                                expectedAcks.begin(), expectedAcks.end());
+}
+
+BOOST_AUTO_TEST_CASE(LossByGreaterAckRange)
+{
+  // an AckRange has the same effect as individual Acks for the same TxSequences
+
+  linkService->sendLpPackets({makeFrag(1, 50)});
+  linkService->sendLpPackets({makeFrag(2, 50)});
+  linkService->sendLpPackets({makeFrag(3, 50)});
+  linkService->sendLpPackets({makeFrag(4, 50)});
+  linkService->sendLpPackets({makeFrag(5, 50)});
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 5);
+  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+
+  LpAckRange ackRange(3);
+  BOOST_CHECK(ackRange.add(4));
+  BOOST_CHECK(ackRange.add(5));
+  lp::Packet ackPkt;
+  ackPkt.add<AckRangeField>(ackRange);
+  reliability->processIncomingPacket(ackPkt);
+
+  // TxSequence 2 is lost after 3 greater Acks, and retransmitted as TxSequence 7
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(2), 0);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(6), 1);
+  BOOST_REQUIRE_EQUAL(reliability->m_unackedFrags.count(7), 1);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(7).retxCount, 1);
+  BOOST_CHECK_EQUAL(getPktNo(reliability->m_unackedFrags.at(7).pkt), 1);
+  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 6);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 6);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestLpReliability
 BOOST_AUTO_TEST_SUITE_END() // Face
 
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/lp-sequence-ring.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestLpSequenceRing, BaseFixture)
+
+using Ring = LpSequenceRing<std::string>;
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  Ring ring(4);
+  BOOST_CHECK(ring.empty());
+  BOOST_CHECK(ring.begin() == ring.end());
+  BOOST_CHECK_EQUAL(ring.capacity(), 4);
+
+  for (lp::Sequence seq = 10; seq < 15; ++seq) {
+    auto it = ring.emplace(seq, to_string(seq));
+    BOOST_CHECK_EQUAL(it->first, seq);
+  }
+  BOOST_CHECK_EQUAL(ring.size(), 5);
+  BOOST_CHECK_EQUAL(ring.capacity(), 8); // grown
+  BOOST_CHECK_EQUAL(ring.at(12), "12");
+  BOOST_CHECK_EQUAL(ring.count(15), 0);
+  BOOST_CHECK_EQUAL(ring.count(9), 0);
+  BOOST_CHECK_THROW(ring.at(9), std::out_of_range);
+
+  // emplace does not replace an existing entry
+  ring.emplace(12, "other");
+  BOOST_CHECK_EQUAL(ring.at(12), "12");
+  BOOST_CHECK_EQUAL(ring.size(), 5);
+
+  // erase in the middle; iteration skips the hole
+  auto next = ring.erase(ring.find(12));
+  BOOST_CHECK_EQUAL(next->first, 13);
+  std::vector<lp::Sequence> seqs;
+  for (const auto& entry : ring) {
+    seqs.push_back(entry.first);
+  }
+  std::vector<lp::Sequence> expectedSeqs{10, 11, 13, 14};
+  BOOST_CHECK_EQUAL_COLLECTIONS(seqs.begin(), seqs.end(), expectedSeqs.begin(), expectedSeqs.end());
+
+  // erase at the beginning moves the window
+  ring.erase(ring.begin());
+  ring.erase(ring.begin());
+  BOOST_CHECK_EQUAL(ring.begin()->first, 13);
+
+  // erase at the end
+  BOOST_CHECK(ring.erase(ring.find(14)) == ring.end());
+  BOOST_CHECK_EQUAL(ring.size(), 1);
+  BOOST_CHECK(ring.erase(ring.begin()) == ring.end());
+  BOOST_CHECK(ring.empty());
+}
+
+BOOST_AUTO_TEST_CASE(IteratorStability)
+{
+  Ring ring(2);
+  auto it = ring.emplace(100, "100");
+  for (lp::Sequence seq = 101; seq < 200; ++seq) {
+    ring.emplace(seq, to_string(seq));
+  }
+  BOOST_CHECK_GE(ring.capacity(), 100);
+  BOOST_CHECK_EQUAL(it->second, "100");
+  BOOST_CHECK(it == ring.find(100));
+  BOOST_CHECK(it == ring.begin());
+}
+
+BOOST_AUTO_TEST_CASE(Wraparound)
+{
+  Ring ring(4);
+  ring.emplace(0xFFFFFFFFFFFFFFFE, "a");
+  ring.emplace(0xFFFFFFFFFFFFFFFF, "b");
+  ring.emplace(0, "c");
+  ring.emplace(1, "d");
+  BOOST_CHECK_EQUAL(ring.size(), 4);
+  BOOST_CHECK_EQUAL(ring.capacity(), 4);
+
+  std::vector<std::string> values;
+  for (const auto& entry : ring) {
+    values.push_back(entry.second);
+  }
+  std::vector<std::string> expectedValues{"a", "b", "c", "d"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(),
+                                expectedValues.begin(), expectedValues.end());
+
+  ring.erase(ring.find(0xFFFFFFFFFFFFFFFE));
+  ring.erase(ring.find(0xFFFFFFFFFFFFFFFF));
+  BOOST_CHECK_EQUAL(ring.begin()->first, 0);
+  BOOST_CHECK_EQUAL(ring.count(0xFFFFFFFFFFFFFFFF), 0);
+}
+
+BOOST_AUTO_TEST_CASE(WindowTooLarge)
+{
+  Ring ring;
+  ring.emplace(0, "first");
+  BOOST_CHECK_THROW(ring.emplace(Ring::MAX_CAPACITY, "too far"), std::length_error);
+  BOOST_CHECK_NO_THROW(ring.emplace(Ring::MAX_CAPACITY - 1, "last"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLpSequenceRing
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -26,6 +26,8 @@
 #include "transport-test-common.hpp"
 
 #include "ethernet-fixture.hpp"
+#include "dummy-receive-link-service.hpp"
+#include "face/face.hpp"
 
 namespace nfd {
 namespace face {
@@ -116,6 +118,79 @@ BOOST_AUTO_TEST_CASE(SendQueueLength)
   BOOST_CHECK_EQUAL(transport->getSendQueueLength(), QUEUE_UNSUPPORTED);
 }
 
+#ifdef __linux__
+BOOST_AUTO_TEST_SUITE(PacketRing)
+
+BOOST_AUTO_TEST_CASE(StaticProperties)
+{
+  SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
+
+  EthernetPacketRing::Options ringOptions;
+  ringOptions.isEnabled = true;
+  ringOptions.nRxBlocks = 4;
+  ringOptions.nTxFrames = 16;
+  initializeMulticast(ndn::nfd::LINK_TYPE_MULTI_ACCESS, ethernet::getBroadcastAddress(), ringOptions);
+
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+  BOOST_CHECK_EQUAL(transport->getRemoteUri(), FaceUri("ether://[" + remoteEp.toString() + "]"));
+  BOOST_CHECK_EQUAL(transport->getMtu(), netif->getMtu());
+}
+
+// This test case requires a veth pair, which can be created with:
+//   ip link add nfd-veth0 type veth peer name nfd-veth1
+//   ip link set nfd-veth0 up && ip link set nfd-veth1 up
+BOOST_AUTO_TEST_CASE(SendReceiveOverVeth)
+{
+  auto findNetif = [this] (const std::string& name) -> shared_ptr<const ndn::net::NetworkInterface> {
+    auto it = std::find_if(netifs.begin(), netifs.end(),
+                           [&name] (const auto& netif) { return netif->getName() == name; });
+    return it == netifs.end() ? nullptr : *it;
+  };
+  auto netif0 = findNetif("nfd-veth0");
+  auto netif1 = findNetif("nfd-veth1");
+  if (netif0 == nullptr || netif1 == nullptr) {
+    BOOST_WARN_MESSAGE(false, "skipping assertions that require the nfd-veth0/nfd-veth1 veth pair");
+    return;
+  }
+
+  EthernetPacketRing::Options ringOptions;
+  ringOptions.isEnabled = true;
+  ringOptions.nRxBlocks = 4;
+  ringOptions.nTxFrames = 16;
+
+  auto makeFace = [&] (const ndn::net::NetworkInterface& netif) {
+    return make_unique<Face>(make_unique<DummyReceiveLinkService>(),
+                             make_unique<MulticastEthernetTransport>(netif, ethernet::getBroadcastAddress(),
+                                                                     ndn::nfd::LINK_TYPE_MULTI_ACCESS,
+                                                                     ringOptions));
+  };
+  auto face0 = makeFace(*netif0);
+  auto face1 = makeFace(*netif1);
+  auto& received = static_cast<DummyReceiveLinkService*>(face1->getLinkService())->receivedPackets;
+
+  // more packets than transmit ring slots, so that the ring has to be flushed while sending
+  const size_t nPackets = 100;
+  size_t nBytes = 0;
+  for (size_t i = 0; i < nPackets; ++i) {
+    Block pkt = ndn::encoding::makeStringBlock(300, "packet " + to_string(i));
+    nBytes += pkt.size();
+    face0->getTransport()->send(Transport::Packet(std::move(pkt)));
+  }
+
+  limitedIo.defer(500_ms);
+
+  BOOST_CHECK_EQUAL(face0->getTransport()->getCounters().nOutPackets, nPackets);
+  BOOST_REQUIRE_EQUAL(received.size(), nPackets);
+  BOOST_CHECK_EQUAL(face1->getTransport()->getCounters().nInBytes, nBytes);
+  BOOST_CHECK_EQUAL(ndn::encoding::readString(received.front().packet), "packet 0");
+  BOOST_CHECK_EQUAL(ndn::encoding::readString(received.back().packet), "packet " + to_string(nPackets - 1));
+  BOOST_CHECK_EQUAL(received.front().remoteEndpoint,
+                    received.back().remoteEndpoint);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PacketRing
+#endif // __linux__
+
 BOOST_AUTO_TEST_SUITE_END() // TestMulticastEthernetTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
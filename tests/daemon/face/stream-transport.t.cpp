@@ -70,6 +70,35 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Send, T, StreamTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendBurst, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // more packets than fit in one gather write
+  const size_t nPackets = 3 * TcpTransport::MAX_SEND_BUFFERS + 1;
+  ndn::Buffer expected;
+  for (size_t i = 0; i < nPackets; ++i) {
+    auto block = ndn::encoding::makeNonNegativeIntegerBlock(300, i);
+    expected.insert(expected.end(), block.begin(), block.end());
+    this->transport->send(Transport::Packet{std::move(block)});
+  }
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, nPackets);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutBytes, expected.size());
+  BOOST_CHECK_GE(this->transport->getSendQueueLength(), 0);
+
+  std::vector<uint8_t> readBuf(expected.size());
+  boost::asio::async_read(this->remoteSocket, boost::asio::buffer(readBuf),
+    [this] (const boost::system::error_code& error, size_t) {
+      BOOST_REQUIRE_EQUAL(error, boost::system::errc::success);
+      this->limitedIo.afterOp();
+    });
+
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveNormal, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
@@ -125,6 +154,28 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveMultipleBlocks, T, StreamTransportFixtur
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveBurst, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // enough data to wrap around the receive buffer several times,
+  // with packets straddling the boundaries of individual reads
+  std::vector<uint8_t> bytes(1000, 0xAA);
+  Block pkt = ndn::encoding::makeBinaryBlock(300, bytes.data(), bytes.size());
+  const size_t nPackets = 3 * TcpTransport::RECEIVE_BUFFER_SIZE / pkt.size();
+  ndn::Buffer buf;
+  for (size_t i = 0; i < nPackets; ++i) {
+    buf.insert(buf.end(), pkt.begin(), pkt.end());
+  }
+
+  this->remoteWrite(buf);
+
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInPackets, nPackets);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInBytes, buf.size());
+  BOOST_CHECK_EQUAL(this->receivedPackets->size(), nPackets);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveTooLarge, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
@@ -263,6 +263,28 @@ BOOST_FIXTURE_TEST_CASE(Send, DummyTransportFixture)
   BOOST_CHECK(sentPackets->at(2).packet == pkt3);
 }
 
+BOOST_FIXTURE_TEST_CASE(SendSeparateHeader, DummyTransportFixture)
+{
+  this->initialize();
+
+  Block inner = ndn::encoding::makeStringBlock(301, "consectetur adipiscing elit,");
+  Transport::Packet packet{Block(inner)};
+  const uint8_t header[] = {200, static_cast<uint8_t>(inner.size())};
+  packet.header = make_shared<ndn::Buffer>(header, sizeof(header));
+  BOOST_CHECK_EQUAL(packet.size(), inner.size() + 2);
+
+  Block expected(200);
+  expected.push_back(inner);
+  expected.encode();
+
+  // DummyTransport cannot send a separate header, so the header is joined with the packet
+  transport->send(std::move(packet));
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutBytes, expected.size());
+  BOOST_REQUIRE_EQUAL(sentPackets->size(), 1);
+  BOOST_CHECK(sentPackets->at(0).header == nullptr);
+  BOOST_CHECK(sentPackets->at(0).packet == expected);
+}
+
 BOOST_FIXTURE_TEST_CASE(Receive, DummyTransportFixture)
 {
   this->initialize();
@@ -52,7 +52,8 @@ protected:
 
   void
   initialize(ip::address address,
-             ndn::nfd::FacePersistency persistency = ndn::nfd::FACE_PERSISTENCY_PERSISTENT)
+             ndn::nfd::FacePersistency persistency = ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+             size_t ioBatchSize = 1)
   {
     udp::socket sock(g_io);
     sock.connect(udp::endpoint(address, 7070));
@@ -62,7 +63,8 @@ protected:
 
     face = make_unique<Face>(
              make_unique<DummyReceiveLinkService>(),
-             make_unique<UnicastUdpTransport>(std::move(sock), persistency, time::seconds(3)));
+             make_unique<UnicastUdpTransport>(std::move(sock), persistency, time::seconds(3),
+                                              nullopt, ioBatchSize));
     transport = static_cast<UnicastUdpTransport*>(face->getTransport());
     receivedPackets = &static_cast<DummyReceiveLinkService*>(face->getLinkService())->receivedPackets;
 
@@ -175,6 +175,38 @@ BOOST_FIXTURE_TEST_CASE(RemoteClosePermanent, RemoteCloseFixture)
   BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
 }
 
+BOOST_AUTO_TEST_CASE(BatchedIo)
+{
+  TRANSPORT_TEST_INIT(ndn::nfd::FACE_PERSISTENCY_PERSISTENT, 8);
+
+  // packets sent in one event loop iteration are coalesced, and all arrive
+  Block block1 = ndn::encoding::makeStringBlock(300, "hello");
+  for (int i = 0; i < 3; ++i) {
+    transport->send(Transport::Packet{Block{block1}}); // make a copy of the block
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, 3);
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutBytes, 3 * block1.size());
+
+  for (int i = 0; i < 3; ++i) {
+    std::vector<uint8_t> readBuf(block1.size());
+    remoteRead(readBuf);
+    BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), block1.begin(), block1.end());
+  }
+
+  // a burst of datagrams is delivered to the link service
+  Block block2 = ndn::encoding::makeStringBlock(301, "world");
+  ndn::Buffer buf(block2.begin(), block2.end());
+  for (int i = 0; i < 10; ++i) {
+    remoteSocket.send(boost::asio::buffer(buf));
+  }
+  limitedIo.defer(time::seconds(1));
+
+  BOOST_CHECK_EQUAL(transport->getCounters().nInPackets, 10);
+  BOOST_CHECK_EQUAL(transport->getCounters().nInBytes, 10 * block2.size());
+  BOOST_CHECK_EQUAL(receivedPackets->size(), 10);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnicastUdpTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
@@ -0,0 +1,94 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/face-set.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestFaceSet, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(InsertDuplicate)
+{
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  face1->setId(300);
+  face2->setId(301);
+
+  FaceSet<> faces;
+  BOOST_CHECK(faces.empty());
+  BOOST_CHECK_EQUAL(faces.insert(*face1), true);
+  BOOST_CHECK_EQUAL(faces.insert(*face2), true);
+  BOOST_CHECK_EQUAL(faces.insert(*face1), false);
+  BOOST_CHECK_EQUAL(faces.size(), 2);
+
+  std::vector<Face*> expected{face1.get(), face2.get()};
+  BOOST_CHECK_EQUAL_COLLECTIONS(faces.begin(), faces.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(BitmapCollision)
+{
+  // FaceIds 300 and 556 share a bit in the 256-bit FaceId bitmap
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  face1->setId(300);
+  face2->setId(556);
+
+  FaceSet<> faces;
+  BOOST_CHECK_EQUAL(faces.insert(*face1), true);
+  BOOST_CHECK_EQUAL(faces.insert(*face2), true);
+  BOOST_CHECK_EQUAL(faces.insert(*face2), false);
+  BOOST_CHECK_EQUAL(faces.insert(*face1), false);
+  BOOST_CHECK_EQUAL(faces.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ExceedInlineCapacity)
+{
+  std::vector<shared_ptr<DummyFace>> allFaces;
+  FaceSet<2> faces;
+  for (FaceId id = 300; id < 310; ++id) {
+    allFaces.push_back(make_shared<DummyFace>());
+    allFaces.back()->setId(id);
+    BOOST_CHECK_EQUAL(faces.insert(*allFaces.back()), true);
+  }
+  for (const auto& face : allFaces) {
+    BOOST_CHECK_EQUAL(faces.insert(*face), false);
+  }
+  BOOST_CHECK_EQUAL(faces.size(), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFaceSet
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
@@ -125,6 +125,61 @@ BOOST_AUTO_TEST_CASE(CsMatched)
   BOOST_CHECK_EQUAL(pit.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(CsAdmitWithoutCopy)
+{
+  Forwarder forwarder;
+
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+
+  Fib& fib = forwarder.getFib();
+  fib.insert("/A").first->addOrUpdateNextHop(*face2, 0, 0);
+
+  shared_ptr<Interest> interestA1 = makeInterest("/A", 1);
+  face1->receiveInterest(*interestA1);
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(5));
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 1);
+
+  shared_ptr<Data> dataA = makeData("/A");
+  dataA->setTag(make_shared<lp::HopCountTag>(3));
+  face2->receiveData(*dataA);
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(5));
+  BOOST_REQUIRE_EQUAL(face1->sentData.size(), 1);
+
+  // CS should store the received Data object itself
+  const cs::Entry* csEntry = forwarder.getCs().findEntry("/A");
+  BOOST_REQUIRE(csEntry != nullptr);
+  BOOST_CHECK_EQUAL(&csEntry->getData(), dataA.get());
+
+  // HopCount should not be served from CS
+  shared_ptr<Interest> interestA2 = makeInterest("/A", 2);
+  face1->receiveInterest(*interestA2);
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(5));
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCsHits, 1);
+  BOOST_REQUIRE_EQUAL(face1->sentData.size(), 2);
+  BOOST_CHECK(face1->sentData[1].getTag<lp::HopCountTag>() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(OwnExecutionContext)
+{
+  auto context = make_unique<ExecutionContext>(7);
+  ExecutionContext* contextPtr = context.get();
+  Forwarder forwarder(std::move(context));
+  BOOST_CHECK_EQUAL(&forwarder.getExecutionContext(), contextPtr);
+  BOOST_CHECK_EQUAL(&forwarder.getCs().getExecutionContext(), contextPtr);
+
+  auto face1 = make_shared<DummyFace>();
+  BOOST_CHECK_EQUAL(&face1->getLinkService()->getExecutionContext(), &getGlobalExecutionContext());
+  forwarder.addFace(face1);
+  BOOST_CHECK_EQUAL(&face1->getLinkService()->getExecutionContext(), contextPtr);
+
+  // a second Forwarder is isolated from the first one
+  Forwarder forwarder2;
+  BOOST_CHECK_NE(&forwarder2.getExecutionContext(), contextPtr);
+}
+
 BOOST_AUTO_TEST_CASE(OutgoingInterest)
 {
   Forwarder forwarder;
@@ -533,6 +588,53 @@ BOOST_AUTO_TEST_CASE(InterestLoopNack)
   BOOST_CHECK(face3->sentNacks.empty());
 }
 
+BOOST_AUTO_TEST_CASE(PitQuotaNack)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+
+  Fib& fib = forwarder.getFib();
+  fib.insert("/A").first->addOrUpdateNextHop(*face3, 0, 0);
+
+  Pit& pit = forwarder.getPit();
+  pit.setPerFaceLimit(1);
+
+  face1->receiveInterest(*makeInterest("/A/1", 1));
+  BOOST_CHECK(face1->sentNacks.empty());
+  BOOST_CHECK_EQUAL(pit.size(), 1);
+
+  // second new entry from face1 exceeds the per-face quota
+  shared_ptr<Interest> interest12 = makeInterest("/A/2", 2);
+  face1->receiveInterest(*interest12);
+  BOOST_REQUIRE_EQUAL(face1->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(face1->sentNacks.back().getInterest(), *interest12);
+  BOOST_CHECK_EQUAL(face1->sentNacks.back().getReason(), lp::NackReason::CONGESTION);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nPitQuotaExceeded, 1);
+  BOOST_CHECK_EQUAL(pit.size(), 1);
+  BOOST_CHECK_EQUAL(face3->sentInterests.size(), 1);
+
+  // face2 has its own quota, and can join the existing entry
+  face2->receiveInterest(*makeInterest("/A/2", 3));
+  face2->receiveInterest(*makeInterest("/A/1", 4));
+  BOOST_CHECK(face2->sentNacks.empty());
+  BOOST_CHECK_EQUAL(pit.size(), 2);
+
+  // global limit
+  pit.setPerFaceLimit(0);
+  pit.setLimit(2);
+  face1->sentNacks.clear();
+  face1->receiveInterest(*makeInterest("/A/3", 5));
+  BOOST_REQUIRE_EQUAL(face1->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(face1->sentNacks.back().getReason(), lp::NackReason::CONGESTION);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nPitQuotaExceeded, 2);
+  BOOST_CHECK_EQUAL(pit.size(), 2);
+}
+
 BOOST_FIXTURE_TEST_CASE(InterestLoopWithShortLifetime, UnitTestTimeFixture) // Bug 1953
 {
   Forwarder forwarder;
@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tests/other/fw/forwarding-shards.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestForwardingShards, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(ShardIndex)
+{
+  for (size_t nShards = 1; nShards <= 16; ++nShards) {
+    size_t i = computeShardIndex("/A/B/1", 2, nShards);
+    BOOST_CHECK_LT(i, nShards);
+    BOOST_CHECK_EQUAL(computeShardIndex("/A/B/2", 2, nShards), i);
+    BOOST_CHECK_EQUAL(computeShardIndex("/A/B", 2, nShards), i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Exchange)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face = make_shared<DummyFace>();
+  fib.insert("/A").first->addOrUpdateNextHop(*face, 0, 0);
+
+  const size_t nPackets = 1000;
+  std::vector<shared_ptr<Interest>> interests;
+  std::vector<shared_ptr<Data>> data;
+  for (size_t i = 0; i < nPackets; ++i) {
+    Name name("/A");
+    name.append(to_string(i % 50)).appendNumber(i);
+    interests.push_back(makeInterest(name, static_cast<uint32_t>(i)));
+    data.push_back(makeData(name));
+  }
+  interests.push_back(makeInterest("/B", 1));
+
+  ShardedForwarding sharded(fib, 4, 2);
+  BOOST_CHECK_EQUAL(sharded.getNShards(), 4);
+  sharded.start();
+  for (const auto& interest : interests) {
+    sharded.dispatchInterest(interest);
+  }
+  for (const auto& d : data) {
+    sharded.dispatchData(d);
+  }
+  sharded.stop();
+
+  uint64_t nInInterests = 0, nSatisfied = 0, nNoRoute = 0, nPitEntries = 0;
+  for (size_t i = 0; i < sharded.getNShards(); ++i) {
+    const auto& counters = sharded.getShard(i).getCounters();
+    nInInterests += counters.nInInterests;
+    nSatisfied += counters.nSatisfiedInterests;
+    nNoRoute += counters.nNoRoute;
+    nPitEntries += sharded.getShard(i).getPit().size();
+  }
+  BOOST_CHECK_EQUAL(nInInterests, nPackets + 1);
+  BOOST_CHECK_EQUAL(nSatisfied, nPackets);
+  BOOST_CHECK_EQUAL(nNoRoute, 1);
+  BOOST_CHECK_EQUAL(nPitEntries, 0);
+}
+
+BOOST_AUTO_TEST_CASE(ExpirePitEntries)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face = make_shared<DummyFace>();
+  fib.insert("/A").first->addOrUpdateNextHop(*face, 0, 0);
+
+  ForwardingShard shard(fib, 16, 16);
+  auto interest1 = makeInterest("/A/1", 1);
+  interest1->setInterestLifetime(10_ms);
+  auto interest2 = makeInterest("/A/2", 2);
+  interest2->setInterestLifetime(10_s);
+  BOOST_CHECK(shard.enqueue({interest1, nullptr}));
+  BOOST_CHECK(shard.enqueue({interest2, nullptr}));
+  BOOST_CHECK_EQUAL(shard.processBatch(ForwardingShard::BATCH_SIZE), 2);
+  BOOST_CHECK_EQUAL(shard.getPit().size(), 2);
+
+  // one second later
+  shard.expirePitEntries(std::chrono::steady_clock::now() + std::chrono::seconds(1));
+  BOOST_CHECK_EQUAL(shard.getPit().size(), 1);
+  BOOST_CHECK_EQUAL(shard.getCounters().nExpiredInterests, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestForwardingShards
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
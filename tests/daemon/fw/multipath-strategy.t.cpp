@@ -0,0 +1,265 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/multipath-strategy.hpp"
+#include "fw/best-route-strategy2.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+#include "topology-tester.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+// The tester is unused in this file, but it's used in various templated test suites.
+typedef StrategyTester<MultipathStrategy> MultipathStrategyTester;
+NFD_REGISTER_STRATEGY(MultipathStrategyTester);
+
+using NexthopInfo = MultipathStrategy::NexthopInfo;
+using MtInfo = MultipathStrategy::MtInfo;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestMultipathStrategy, UnitTestTimeFixture)
+
+BOOST_AUTO_TEST_CASE(Weight)
+{
+  NexthopInfo fast;
+  fast.rtt.addMeasurement(10_ms);
+  NexthopInfo slow;
+  slow.rtt.addMeasurement(40_ms);
+  NexthopInfo unmeasured;
+
+  // weight is inversely proportional to srtt
+  BOOST_CHECK_CLOSE(fast.getWeight(10_ms) / slow.getWeight(10_ms), 4.0, 0.1);
+  // unmeasured nexthop uses fallback srtt
+  BOOST_CHECK_CLOSE(unmeasured.getWeight(10_ms), fast.getWeight(10_ms), 0.1);
+
+  // weight is inversely proportional to outstanding Interests plus one
+  fast.nOutstanding = 3;
+  BOOST_CHECK_CLOSE(fast.getWeight(10_ms), slow.getWeight(10_ms), 0.1);
+  fast.nOutstanding = 0;
+
+  // congestion halves the weight, and unmarked Data recovers it
+  double weight = fast.getWeight(10_ms);
+  fast.recordCongestion();
+  BOOST_CHECK_CLOSE(fast.penalty, 0.5, 0.1);
+  fast.recordData(10_ms, true);
+  BOOST_CHECK_CLOSE(fast.penalty, 0.25, 0.1);
+  BOOST_CHECK_CLOSE(fast.getWeight(10_ms), weight / 4, 0.1);
+  for (int i = 0; i < 32; ++i) {
+    fast.recordData(10_ms, false);
+  }
+  BOOST_CHECK_CLOSE(fast.penalty, 1.0, 0.1);
+
+  // penalty is bounded below, so that a nexthop can recover
+  fast.recordCongestion(true);
+  BOOST_CHECK_CLOSE(fast.penalty, NexthopInfo::MIN_PENALTY, 0.1);
+  fast.recordCongestion();
+  BOOST_CHECK_CLOSE(fast.penalty, NexthopInfo::MIN_PENALTY, 0.1);
+  BOOST_CHECK_GT(fast.getWeight(10_ms), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(Measurements)
+{
+  Forwarder forwarder;
+  choose<MultipathStrategy>(forwarder);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+
+  fib::Entry& fibEntry = *forwarder.getFib().insert("/P").first;
+  fibEntry.addOrUpdateNextHop(*face1, 0, 10);
+
+  auto getNexthopInfo = [&] () -> NexthopInfo& {
+    measurements::Entry* me = forwarder.getMeasurements().findExactMatch("/P");
+    BOOST_REQUIRE(me != nullptr);
+    MtInfo* mi = me->getStrategyInfo<MtInfo>();
+    BOOST_REQUIRE(mi != nullptr);
+    BOOST_REQUIRE_EQUAL(mi->nexthops.count(face1->getId()), 1);
+    return *mi->nexthops.at(face1->getId());
+  };
+
+  // Data with congestion mark
+  face2->receiveInterest(*makeInterest("/P/1", 1));
+  BOOST_REQUIRE_EQUAL(face1->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(getNexthopInfo().nOutstanding, 1);
+  this->advanceClocks(5_ms, 4);
+  auto data = makeData("/P/1");
+  data->setTag(make_shared<lp::CongestionMarkTag>(1));
+  face1->receiveData(*data);
+  BOOST_CHECK_EQUAL(face2->sentData.size(), 1);
+  BOOST_CHECK_EQUAL(getNexthopInfo().nOutstanding, 0);
+  BOOST_CHECK(getNexthopInfo().rtt.hasSamples());
+  BOOST_CHECK_CLOSE(getNexthopInfo().penalty, 0.5, 0.1);
+
+  // Nack with reason Congestion
+  face2->receiveInterest(*makeInterest("/P/2", 2));
+  BOOST_REQUIRE_EQUAL(face1->sentInterests.size(), 2);
+  lp::Nack nack = makeNack(face1->sentInterests.back(), lp::NackReason::CONGESTION);
+  face1->receiveNack(nack);
+  BOOST_CHECK_EQUAL(face2->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(getNexthopInfo().nOutstanding, 0);
+  BOOST_CHECK_CLOSE(getNexthopInfo().penalty, 0.25, 0.1);
+
+  // Interest expires unanswered
+  face2->receiveInterest(*makeInterest("/P/3", 3));
+  BOOST_CHECK_EQUAL(getNexthopInfo().nOutstanding, 1);
+  this->advanceClocks(100_ms, 50);
+  BOOST_CHECK_EQUAL(forwarder.getPit().size(), 0);
+  BOOST_CHECK_EQUAL(getNexthopInfo().nOutstanding, 0);
+  BOOST_CHECK_CLOSE(getNexthopInfo().penalty, 0.125, 0.1);
+}
+
+/** \brief consumer node A and producer node B, connected by two parallel links
+ *
+ *  Each link has 10ms delay, and transmits one packet per millisecond in each direction
+ *  unless specified otherwise.
+ */
+class ParallelLinks : noncopyable
+{
+public:
+  ParallelLinks(TopologyTester& topo, const std::string& label, const Name& strategyName,
+                time::nanoseconds transmissionTime2 = 1_ms)
+    : topo(topo)
+  {
+    nodeA = topo.addForwarder(label + "A");
+    nodeB = topo.addForwarder(label + "B");
+    topo.getForwarder(nodeA).getStrategyChoice().insert("/", strategyName);
+
+    link1 = topo.addLink(label + "1", 10_ms, {nodeA, nodeB});
+    link1->setTransmissionTime(1_ms);
+    link2 = topo.addLink(label + "2", 10_ms, {nodeA, nodeB});
+    link2->setTransmissionTime(transmissionTime2);
+
+    consumer = topo.addAppFace("c", nodeA);
+    producer = topo.addAppFace("p", nodeB, PRODUCER_PREFIX);
+    topo.addEchoProducer(producer->getClientFace(), PRODUCER_PREFIX);
+
+    topo.registerPrefix(nodeA, link1->getFace(nodeA), PRODUCER_PREFIX, 10);
+    topo.registerPrefix(nodeA, link2->getFace(nodeA), PRODUCER_PREFIX, 10);
+  }
+
+  /** \brief sends \p n Interests at \p interval
+   */
+  void
+  runConsumer(time::nanoseconds interval, size_t n)
+  {
+    topo.addIntervalConsumer(consumer->getClientFace(), PRODUCER_PREFIX, interval, n, 0);
+  }
+
+  /** \return number of Data delivered to the consumer
+   */
+  size_t
+  getNDelivered() const
+  {
+    return topo.getPcap(consumer->getForwarderFace()).sentData.size();
+  }
+
+  /** \return number of Interests forwarded on \p link
+   */
+  size_t
+  getNForwarded(TopologyLink& link) const
+  {
+    return topo.getPcap(link.getFace(nodeA)).sentInterests.size();
+  }
+
+public:
+  TopologyTester& topo;
+  TopologyNode nodeA;
+  TopologyNode nodeB;
+  shared_ptr<TopologyLink> link1;
+  shared_ptr<TopologyLink> link2;
+  shared_ptr<TopologyAppLink> consumer;
+  shared_ptr<TopologyAppLink> producer;
+
+  static const Name PRODUCER_PREFIX;
+};
+
+const Name ParallelLinks::PRODUCER_PREFIX("/P");
+
+BOOST_AUTO_TEST_CASE(ThroughputGain)
+{
+  TopologyTester topo;
+  topo.enablePcap();
+  ParallelLinks bestRoute(topo, "R", BestRouteStrategy2::getStrategyName());
+  ParallelLinks multipath(topo, "M", MultipathStrategy::getStrategyName());
+
+  // offered load is about 1667 Interests per second for one second,
+  // which exceeds the capacity of either link, but not of both links together
+  bestRoute.runConsumer(600_us, 1667);
+  multipath.runConsumer(600_us, 1667);
+  this->advanceClocks(100_us, 1100_ms);
+
+  size_t nBestRoute = bestRoute.getNDelivered();
+  size_t nMultipath = multipath.getNDelivered();
+  BOOST_TEST_MESSAGE("Data delivered in 1.1s: best-route=" << nBestRoute <<
+                     " multipath=" << nMultipath);
+
+  // best-route uses one link only, and is limited to its capacity
+  BOOST_CHECK(bestRoute.getNForwarded(*bestRoute.link1) == 0 ||
+              bestRoute.getNForwarded(*bestRoute.link2) == 0);
+  BOOST_CHECK_LT(nBestRoute, 1150);
+
+  // multipath uses both links, and delivers nearly the entire offered load
+  BOOST_CHECK_GT(multipath.getNForwarded(*multipath.link1), 600);
+  BOOST_CHECK_GT(multipath.getNForwarded(*multipath.link2), 600);
+  BOOST_CHECK_GT(nMultipath, 1550);
+  BOOST_CHECK_GT(nMultipath, nBestRoute * 1.35);
+}
+
+BOOST_AUTO_TEST_CASE(UnequalCapacity)
+{
+  TopologyTester topo;
+  topo.enablePcap();
+  // link2 has a quarter of the capacity of link1
+  ParallelLinks multipath(topo, "M", MultipathStrategy::getStrategyName(), 4_ms);
+
+  // offered load is 1000 Interests per second, which exceeds the capacity of link2
+  multipath.runConsumer(1_ms, 2000);
+  this->advanceClocks(100_us, 2200_ms);
+
+  size_t nForwarded1 = multipath.getNForwarded(*multipath.link1);
+  size_t nForwarded2 = multipath.getNForwarded(*multipath.link2);
+  BOOST_TEST_MESSAGE("Interests forwarded: link1=" << nForwarded1 << " link2=" << nForwarded2);
+
+  BOOST_CHECK_GT(nForwarded2, 0);
+  BOOST_CHECK_GT(nForwarded1, nForwarded2 * 2);
+  BOOST_CHECK_GT(multipath.getNDelivered(), 1900);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestMultipathStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
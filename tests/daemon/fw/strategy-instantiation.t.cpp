@@ -33,6 +33,7 @@
 #include "fw/best-route-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
 #include "fw/multicast-strategy.hpp"
+#include "fw/multipath-strategy.hpp"
 #include "fw/ncc-strategy.hpp"
 #include "fw/self-learning-strategy.hpp"
 
@@ -79,6 +80,7 @@ using Tests = boost::mpl::vector<
   Test<BestRouteStrategy, false, 1>,
   Test<BestRouteStrategy2, false, 5>,
   Test<MulticastStrategy, false, 3>,
+  Test<MultipathStrategy, false, 1>,
   Test<NccStrategy, false, 1>,
   Test<SelfLearningStrategy, false, 1>
 >;
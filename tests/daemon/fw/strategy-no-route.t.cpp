@@ -33,6 +33,7 @@
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
 #include "fw/multicast-strategy.hpp"
+#include "fw/multipath-strategy.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/limited-io.hpp"
@@ -150,7 +151,11 @@ using Tests = boost::mpl::vector<
 
   Test<MulticastStrategy, EmptyNextHopList<MulticastStrategy>>,
   Test<MulticastStrategy, NextHopIsDownstream<MulticastStrategy>>,
-  Test<MulticastStrategy, NextHopViolatesScope<MulticastStrategy>>
+  Test<MulticastStrategy, NextHopViolatesScope<MulticastStrategy>>,
+
+  Test<MultipathStrategy, EmptyNextHopList<MultipathStrategy>>,
+  Test<MultipathStrategy, NextHopIsDownstream<MultipathStrategy>>,
+  Test<MultipathStrategy, NextHopViolatesScope<MultipathStrategy>>
 >;
 
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(IncomingInterest, T, Tests,
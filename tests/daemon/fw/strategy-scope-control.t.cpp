@@ -33,6 +33,7 @@
 #include "fw/best-route-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
 #include "fw/multicast-strategy.hpp"
+#include "fw/multipath-strategy.hpp"
 #include "fw/ncc-strategy.hpp"
 
 #include "tests/test-common.hpp"
@@ -111,6 +112,7 @@ using Tests = boost::mpl::vector<
   Test<BestRouteStrategy, false, false>,
   Test<BestRouteStrategy2, true, true>,
   Test<MulticastStrategy, true, true>,
+  Test<MultipathStrategy, true, true>,
   Test<NccStrategy, false, false>
 >;
 
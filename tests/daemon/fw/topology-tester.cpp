@@ -39,6 +39,7 @@ using face::GenericLinkService;
 
 TopologyLink::TopologyLink(time::nanoseconds delay)
   : m_isUp(true)
+  , m_transmissionTime(time::nanoseconds::zero())
 {
   this->setDelay(delay);
 }
@@ -62,6 +63,13 @@ TopologyLink::setDelay(time::nanoseconds delay)
   m_delay = delay;
 }
 
+void
+TopologyLink::setTransmissionTime(time::nanoseconds transmissionTime)
+{
+  BOOST_ASSERT(transmissionTime >= time::nanoseconds::zero());
+  m_transmissionTime = transmissionTime;
+}
+
 void
 TopologyLink::addFace(TopologyNode i, shared_ptr<Face> face)
 {
@@ -83,22 +91,31 @@ TopologyLink::transmit(TopologyNode i, const Block& packet)
     return;
   }
 
-  const auto& blockedDestinations = m_transports.at(i).blockedDestinations;
+  auto& sender = m_transports.at(i);
+
+  time::nanoseconds delay = m_delay;
+  if (m_transmissionTime > time::nanoseconds::zero()) {
+    // wait for previous packets to be transmitted, then transmit this packet
+    auto now = time::steady_clock::now();
+    sender.idleSince = std::max(sender.idleSince, now) + m_transmissionTime;
+    delay += sender.idleSince - now;
+  }
 
   for (const auto& p : m_transports) {
-    if (p.first == i || blockedDestinations.count(p.first) > 0) {
+    if (p.first == i || sender.blockedDestinations.count(p.first) > 0) {
       continue;
     }
 
     InternalTransportBase* recipient = p.second.transport;
-    this->scheduleReceive(recipient, packet);
+    this->scheduleReceive(recipient, packet, delay);
   }
 }
 
 void
-TopologyLink::scheduleReceive(InternalTransportBase* recipient, const Block& packet)
+TopologyLink::scheduleReceive(InternalTransportBase* recipient, const Block& packet,
+                              time::nanoseconds delay)
 {
-  scheduler::schedule(m_delay, [packet, recipient] {
+  scheduler::schedule(delay, [packet, recipient] {
     recipient->receiveFromLink(packet);
   });
 }
@@ -91,6 +91,15 @@ public:
   void
   setDelay(time::nanoseconds delay);
 
+  /** \brief limit the link capacity
+   *  \param transmissionTime time to put one packet onto the link, or zero for unlimited capacity
+   *
+   *  Each face on the link transmits one packet at a time. A packet sent while the face
+   *  is busy waits in an unbounded FIFO queue, so that its delivery is delayed accordingly.
+   */
+  void
+  setTransmissionTime(time::nanoseconds transmissionTime);
+
   /** \brief attach a face to the link
    *  \param i forwarder index
    *  \param face a Face with InternalForwarderTransport
@@ -111,17 +120,20 @@ private:
   transmit(TopologyNode i, const Block& packet);
 
   void
-  scheduleReceive(face::InternalTransportBase* recipient, const Block& packet);
+  scheduleReceive(face::InternalTransportBase* recipient, const Block& packet,
+                  time::nanoseconds delay);
 
 private:
   bool m_isUp;
   time::nanoseconds m_delay;
+  time::nanoseconds m_transmissionTime;
 
   struct NodeTransport
   {
     face::InternalTransportBase* transport;
     shared_ptr<Face> face;
     std::set<TopologyNode> blockedDestinations;
+    time::steady_clock::TimePoint idleSince; ///< when the face finishes its current transmission
   };
   std::unordered_map<TopologyNode, NodeTransport> m_transports;
 };
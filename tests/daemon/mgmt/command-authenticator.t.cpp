@@ -271,6 +271,60 @@ protected:
   Name id1;
 };
 
+BOOST_FIXTURE_TEST_CASE(SignerCache, IdentityAuthorizedFixture)
+{
+  const auto& counters = authenticator->getCounters();
+
+  BOOST_CHECK_EQUAL(authorize1(nullptr), true);
+  BOOST_CHECK_EQUAL(counters.nSignerCacheMisses, 1);
+  BOOST_CHECK_EQUAL(counters.nSignerCacheHits, 0);
+
+  name::Component timestampComp;
+  BOOST_CHECK_EQUAL(authorize1(
+    [&timestampComp] (const Interest& interest) {
+      timestampComp = interest.getName().at(ndn::command_interest::POS_TIMESTAMP);
+    }
+  ), true);
+  BOOST_CHECK_EQUAL(counters.nSignerCacheMisses, 1);
+  BOOST_CHECK_EQUAL(counters.nSignerCacheHits, 1);
+
+  // signature is still verified on cache hit
+  BOOST_CHECK_EQUAL(authorize1(
+    [] (Interest& interest) {
+      setNameComponent(interest, ndn::command_interest::POS_SIG_VALUE, "bad-signature-bits");
+    }
+  ), false);
+  BOOST_CHECK(lastRejectReply == ndn::mgmt::RejectReply::STATUS403);
+  BOOST_CHECK_EQUAL(counters.nSignerCacheHits, 2);
+
+  // timestamp check precedes the cache lookup
+  BOOST_CHECK_EQUAL(authorize1(
+    [&timestampComp] (Interest& interest) {
+      setNameComponent(interest, ndn::command_interest::POS_TIMESTAMP, timestampComp);
+    }
+  ), false);
+  BOOST_CHECK(lastRejectReply == ndn::mgmt::RejectReply::STATUS403);
+  BOOST_CHECK_EQUAL(counters.nSignerCacheHits, 2);
+
+  // reloading configuration discards cached signers
+  loadConfig(R"CONFIG(
+    authorizations
+    {
+      authorize
+      {
+        certfile "1.ndncert"
+        privileges
+        {
+          module1
+        }
+      }
+    }
+  )CONFIG");
+  BOOST_CHECK_EQUAL(authorize1(nullptr), true);
+  BOOST_CHECK_EQUAL(counters.nSignerCacheMisses, 2);
+  BOOST_CHECK_EQUAL(counters.nSignerCacheHits, 2);
+}
+
 BOOST_FIXTURE_TEST_SUITE(Rejects, IdentityAuthorizedFixture)
 
 BOOST_AUTO_TEST_CASE(BadKeyLocator_NameTooShort)
@@ -336,6 +336,40 @@ BOOST_AUTO_TEST_CASE(ChannelDataset)
   }
 }
 
+BOOST_AUTO_TEST_CASE(FaceChanges)
+{
+  auto face1 = addFace(REMOVE_LAST_NOTIFICATION);
+
+  receiveInterest(Interest("/localhost/nfd/faces/changes").setCanBePrefix(true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  uint64_t version = m_responses[0].getName().get(-2).toVersion();
+
+  auto face2 = addFace(REMOVE_LAST_NOTIFICATION);
+  face1->close();
+  advanceClocks(1_ms, 10);
+
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/faces/changes").append(to_string(version)))
+                  .setCanBePrefix(true));
+
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 2);
+
+  ndn::nfd::FaceEventNotification notification(content.elements()[0]);
+  BOOST_CHECK_EQUAL(notification.getKind(), ndn::nfd::FACE_EVENT_CREATED);
+  BOOST_CHECK_EQUAL(notification.getFaceId(), face2->getId());
+  notification.wireDecode(content.elements()[1]);
+  BOOST_CHECK_EQUAL(notification.getKind(), ndn::nfd::FACE_EVENT_DESTROYED);
+
+  // a version newer than the current version cannot be served
+  m_responses.clear();
+  Name futureName = Name("/localhost/nfd/faces/changes").append(to_string(version + 100));
+  receiveInterest(Interest(futureName).setCanBePrefix(true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(m_responses[0].getContentType(), tlv::ContentType_Nack);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Datasets
 
 BOOST_AUTO_TEST_SUITE(Notifications)
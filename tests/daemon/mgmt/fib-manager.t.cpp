@@ -443,6 +443,68 @@ BOOST_AUTO_TEST_CASE(FibDataset)
                                 expectedRecords.begin(), expectedRecords.end());
 }
 
+BOOST_AUTO_TEST_CASE(ListAfterChange)
+{
+  FaceId face1 = addFace();
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/A").first, *m_faceTable.get(face1), 0, 10);
+
+  receiveInterest(Interest("/localhost/nfd/fib/list").setCanBePrefix(true));
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_CHECK_EQUAL(content.elements().size(), 1);
+
+  // let the dispatcher's in-memory storage expire, so that the dataset is served by FibManager
+  advanceClocks(time::milliseconds(100), 20);
+  m_responses.clear();
+
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/B").first, *m_faceTable.get(face1), 0, 10);
+  receiveInterest(Interest("/localhost/nfd/fib/list").setCanBePrefix(true));
+  content = concatenateResponses();
+  content.parse();
+  BOOST_CHECK_EQUAL(content.elements().size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Changes)
+{
+  FaceId face1 = addFace();
+  FaceId face2 = addFace();
+
+  // a request without version learns the current version
+  receiveInterest(Interest("/localhost/nfd/fib/changes").setCanBePrefix(true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(m_responses[0].getContent().value_size(), 0);
+  uint64_t version = m_responses[0].getName().get(-2).toVersion();
+
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/A").first, *m_faceTable.get(face1), 0, 10);
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/B").first, *m_faceTable.get(face1), 0, 20);
+  m_fib.addOrUpdateNextHop(*m_fib.findExactMatch("/A"), *m_faceTable.get(face2), 0, 30);
+  m_fib.removeNextHop(*m_fib.findExactMatch("/B"), *m_faceTable.get(face1), 0);
+
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/fib/changes").append(to_string(version)))
+                  .setCanBePrefix(true));
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 2);
+
+  ndn::nfd::FibEntry record(content.elements()[0]);
+  BOOST_CHECK_EQUAL(record.getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(record.getNextHopRecords().size(), 2);
+  record.wireDecode(content.elements()[1]);
+  BOOST_CHECK_EQUAL(record.getPrefix(), "/B");
+  BOOST_CHECK_EQUAL(record.getNextHopRecords().size(), 0); // erased
+
+  // a version newer than the current version cannot be served
+  m_responses.clear();
+  Name futureName = Name("/localhost/nfd/fib/changes").append(to_string(version + 100));
+  receiveInterest(Interest(futureName).setCanBePrefix(true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  ControlResponse expectedResponse(410, "Changes since version " + to_string(version + 100) +
+                                        " are not available");
+  BOOST_CHECK_EQUAL(checkResponse(0, futureName, expectedResponse, tlv::ContentType_Nack),
+                    CheckResponseResult::OK);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // List
 
 BOOST_AUTO_TEST_SUITE_END() // TestFibManager
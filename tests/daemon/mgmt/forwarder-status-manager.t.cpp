@@ -77,6 +77,9 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
   BOOST_CHECK_EQUAL(m_forwarder.getCounters().nSatisfiedInterests, 1);
   BOOST_CHECK_EQUAL(m_forwarder.getCounters().nUnsatisfiedInterests, 1);
 
+  m_forwarder.getPit().setLimit(1000);
+  m_forwarder.getPit().setPerFaceLimit(100);
+
   // request
   time::system_clock::TimePoint beforeRequest = time::system_clock::now();
   Interest request("/localhost/nfd/status/general");
@@ -105,6 +108,18 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
 
   BOOST_CHECK_EQUAL(status.getNSatisfiedInterests(), m_forwarder.getCounters().nSatisfiedInterests);
   BOOST_CHECK_EQUAL(status.getNUnsatisfiedInterests(), m_forwarder.getCounters().nUnsatisfiedInterests);
+
+  // PIT quota elements follow the standard fields
+  response.parse();
+  auto pitLimit = response.find(ForwarderStatusManager::TLV_PIT_MAX_ENTRIES);
+  BOOST_REQUIRE(pitLimit != response.elements_end());
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(*pitLimit), 1000);
+  auto pitPerFaceLimit = response.find(ForwarderStatusManager::TLV_PIT_MAX_ENTRIES_PER_FACE);
+  BOOST_REQUIRE(pitPerFaceLimit != response.elements_end());
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(*pitPerFaceLimit), 100);
+  auto nPitQuotaExceeded = response.find(ForwarderStatusManager::TLV_N_PIT_QUOTA_EXCEEDED);
+  BOOST_REQUIRE(nPitQuotaExceeded != response.elements_end());
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(*nPitQuotaExceeded), 0);
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestForwarderStatusManager
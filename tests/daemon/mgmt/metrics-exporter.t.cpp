@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mgmt/metrics-exporter.hpp"
+#include "face/generic-link-service.hpp"
+#include "fw/forwarder.hpp"
+
+#include "tests/test-common.hpp"
+#include "../face/dummy-face.hpp"
+#include "../face/dummy-transport.hpp"
+
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+
+#include <array>
+
+namespace nfd {
+namespace tests {
+
+using face::tests::DummyFace;
+using face::tests::DummyTransport;
+
+class MetricsExporterFixture : public BaseFixture
+{
+protected:
+  MetricsExporterFixture()
+    : exporter(forwarder)
+    , face1(make_shared<DummyFace>())
+    , face2(make_shared<Face>(make_unique<face::GenericLinkService>(),
+                              make_unique<DummyTransport>("udp4://192.0.2.1:6363",
+                                                          "udp4://192.0.2.2:6363")))
+  {
+    forwarder.addFace(face1);
+    forwarder.addFace(face2);
+  }
+
+  void
+  runConfig(const std::string& config, bool isDryRun)
+  {
+    ConfigFile cf;
+    exporter.setConfigFile(cf);
+    cf.parse(config, isDryRun, "dummy-config");
+    if (!isDryRun) {
+      exporter.ensureConfigured();
+    }
+  }
+
+  std::string
+  getMetrics() const
+  {
+    std::ostringstream os;
+    exporter.writeMetrics(os);
+    return os.str();
+  }
+
+protected:
+  Forwarder forwarder;
+  MetricsExporter exporter;
+  shared_ptr<DummyFace> face1;
+  shared_ptr<Face> face2;
+};
+
+BOOST_AUTO_TEST_SUITE(Mgmt)
+BOOST_FIXTURE_TEST_SUITE(TestMetricsExporter, MetricsExporterFixture)
+
+static bool
+contains(const std::string& text, const std::string& line)
+{
+  return text.find(line) != std::string::npos;
+}
+
+BOOST_AUTO_TEST_CASE(WriteMetrics)
+{
+  face1->receiveInterest(*makeInterest("/A", 1));
+
+  std::string metrics = this->getMetrics();
+  BOOST_CHECK(contains(metrics, "# TYPE nfd_interests_total counter\n"
+                                "nfd_interests_total{direction=\"in\"} 1\n"
+                                "nfd_interests_total{direction=\"out\"} 0\n"));
+  BOOST_CHECK(contains(metrics, "\nnfd_pit_entries 1\n"));
+  BOOST_CHECK(contains(metrics, "\nnfd_pit_limit 0\n"));
+  BOOST_CHECK(contains(metrics, "\nnfd_pit_quota_exceeded_total 0\n"));
+  BOOST_CHECK(contains(metrics, "\nnfd_faces 2\n"));
+
+  const std::string id1 = to_string(face1->getId());
+  const std::string id2 = to_string(face2->getId());
+  BOOST_CHECK(contains(metrics, "nfd_face_info{face=\"" + id2 + "\",local=\"udp4://192.0.2.1:6363\","
+                                "remote=\"udp4://192.0.2.2:6363\",scope=\"non-local\","
+                                "persistency=\"persistent\",link_type=\"point-to-point\"} 1\n"));
+  BOOST_CHECK(contains(metrics, "nfd_face_interests_total{face=\"" + id1 + "\",direction=\"in\"} 1\n"));
+  BOOST_CHECK(contains(metrics, "nfd_face_interests_total{face=\"" + id2 + "\",direction=\"in\"} 0\n"));
+
+  // LP counters are available only on faces with GenericLinkService
+  BOOST_CHECK(contains(metrics, "nfd_face_lp_retransmitted_total{face=\"" + id2 + "\"} 0\n"));
+  BOOST_CHECK(!contains(metrics, "nfd_face_lp_retransmitted_total{face=\"" + id1 + "\"}"));
+}
+
+BOOST_AUTO_TEST_CASE(BadConfig)
+{
+  BOOST_CHECK_THROW(runConfig("metrics\n{\n  foo bar\n}\n", true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig("metrics\n{\n  tcp_port 70000\n}\n", true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig("metrics\n{\n  tcp_port 9696\n  tcp_address not-an-address\n}\n", true),
+                    ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig("metrics\n{\n  unix_path \"\"\n}\n", true), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(ServeUnix)
+{
+  namespace fs = boost::filesystem;
+  const std::string socketPath = "nfd-test-metrics-exporter.sock";
+
+  runConfig("metrics\n{\n  unix_path " + socketPath + "\n}\n", true);
+  BOOST_CHECK_EQUAL(fs::symlink_status(socketPath).type(), fs::file_not_found);
+
+  runConfig("metrics\n{\n  unix_path " + socketPath + "\n}\n", false);
+  BOOST_CHECK_EQUAL(fs::symlink_status(socketPath).type(), fs::socket_file);
+
+  // listeners run on the exporter's own io_service, which the scheduler would otherwise poll
+  boost::asio::local::stream_protocol::socket client(exporter.m_io);
+  client.connect(boost::asio::local::stream_protocol::endpoint(socketPath));
+  boost::asio::write(client, boost::asio::buffer(std::string("GET /metrics HTTP/1.0\r\n\r\n")));
+
+  std::string response;
+  std::array<char, 4096> buffer;
+  bool isDone = false;
+  std::function<void(const boost::system::error_code&, size_t)> onRead =
+    [&] (const boost::system::error_code& error, size_t nBytes) {
+      response.append(buffer.data(), nBytes);
+      if (error) {
+        isDone = true;
+        return;
+      }
+      client.async_read_some(boost::asio::buffer(buffer), onRead);
+    };
+  client.async_read_some(boost::asio::buffer(buffer), onRead);
+  while (!isDone && exporter.m_io.run_one() > 0) {
+  }
+
+  BOOST_CHECK(isDone);
+  BOOST_CHECK_EQUAL(response.substr(0, 17), "HTTP/1.0 200 OK\r\n");
+  BOOST_CHECK(contains(response, "\r\n\r\n# HELP nfd_interests_total "));
+
+  // omitting the section closes the listener
+  runConfig("", false);
+  BOOST_CHECK_EQUAL(fs::symlink_status(socketPath).type(), fs::file_not_found);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestMetricsExporter
+BOOST_AUTO_TEST_SUITE_END() // Mgmt
+
+} // namespace tests
+} // namespace nfd
@@ -240,6 +240,32 @@ BOOST_AUTO_TEST_CASE(StrategyChoiceDataset)
   }
 }
 
+BOOST_AUTO_TEST_CASE(StrategyChoiceChanges)
+{
+  receiveInterest(Interest("/localhost/nfd/strategy-choice/changes").setCanBePrefix(true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  uint64_t version = m_responses[0].getName().get(-2).toVersion();
+
+  BOOST_CHECK(sc.insert("/A", strategyNameP));
+  BOOST_CHECK(sc.insert("/B", strategyNameP));
+  sc.erase("/A");
+
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/strategy-choice/changes").append(to_string(version)))
+                  .setCanBePrefix(true));
+
+  Block dataset = concatenateResponses();
+  dataset.parse();
+  BOOST_REQUIRE_EQUAL(dataset.elements_size(), 2);
+
+  ndn::nfd::StrategyChoice record(dataset.elements()[0]);
+  BOOST_CHECK_EQUAL(record.getName(), "/A");
+  BOOST_CHECK_EQUAL(record.getStrategy(), Name()); // unset
+  record.wireDecode(dataset.elements()[1]);
+  BOOST_CHECK_EQUAL(record.getName(), "/B");
+  BOOST_CHECK_EQUAL(record.getStrategy(), strategyNameP);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestStrategyChoiceManager
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
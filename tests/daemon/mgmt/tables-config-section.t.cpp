@@ -273,6 +273,72 @@ BOOST_AUTO_TEST_CASE(Unknown)
 
 BOOST_AUTO_TEST_SUITE_END() // CsUnsolicitedPolicy
 
+BOOST_AUTO_TEST_SUITE(PitMaxEntries)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  Pit& pit = forwarder.getPit();
+  pit.setLimit(5);
+  pit.setPerFaceLimit(5);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(pit.getLimit(), 0);
+  BOOST_CHECK_EQUAL(pit.getPerFaceLimit(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      pit_max_entries 1000
+      pit_max_entries_per_face 100
+    }
+  )CONFIG";
+
+  Pit& pit = forwarder.getPit();
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(pit.getLimit(), 0);
+  BOOST_CHECK_EQUAL(pit.getPerFaceLimit(), 0);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(pit.getLimit(), 1000);
+  BOOST_CHECK_EQUAL(pit.getPerFaceLimit(), 100);
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(pit.getLimit(), 1000);
+  BOOST_CHECK_EQUAL(pit.getPerFaceLimit(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG1 = R"CONFIG(
+    tables
+    {
+      pit_max_entries invalid
+    }
+  )CONFIG";
+
+  const std::string CONFIG2 = R"CONFIG(
+    tables
+    {
+      pit_max_entries_per_face invalid
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG1, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG2, true), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PitMaxEntries
+
 BOOST_AUTO_TEST_SUITE(StrategyChoice)
 
 BOOST_AUTO_TEST_CASE(Unversioned)
@@ -195,6 +195,76 @@ BOOST_AUTO_TEST_CASE(Erase)
   BOOST_CHECK(pit.find(*interest) != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(Limit)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+  BOOST_CHECK_EQUAL(pit.getLimit(), 0);
+  pit.setLimit(2);
+
+  shared_ptr<Interest> interestA = makeInterest("/A");
+  shared_ptr<Interest> interestB = makeInterest("/B");
+  shared_ptr<Interest> interestC = makeInterest("/C");
+  size_t nNameTreeEntriesBefore = nameTree.size();
+
+  auto entryA = pit.insert(*interestA).first;
+  BOOST_REQUIRE(entryA != nullptr);
+  BOOST_CHECK(pit.insert(*interestB, 300).first != nullptr);
+  nNameTreeEntriesBefore += 2;
+
+  auto insertResult = pit.insert(*interestC, 301);
+  BOOST_CHECK(insertResult.first == nullptr);
+  BOOST_CHECK_EQUAL(insertResult.second, false);
+  BOOST_CHECK_EQUAL(pit.size(), 2);
+  BOOST_CHECK_EQUAL(nameTree.size(), nNameTreeEntriesBefore); // no leftover NameTree entry
+
+  // existing entry is still found when the PIT is full
+  insertResult = pit.insert(*interestA, 301);
+  BOOST_CHECK(insertResult.first == entryA);
+  BOOST_CHECK_EQUAL(insertResult.second, false);
+
+  pit.erase(entryA.get());
+  BOOST_CHECK(pit.insert(*interestC, 301).first != nullptr);
+
+  pit.setLimit(0);
+  BOOST_CHECK(pit.insert(*interestA).first != nullptr);
+  BOOST_CHECK_EQUAL(pit.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(PerFaceLimit)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+  BOOST_CHECK_EQUAL(pit.getPerFaceLimit(), 0);
+  pit.setPerFaceLimit(2);
+
+  shared_ptr<Interest> interestA = makeInterest("/A");
+  shared_ptr<Interest> interestB = makeInterest("/B");
+  shared_ptr<Interest> interestC = makeInterest("/C");
+
+  auto entryA = pit.insert(*interestA, 300).first;
+  BOOST_REQUIRE(entryA != nullptr);
+  BOOST_CHECK(pit.insert(*interestB, 300).first != nullptr);
+  BOOST_CHECK_EQUAL(pit.getFaceUsage(300), 2);
+
+  // face 300 is over quota
+  BOOST_CHECK(pit.insert(*interestC, 300).first == nullptr);
+  // existing entry is not charged again
+  BOOST_CHECK(pit.insert(*interestA, 300).first == entryA);
+  BOOST_CHECK_EQUAL(pit.getFaceUsage(300), 2);
+
+  // other faces and uncharged insertions are not affected
+  BOOST_CHECK(pit.insert(*interestC, 301).first != nullptr);
+  BOOST_CHECK_EQUAL(pit.getFaceUsage(301), 1);
+  BOOST_CHECK(pit.insert(*makeInterest("/D")).first != nullptr);
+  BOOST_CHECK_EQUAL(pit.size(), 4);
+
+  pit.erase(entryA.get());
+  BOOST_CHECK_EQUAL(pit.getFaceUsage(300), 1);
+  BOOST_CHECK(pit.insert(*makeInterest("/E"), 300).first != nullptr);
+  BOOST_CHECK_EQUAL(pit.getFaceUsage(300), 2);
+}
+
 BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
 {
   NameTree nameTree;
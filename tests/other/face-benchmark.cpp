@@ -26,10 +26,33 @@
 #include "core/extended-error-message.hpp"
 #include "core/global-io.hpp"
 #include "face/face.hpp"
+#include "face/generic-link-service.hpp"
 #include "face/tcp-channel.hpp"
 #include "face/udp-channel.hpp"
+#include "face/unicast-udp-transport.hpp"
+#include "face/null-face.hpp"
+#include "face/tcp-transport.hpp"
+#include "fw/forwarder.hpp"
+#include "tests/other/fw/forwarding-shards.hpp"
 
+#ifdef HAVE_UNIX_SOCKETS
+#include "face/unix-stream-transport.hpp"
+#endif // HAVE_UNIX_SOCKETS
+
+#ifdef HAVE_WEBSOCKET
+#include "face/websocket-channel.hpp"
+#include "face/websocket-transport.hpp"
+#endif // HAVE_WEBSOCKET
+
+#include <ndn-cxx/lp/packet.hpp>
+#include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 
 #ifdef HAVE_VALGRIND
@@ -169,6 +192,702 @@ private:
   std::vector<std::pair<FaceUri, FaceUri>> m_faceUris;
 };
 
+/** \brief measures how PIT, CS, and FIB processing scales with the number of forwarding shards
+ *
+ *  Interests and Data are generated in memory, dispatched from the main thread by name prefix
+ *  hash, and processed in run-to-completion mode by one worker thread per shard.
+ */
+class ShardScalingBenchmark
+{
+public:
+  explicit
+  ShardScalingBenchmark(size_t nPackets)
+    : m_fib(m_nameTree)
+    , m_face(face::makeNullFace())
+  {
+    for (size_t i = 0; i < N_PREFIXES; ++i) {
+      m_fib.insert(Name("/p" + to_string(i))).first->addOrUpdateNextHop(*m_face, 0, 0);
+    }
+
+    for (size_t i = 0; i < nPackets; ++i) {
+      Name name("/p" + to_string(i % N_PREFIXES));
+      name.appendNumber(i);
+      name.wireEncode();
+
+      auto interest = make_shared<Interest>(name);
+      interest->setNonce(static_cast<uint32_t>(i));
+      m_interests.push_back(interest);
+      m_data.push_back(make_shared<Data>(name));
+    }
+  }
+
+  void
+  run(std::ostream& os)
+  {
+    os << "shards,packets,seconds,pps,speedup" << std::endl;
+    double baseline = 0.0;
+    for (size_t nShards = 1; nShards <= MAX_SHARDS; nShards *= 2) {
+      double pps = this->runOnce(nShards);
+      if (nShards == 1) {
+        baseline = pps;
+      }
+      os << nShards << ',' << 2 * m_interests.size() << ','
+         << std::fixed << std::setprecision(3) << 2 * m_interests.size() / pps << ','
+         << std::setprecision(0) << pps << ','
+         << std::setprecision(2) << pps / baseline << std::endl;
+    }
+  }
+
+private:
+  double
+  runOnce(size_t nShards)
+  {
+    fw::ShardedForwarding sharded(m_fib, nShards);
+    sharded.start();
+
+    auto t1 = time::steady_clock::now();
+    for (size_t i = 0; i < m_interests.size() + WINDOW; ++i) {
+      if (i < m_interests.size()) {
+        sharded.dispatchInterest(m_interests[i]);
+      }
+      if (i >= WINDOW) {
+        sharded.dispatchData(m_data[i - WINDOW]);
+      }
+    }
+    sharded.stop();
+    auto t2 = time::steady_clock::now();
+
+    double seconds = time::duration_cast<time::microseconds>(t2 - t1).count() / 1e6;
+    return 2 * m_interests.size() / seconds;
+  }
+
+private:
+  static const size_t N_PREFIXES = 1000;
+  static const size_t WINDOW = 1000;
+  static const size_t MAX_SHARDS = 16;
+
+  NameTree m_nameTree;
+  Fib m_fib;
+  shared_ptr<Face> m_face;
+  std::vector<shared_ptr<Interest>> m_interests;
+  std::vector<shared_ptr<Data>> m_data;
+};
+
+/** \brief measures the packet rate of unicast UDP faces over the loopback interface
+ *
+ *  Two UDP faces on 127.0.0.1 are connected to each other. Interests are sent on one face in
+ *  bursts, one burst per event loop iteration, and counted when they arrive on the other face.
+ *  The measurement is repeated with several I/O batch sizes (see face::DatagramBatch).
+ */
+class UdpLoopbackBenchmark
+{
+public:
+  explicit
+  UdpLoopbackBenchmark(size_t nPackets)
+    : m_nPackets(nPackets)
+  {
+    for (size_t i = 0; i < N_INTERESTS; ++i) {
+      Name name("/udp-loopback");
+      name.appendNumber(i);
+      auto interest = make_shared<Interest>(name);
+      interest->setNonce(static_cast<uint32_t>(i));
+      interest->wireEncode();
+      m_interests.push_back(interest);
+    }
+  }
+
+  void
+  run(std::ostream& os)
+  {
+    os << "batch,sent,received,seconds,pps,speedup" << std::endl;
+    double baseline = 0.0;
+    for (size_t ioBatchSize : {1, 8, 32, 64}) {
+      size_t nReceived = 0;
+      double seconds = 0.0;
+      std::tie(nReceived, seconds) = this->runOnce(ioBatchSize);
+      double pps = seconds > 0.0 ? nReceived / seconds : 0.0;
+      if (ioBatchSize == 1) {
+        baseline = pps;
+      }
+      os << ioBatchSize << ',' << m_nPackets << ',' << nReceived << ','
+         << std::fixed << std::setprecision(3) << seconds << ','
+         << std::setprecision(0) << pps << ','
+         << std::setprecision(2) << (baseline > 0.0 ? pps / baseline : 0.0) << std::endl;
+    }
+  }
+
+private:
+  static shared_ptr<Face>
+  makeFace(boost::asio::ip::udp::socket&& socket, size_t ioBatchSize)
+  {
+    return make_shared<Face>(make_unique<face::GenericLinkService>(),
+                             make_unique<face::UnicastUdpTransport>(std::move(socket),
+                                                                    ndn::nfd::FACE_PERSISTENCY_PERMANENT,
+                                                                    time::minutes(10), nullopt,
+                                                                    ioBatchSize));
+  }
+
+  /** \return number of Interests received, and seconds until the last one was received
+   */
+  std::tuple<size_t, double>
+  runOnce(size_t ioBatchSize)
+  {
+    namespace ip = boost::asio::ip;
+    boost::asio::io_service& io = getGlobalIoService();
+    io.reset();
+
+    ip::udp::socket socketA(io, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+    ip::udp::socket socketB(io, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+    socketA.connect(socketB.local_endpoint());
+    socketB.connect(socketA.local_endpoint());
+    auto faceA = makeFace(std::move(socketA), ioBatchSize);
+    auto faceB = makeFace(std::move(socketB), ioBatchSize);
+
+    size_t nReceived = 0;
+    auto t1 = time::steady_clock::now();
+    auto t2 = t1;
+    faceB->afterReceiveInterest.connect([&] (const Interest&) {
+      ++nReceived;
+      t2 = time::steady_clock::now();
+    });
+
+    // the sender stops DRAIN_TIME after its last burst, letting in-flight packets arrive
+    boost::asio::steady_timer drainTimer(io);
+    size_t nSent = 0;
+    std::function<void()> sendBurst = [&] {
+      for (size_t i = 0; i < BURST_SIZE && nSent < m_nPackets; ++i, ++nSent) {
+        faceA->sendInterest(*m_interests[nSent % m_interests.size()]);
+      }
+      if (nSent < m_nPackets) {
+        io.post(sendBurst);
+      }
+      else {
+        drainTimer.expires_from_now(DRAIN_TIME);
+        drainTimer.async_wait([&] (const boost::system::error_code&) { io.stop(); });
+      }
+    };
+
+    io.post(sendBurst);
+    io.run();
+
+    faceA->close();
+    faceB->close();
+    io.reset();
+    io.run();
+
+    double seconds = time::duration_cast<time::microseconds>(t2 - t1).count() / 1e6;
+    return std::make_tuple(nReceived, seconds);
+  }
+
+private:
+  static const size_t N_INTERESTS = 1000;
+  static const size_t BURST_SIZE = 64;
+  static constexpr std::chrono::milliseconds DRAIN_TIME{500};
+
+  size_t m_nPackets;
+  std::vector<shared_ptr<Interest>> m_interests;
+};
+
+constexpr std::chrono::milliseconds UdpLoopbackBenchmark::DRAIN_TIME;
+
+/** \brief measures throughput and round-trip latency of Interest/Data exchanges over loopback faces
+ *
+ *  A consumer sends Interests with distinct names at a target rate, and a producer answers each
+ *  of them with a Data packet carrying a payload of the configured size. The consumer and the
+ *  producer are connected by a pair of faces over a Unix stream socket pair, a TCP connection or
+ *  a pair of UDP sockets on 127.0.0.1, or a WebSocket connection on 127.0.0.1. Optionally, a
+ *  Forwarder is placed in the loop, in which case the consumer and the producer are each connected
+ *  to the Forwarder by their own pair of faces, and a route toward the producer is installed.
+ */
+class LatencyBenchmark
+{
+public:
+  struct Options
+  {
+    std::string transport = "all"; ///< unix, tcp, udp, ws, or all
+    bool wantForwarder = false;
+    double rate = 10000.0; ///< Interests per second
+    size_t nPackets = 100000;
+    size_t payloadSize = 1024;
+  };
+
+  explicit
+  LatencyBenchmark(const Options& options)
+    : m_options(options)
+    , m_prefix("/latency-benchmark")
+    , m_payload(std::make_shared<ndn::Buffer>(options.payloadSize))
+  {
+  }
+
+  void
+  run(std::ostream& os)
+  {
+    std::vector<std::string> transports;
+    if (m_options.transport == "all") {
+#ifdef HAVE_UNIX_SOCKETS
+      transports.push_back("unix");
+#endif
+      transports.push_back("tcp");
+      transports.push_back("udp");
+#ifdef HAVE_WEBSOCKET
+      // WebSocket runs last: its server stays alive until the end of the benchmark
+      transports.push_back("ws");
+#endif
+    }
+    else {
+      transports.push_back(m_options.transport);
+    }
+
+    os << "transport,forwarder,rate,payload,sent,received,seconds,pps,goodput_mbps,"
+       << "p50_us,p99_us,p999_us" << std::endl;
+    for (const auto& transport : transports) {
+      this->runOnce(transport);
+
+      double seconds = time::duration_cast<time::microseconds>(m_lastReceived - m_firstSent).count() / 1e6;
+      double pps = seconds > 0.0 ? m_latencies.size() / seconds : 0.0;
+      double goodput = pps * m_options.payloadSize * 8 / 1e6;
+      std::sort(m_latencies.begin(), m_latencies.end());
+
+      os << transport << ',' << (m_options.wantForwarder ? "yes" : "no") << ','
+         << std::fixed << std::setprecision(0) << m_options.rate << ','
+         << m_options.payloadSize << ',' << m_nSent << ',' << m_latencies.size() << ','
+         << std::setprecision(3) << seconds << ','
+         << std::setprecision(0) << pps << ','
+         << std::setprecision(2) << goodput << ','
+         << std::setprecision(1) << getPercentile(0.5) << ','
+         << getPercentile(0.99) << ',' << getPercentile(0.999) << std::endl;
+    }
+  }
+
+private:
+  /** \brief the consumer or the producer end of a loopback link
+   */
+  class AppEndpoint : noncopyable
+  {
+  public:
+    virtual
+    ~AppEndpoint() = default;
+
+    virtual void
+    sendInterest(const Interest& interest) = 0;
+
+    virtual void
+    sendData(const Data& data) = 0;
+
+    virtual void
+    close() = 0;
+
+  public:
+    std::function<void(const Interest&)> onInterest;
+    std::function<void(const Data&)> onData;
+  };
+
+  /** \brief an AppEndpoint that sends and receives packets through a face
+   */
+  class FaceAppEndpoint final : public AppEndpoint
+  {
+  public:
+    explicit
+    FaceAppEndpoint(shared_ptr<Face> face)
+      : m_face(std::move(face))
+    {
+      m_face->afterReceiveInterest.connect([this] (const Interest& interest) { onInterest(interest); });
+      m_face->afterReceiveData.connect([this] (const Data& data) { onData(data); });
+    }
+
+    void
+    sendInterest(const Interest& interest) final
+    {
+      m_face->sendInterest(interest);
+    }
+
+    void
+    sendData(const Data& data) final
+    {
+      m_face->sendData(data);
+    }
+
+    void
+    close() final
+    {
+      m_face->close();
+    }
+
+  private:
+    shared_ptr<Face> m_face;
+  };
+
+#ifdef HAVE_WEBSOCKET
+  /** \brief an AppEndpoint that is a WebSocket client, like a browser application
+   */
+  class WebSocketAppEndpoint final : public AppEndpoint
+  {
+  public:
+    explicit
+    WebSocketAppEndpoint(const FaceUri& serverUri)
+    {
+      m_client.clear_access_channels(websocketpp::log::alevel::all);
+      m_client.clear_error_channels(websocketpp::log::elevel::all);
+      m_client.init_asio(&getGlobalIoService());
+      m_client.set_open_handler([this] (websocketpp::connection_hdl hdl) { m_hdl = hdl; });
+      m_client.set_message_handler([this] (websocketpp::connection_hdl, websocket::Client::message_ptr msg) {
+        this->receiveMessage(msg->get_payload());
+      });
+
+      websocketpp::lib::error_code ec;
+      auto con = m_client.get_connection(serverUri.toString(), ec);
+      if (ec) {
+        BOOST_THROW_EXCEPTION(std::runtime_error("Cannot connect to " + serverUri.toString() + ": " +
+                                                 ec.message()));
+      }
+      m_client.connect(con);
+    }
+
+    bool
+    isOpen() const
+    {
+      return !m_hdl.expired();
+    }
+
+    void
+    sendInterest(const Interest& interest) final
+    {
+      this->send(interest.wireEncode());
+    }
+
+    void
+    sendData(const Data& data) final
+    {
+      this->send(data.wireEncode());
+    }
+
+    void
+    close() final
+    {
+      websocketpp::lib::error_code ec;
+      m_client.close(m_hdl, websocketpp::close::status::going_away, "", ec);
+    }
+
+  private:
+    void
+    send(const Block& block)
+    {
+      websocketpp::lib::error_code ec;
+      m_client.send(m_hdl, block.wire(), block.size(), websocketpp::frame::opcode::binary, ec);
+    }
+
+    void
+    receiveMessage(const std::string& msg)
+    {
+      bool isOk = false;
+      Block element;
+      std::tie(isOk, element) = Block::fromBuffer(reinterpret_cast<const uint8_t*>(msg.data()), msg.size());
+      if (!isOk) {
+        return;
+      }
+
+      if (element.type() == lp::tlv::LpPacket) {
+        // the link service adds an LpPacket header only when it carries fields,
+        // which this client has no use for; fragments are never sent on WebSocket faces
+        lp::Packet pkt(element);
+        if (!pkt.has<lp::FragmentField>()) {
+          return;
+        }
+        ndn::Buffer::const_iterator fragBegin, fragEnd;
+        std::tie(fragBegin, fragEnd) = pkt.get<lp::FragmentField>();
+        element = Block(&*fragBegin, std::distance(fragBegin, fragEnd));
+      }
+
+      switch (element.type()) {
+        case tlv::Interest:
+          onInterest(Interest(element));
+          break;
+        case tlv::Data:
+          onData(Data(element));
+          break;
+      }
+    }
+
+  private:
+    websocket::Client m_client;
+    websocketpp::connection_hdl m_hdl;
+  };
+#endif // HAVE_WEBSOCKET
+
+  /** \brief a face and the AppEndpoint it is connected to
+   */
+  struct Link
+  {
+    shared_ptr<Face> face;
+    unique_ptr<AppEndpoint> app;
+  };
+
+  static shared_ptr<Face>
+  makeFace(unique_ptr<face::Transport> transport)
+  {
+    face::GenericLinkService::Options options;
+    options.allowFragmentation = true;
+    options.allowReassembly = true;
+    return make_shared<Face>(make_unique<face::GenericLinkService>(options), std::move(transport));
+  }
+
+  Link
+  makeLink(const std::string& transport)
+  {
+    namespace ip = boost::asio::ip;
+    boost::asio::io_service& io = getGlobalIoService();
+    Link link;
+
+    if (transport == "tcp") {
+      ip::tcp::acceptor acceptor(io, ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+      ip::tcp::socket socketA(io);
+      ip::tcp::socket socketB(io);
+      socketA.connect(acceptor.local_endpoint());
+      acceptor.accept(socketB);
+      link.face = makeFace(make_unique<face::TcpTransport>(std::move(socketA),
+                                                           ndn::nfd::FACE_PERSISTENCY_PERMANENT,
+                                                           ndn::nfd::FACE_SCOPE_NON_LOCAL));
+      link.app = make_unique<FaceAppEndpoint>(
+                   makeFace(make_unique<face::TcpTransport>(std::move(socketB),
+                                                            ndn::nfd::FACE_PERSISTENCY_PERMANENT,
+                                                            ndn::nfd::FACE_SCOPE_NON_LOCAL)));
+    }
+    else if (transport == "udp") {
+      ip::udp::socket socketA(io, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+      ip::udp::socket socketB(io, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+      socketA.connect(socketB.local_endpoint());
+      socketB.connect(socketA.local_endpoint());
+      link.face = makeFace(make_unique<face::UnicastUdpTransport>(std::move(socketA),
+                                                                  ndn::nfd::FACE_PERSISTENCY_PERMANENT,
+                                                                  time::minutes(10)));
+      link.app = make_unique<FaceAppEndpoint>(
+                   makeFace(make_unique<face::UnicastUdpTransport>(std::move(socketB),
+                                                                   ndn::nfd::FACE_PERSISTENCY_PERMANENT,
+                                                                   time::minutes(10))));
+    }
+#ifdef HAVE_UNIX_SOCKETS
+    else if (transport == "unix") {
+      boost::asio::local::stream_protocol::socket socketA(io);
+      boost::asio::local::stream_protocol::socket socketB(io);
+      boost::asio::local::connect_pair(socketA, socketB);
+      link.face = makeFace(make_unique<face::UnixStreamTransport>(std::move(socketA)));
+      link.app = make_unique<FaceAppEndpoint>(
+                   makeFace(make_unique<face::UnixStreamTransport>(std::move(socketB))));
+    }
+#endif // HAVE_UNIX_SOCKETS
+#ifdef HAVE_WEBSOCKET
+    else if (transport == "ws") {
+      this->startWebSocketServer();
+      boost::system::error_code ec;
+      auto client = make_unique<WebSocketAppEndpoint>(FaceUri(m_wsServer->get_local_endpoint(ec), "ws"));
+      this->runUntil([&] { return client->isOpen() && !m_wsAccepted.empty(); });
+      if (!client->isOpen() || m_wsAccepted.empty()) {
+        BOOST_THROW_EXCEPTION(std::runtime_error("WebSocket connection timed out"));
+      }
+
+      auto hdl = m_wsAccepted.front();
+      m_wsAccepted.pop_front();
+      auto wsTransport = make_unique<face::WebSocketTransport>(hdl, *m_wsServer, time::minutes(10));
+      m_wsTransports[hdl] = wsTransport.get();
+      link.face = makeFace(std::move(wsTransport));
+      link.app = std::move(client);
+    }
+#endif // HAVE_WEBSOCKET
+    else {
+      BOOST_THROW_EXCEPTION(std::runtime_error("Unsupported transport '" + transport + "'"));
+    }
+
+    return link;
+  }
+
+#ifdef HAVE_WEBSOCKET
+  void
+  startWebSocketServer()
+  {
+    if (m_wsServer != nullptr) {
+      return;
+    }
+
+    m_wsServer = make_unique<websocket::Server>();
+    m_wsServer->clear_access_channels(websocketpp::log::alevel::all);
+    m_wsServer->clear_error_channels(websocketpp::log::elevel::all);
+    m_wsServer->init_asio(&getGlobalIoService());
+    m_wsServer->set_open_handler([this] (websocketpp::connection_hdl hdl) { m_wsAccepted.push_back(hdl); });
+    m_wsServer->set_close_handler([this] (websocketpp::connection_hdl hdl) { m_wsTransports.erase(hdl); });
+    m_wsServer->set_message_handler([this] (websocketpp::connection_hdl hdl,
+                                            websocket::Server::message_ptr msg) {
+      auto it = m_wsTransports.find(hdl);
+      if (it != m_wsTransports.end()) {
+        it->second->receiveMessage(msg->get_payload());
+      }
+    });
+    m_wsServer->set_reuse_addr(true);
+    m_wsServer->listen(websocket::Endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    m_wsServer->start_accept();
+  }
+#endif // HAVE_WEBSOCKET
+
+  /** \brief runs the event loop until \p predicate is true, or a second has passed
+   */
+  void
+  runUntil(const std::function<bool()>& predicate)
+  {
+    boost::asio::io_service& io = getGlobalIoService();
+    auto deadline = time::steady_clock::now() + 1_s;
+    while (!predicate() && time::steady_clock::now() < deadline) {
+      io.reset();
+      io.poll();
+    }
+  }
+
+  /** \brief runs the event loop for \p duration, even if there is pending work after that
+   */
+  static void
+  runFor(std::chrono::milliseconds duration)
+  {
+    boost::asio::io_service& io = getGlobalIoService();
+    boost::asio::steady_timer timer(io);
+    timer.expires_from_now(duration);
+    timer.async_wait([&io] (const boost::system::error_code&) { io.stop(); });
+    io.reset();
+    io.run();
+  }
+
+  void
+  runOnce(const std::string& transport)
+  {
+    boost::asio::io_service& io = getGlobalIoService();
+    io.reset();
+
+    m_nSent = 0;
+    m_sendTimes.assign(m_options.nPackets, time::steady_clock::TimePoint());
+    m_latencies.clear();
+    m_latencies.reserve(m_options.nPackets);
+
+    unique_ptr<Forwarder> forwarder;
+    Link consumerLink = this->makeLink(transport);
+    Link producerLink;
+    unique_ptr<AppEndpoint> directProducer;
+    AppEndpoint* producer = nullptr;
+    if (m_options.wantForwarder) {
+      producerLink = this->makeLink(transport);
+      forwarder = make_unique<Forwarder>();
+      forwarder->addFace(consumerLink.face);
+      forwarder->addFace(producerLink.face);
+      forwarder->getFib().insert(m_prefix).first->addOrUpdateNextHop(*producerLink.face, 0, 0);
+      producer = producerLink.app.get();
+    }
+    else {
+      directProducer = make_unique<FaceAppEndpoint>(consumerLink.face);
+      producer = directProducer.get();
+    }
+    AppEndpoint* consumer = consumerLink.app.get();
+
+    producer->onInterest = [this, producer] (const Interest& interest) {
+      Data data(interest.getName());
+      data.setContent(m_payload);
+      ndn::SignatureSha256WithRsa fakeSignature;
+      fakeSignature.setValue(ndn::encoding::makeEmptyBlock(tlv::SignatureValue));
+      data.setSignature(fakeSignature);
+      producer->sendData(data);
+    };
+    producer->onData = [] (const Data&) {};
+    consumer->onInterest = [] (const Interest&) {};
+    consumer->onData = [this, &io] (const Data& data) {
+      auto now = time::steady_clock::now();
+      uint64_t seq = data.getName().at(-1).toNumber();
+      if (seq >= m_nSent || m_sendTimes[seq] == time::steady_clock::TimePoint()) {
+        return;
+      }
+      m_latencies.push_back(now - m_sendTimes[seq]);
+      m_sendTimes[seq] = time::steady_clock::TimePoint();
+      m_lastReceived = now;
+      if (m_latencies.size() == m_options.nPackets) {
+        io.stop();
+      }
+    };
+
+    // Interests are sent in bursts every PACING_INTERVAL, keeping the average rate at the target
+    boost::asio::steady_timer pacingTimer(io);
+    std::function<void(const boost::system::error_code&)> sendBurst = [&] (const boost::system::error_code& error) {
+      if (error) {
+        return;
+      }
+      auto now = time::steady_clock::now();
+      double elapsed = time::duration_cast<time::duration<double>>(now - m_firstSent).count();
+      size_t nDue = std::min(m_options.nPackets, static_cast<size_t>(elapsed * m_options.rate) + 1);
+      for (; m_nSent < nDue; ++m_nSent) {
+        Interest interest(Name(m_prefix).appendNumber(m_nSent));
+        interest.setCanBePrefix(false);
+        interest.setInterestLifetime(time::milliseconds(DRAIN_TIME.count()));
+        m_sendTimes[m_nSent] = time::steady_clock::now();
+        consumer->sendInterest(interest);
+      }
+      // the consumer gives up DRAIN_TIME after its last Interest
+      if (m_nSent < m_options.nPackets) {
+        pacingTimer.expires_from_now(PACING_INTERVAL);
+        pacingTimer.async_wait(sendBurst);
+      }
+      else {
+        pacingTimer.expires_from_now(DRAIN_TIME);
+        pacingTimer.async_wait([&io] (const boost::system::error_code&) { io.stop(); });
+      }
+    };
+
+    m_firstSent = m_lastReceived = time::steady_clock::now();
+    io.post([&] { sendBurst(boost::system::error_code()); });
+    io.run();
+    pacingTimer.cancel();
+
+    consumerLink.app->close();
+    consumerLink.face->close();
+    if (producerLink.app != nullptr) {
+      producerLink.app->close();
+      producerLink.face->close();
+    }
+    runFor(CLOSE_TIME);
+  }
+
+  /** \return the \p p-th quantile of the sorted latencies, in microseconds
+   */
+  double
+  getPercentile(double p) const
+  {
+    if (m_latencies.empty()) {
+      return 0.0;
+    }
+    size_t index = std::min(m_latencies.size() - 1,
+                            static_cast<size_t>(std::ceil(p * m_latencies.size())) - 1);
+    return time::duration_cast<time::nanoseconds>(m_latencies[index]).count() / 1e3;
+  }
+
+private:
+  static constexpr std::chrono::milliseconds PACING_INTERVAL{1};
+  static constexpr std::chrono::milliseconds DRAIN_TIME{1000};
+  static constexpr std::chrono::milliseconds CLOSE_TIME{200};
+
+  const Options m_options;
+  const Name m_prefix;
+  const ndn::ConstBufferPtr m_payload;
+
+  size_t m_nSent = 0;
+  std::vector<time::steady_clock::TimePoint> m_sendTimes; ///< by sequence number, reset on arrival
+  std::vector<time::steady_clock::Duration> m_latencies;
+  time::steady_clock::TimePoint m_firstSent;
+  time::steady_clock::TimePoint m_lastReceived;
+
+#ifdef HAVE_WEBSOCKET
+  unique_ptr<websocket::Server> m_wsServer;
+  std::deque<websocketpp::connection_hdl> m_wsAccepted;
+  std::map<websocketpp::connection_hdl, face::WebSocketTransport*,
+           std::owner_less<websocketpp::connection_hdl>> m_wsTransports;
+#endif // HAVE_WEBSOCKET
+};
+
+constexpr std::chrono::milliseconds LatencyBenchmark::PACING_INTERVAL;
+constexpr std::chrono::milliseconds LatencyBenchmark::DRAIN_TIME;
+constexpr std::chrono::milliseconds LatencyBenchmark::CLOSE_TIME;
+
 } // namespace tests
 } // namespace nfd
 
@@ -179,8 +898,56 @@ main(int argc, char** argv)
   std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
 #endif
 
+  if (argc >= 2 && std::strcmp(argv[1], "--shard-scaling") == 0) {
+    size_t nPackets = argc >= 3 ? boost::lexical_cast<size_t>(argv[2]) : 1000000;
+    nfd::tests::ShardScalingBenchmark bench{nPackets};
+    bench.run(std::cout);
+    return 0;
+  }
+
+  if (argc >= 2 && std::strcmp(argv[1], "--udp-loopback") == 0) {
+    size_t nPackets = argc >= 3 ? boost::lexical_cast<size_t>(argv[2]) : 1000000;
+    nfd::tests::UdpLoopbackBenchmark bench{nPackets};
+    bench.run(std::cout);
+    return 0;
+  }
+
+  if (argc >= 2 && std::strcmp(argv[1], "--latency") == 0) {
+    nfd::tests::LatencyBenchmark::Options options;
+    int i = 2;
+    if (i < argc) {
+      options.transport = argv[i++];
+    }
+    if (i < argc && std::strcmp(argv[i], "--forwarder") == 0) {
+      options.wantForwarder = true;
+      ++i;
+    }
+    try {
+      if (i < argc) {
+        options.rate = boost::lexical_cast<double>(argv[i++]);
+      }
+      if (i < argc) {
+        options.nPackets = boost::lexical_cast<size_t>(argv[i++]);
+      }
+      if (i < argc) {
+        options.payloadSize = boost::lexical_cast<size_t>(argv[i++]);
+      }
+      nfd::tests::LatencyBenchmark bench{options};
+      bench.run(std::cout);
+    }
+    catch (const std::exception& e) {
+      std::cerr << "FATAL: " << nfd::getExtendedErrorMessage(e) << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+
   if (argc != 2) {
-    std::cerr << "Usage: " << argv[0] << " <config-file>" << std::endl;
+    std::cerr << "Usage: " << argv[0] << " <config-file>\n"
+              << "       " << argv[0] << " --shard-scaling [n-packets]\n"
+              << "       " << argv[0] << " --udp-loopback [n-packets]\n"
+              << "       " << argv[0] << " --latency [unix|tcp|udp|ws|all] [--forwarder]"
+              << " [rate] [n-packets] [payload-size]" << std::endl;
     return 2;
   }
 
@@ -0,0 +1,225 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "forwarding-shards.hpp"
+#include "daemon/table/cs-policy-lru.hpp"
+#include "daemon/table/name-tree-hashtable.hpp"
+
+namespace nfd {
+namespace fw {
+
+constexpr size_t ForwardingShard::BATCH_SIZE;
+
+size_t
+computeShardIndex(const Name& name, size_t prefixLen, size_t nShards)
+{
+  BOOST_ASSERT(nShards > 0);
+  return name_tree::computeHash(name, prefixLen) % nShards;
+}
+
+ForwardingShard::ForwardingShard(const Fib& fib, size_t csCapacity, size_t queueCapacity)
+  : m_fib(fib)
+  , m_pit(m_nameTree)
+  , m_cs(csCapacity)
+  , m_queue(queueCapacity)
+{
+  m_cs.setPolicy(make_unique<cs::LruPolicy>());
+}
+
+size_t
+ForwardingShard::processBatch(size_t maxPackets)
+{
+  this->expirePitEntries(std::chrono::steady_clock::now());
+
+  Packet batch[BATCH_SIZE];
+  size_t nProcessed = 0;
+  while (nProcessed < maxPackets) {
+    size_t n = m_queue.pop(batch, std::min(BATCH_SIZE, maxPackets - nProcessed));
+    if (n == 0) {
+      break;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      if (batch[i].interest != nullptr) {
+        this->processInterest(*batch[i].interest);
+      }
+      else {
+        BOOST_ASSERT(batch[i].data != nullptr);
+        this->processData(*batch[i].data);
+      }
+      batch[i] = {};
+    }
+    nProcessed += n;
+  }
+  return nProcessed;
+}
+
+void
+ForwardingShard::processInterest(const Interest& interest)
+{
+  ++m_counters.nInInterests;
+
+  // PIT insert
+  auto pitInsertResult = m_pit.insert(interest);
+  shared_ptr<pit::Entry> pitEntry = pitInsertResult.first;
+  if (!pitInsertResult.second) {
+    // aggregated into an existing PIT entry
+    return;
+  }
+
+  // CS lookup
+  bool isCsHit = false;
+  m_cs.find(interest,
+            [&isCsHit] (const Interest&, const Data&) { isCsHit = true; },
+            [] (const Interest&) {});
+  if (isCsHit) {
+    ++m_counters.nCsHits;
+    m_pit.erase(pitEntry.get());
+    return;
+  }
+  ++m_counters.nCsMisses;
+
+  // FIB lookup
+  const fib::Entry& fibEntry = m_fib.findLongestPrefixMatch(interest.getName());
+  if (fibEntry.getNextHops().empty()) {
+    ++m_counters.nNoRoute;
+    m_pit.erase(pitEntry.get());
+    return;
+  }
+
+  // pending until satisfied or expired
+  auto lifetime = std::chrono::milliseconds(interest.getInterestLifetime().count());
+  m_expiryQueue.emplace(std::chrono::steady_clock::now() + lifetime, pitEntry);
+}
+
+void
+ForwardingShard::processData(const Data& data)
+{
+  ++m_counters.nInData;
+
+  // PIT match
+  pit::DataMatchResult pitMatches = m_pit.findAllDataMatches(data);
+  if (pitMatches.size() == 0) {
+    ++m_counters.nUnsolicitedData;
+    return;
+  }
+
+  // CS insert
+  m_cs.insert(data);
+
+  // satisfy and delete PIT entries
+  for (const shared_ptr<pit::Entry>& pitEntry : pitMatches) {
+    ++m_counters.nSatisfiedInterests;
+    m_pit.erase(pitEntry.get());
+  }
+}
+
+void
+ForwardingShard::expirePitEntries(std::chrono::steady_clock::time_point now)
+{
+  auto it = m_expiryQueue.begin();
+  for (; it != m_expiryQueue.end() && it->first <= now; ++it) {
+    shared_ptr<pit::Entry> pitEntry = it->second.lock();
+    if (pitEntry != nullptr) {
+      // neither satisfied nor erased since it was queued
+      ++m_counters.nExpiredInterests;
+      m_pit.erase(pitEntry.get());
+    }
+  }
+  m_expiryQueue.erase(m_expiryQueue.begin(), it);
+}
+
+ShardedForwarding::ShardedForwarding(const Fib& fib, size_t nShards, size_t prefixLen,
+                                     size_t csCapacity, size_t queueCapacity)
+  : m_prefixLen(prefixLen)
+  , m_isRunning(false)
+{
+  BOOST_ASSERT(nShards > 0);
+  for (size_t i = 0; i < nShards; ++i) {
+    m_shards.push_back(make_unique<ForwardingShard>(fib, csCapacity, queueCapacity));
+  }
+}
+
+ShardedForwarding::~ShardedForwarding()
+{
+  this->stop();
+}
+
+void
+ShardedForwarding::start()
+{
+  if (m_isRunning.exchange(true)) {
+    return;
+  }
+
+  for (const auto& shard : m_shards) {
+    m_workers.emplace_back(&ShardedForwarding::runWorker, this, std::ref(*shard));
+  }
+}
+
+void
+ShardedForwarding::stop()
+{
+  m_isRunning.store(false, std::memory_order_release);
+  for (std::thread& worker : m_workers) {
+    worker.join();
+  }
+  m_workers.clear();
+}
+
+void
+ShardedForwarding::dispatchInterest(shared_ptr<const Interest> interest)
+{
+  const Name& name = interest->getName();
+  this->dispatch(name, {std::move(interest), nullptr});
+}
+
+void
+ShardedForwarding::dispatchData(shared_ptr<const Data> data)
+{
+  const Name& name = data->getName();
+  this->dispatch(name, {nullptr, std::move(data)});
+}
+
+void
+ShardedForwarding::dispatch(const Name& name, ForwardingShard::Packet&& packet)
+{
+  ForwardingShard& shard = *m_shards[computeShardIndex(name, m_prefixLen, m_shards.size())];
+  while (!shard.enqueue(std::move(packet))) {
+    std::this_thread::yield();
+  }
+}
+
+void
+ShardedForwarding::runWorker(ForwardingShard& shard)
+{
+  while (m_isRunning.load(std::memory_order_acquire) || shard.hasPendingPackets()) {
+    if (shard.processBatch(ForwardingShard::BATCH_SIZE) == 0) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+} // namespace fw
+} // namespace nfd
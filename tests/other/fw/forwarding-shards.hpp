@@ -0,0 +1,225 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_TESTS_OTHER_FW_FORWARDING_SHARDS_HPP
+#define NFD_TESTS_OTHER_FW_FORWARDING_SHARDS_HPP
+
+#include "core/counter.hpp"
+#include "core/spsc-ring.hpp"
+#include "daemon/table/cs.hpp"
+#include "daemon/table/fib.hpp"
+#include "daemon/table/pit.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+
+namespace nfd {
+namespace fw {
+
+/** \brief determines the shard of a packet by hashing the first \p prefixLen components
+ *         of its name
+ *
+ *  Interest and Data of the same name always land in the same shard, as long as their names
+ *  share the first \p prefixLen components.
+ */
+size_t
+computeShardIndex(const Name& name, size_t prefixLen, size_t nShards);
+
+/** \brief a partition of PIT and CS processed in run-to-completion mode by one thread
+ *
+ *  A shard owns its NameTree, PIT, and CS. The FIB is shared by all shards without locking;
+ *  it must be fully populated before the shards are started and must not be modified until
+ *  they are stopped. Packets are handed to the shard through a lock-free single-producer
+ *  single-consumer ring.
+ *
+ *  \note This is benchmark-only code used by face-benchmark, not a forwarding mode of NFD.
+ *         There are no in-records, loop detection, or strategies. The CS uses the LRU policy,
+ *         which never touches the scheduler, and PIT entries are erased by the shard itself
+ *         once the lifetime of the Interest that created them has passed, measured with
+ *         std::chrono::steady_clock, so that no worker thread reaches the global scheduler.
+ */
+class ForwardingShard : noncopyable
+{
+public:
+  /** \brief a packet queued to a shard; exactly one field is set
+   */
+  struct Packet
+  {
+    shared_ptr<const Interest> interest;
+    shared_ptr<const Data> data;
+  };
+
+  class Counters
+  {
+  public:
+    PacketCounter nInInterests;
+    PacketCounter nInData;
+    PacketCounter nCsHits;
+    PacketCounter nCsMisses;
+    PacketCounter nNoRoute;
+    PacketCounter nSatisfiedInterests;
+    PacketCounter nUnsolicitedData;
+    PacketCounter nExpiredInterests;
+  };
+
+  ForwardingShard(const Fib& fib, size_t csCapacity, size_t queueCapacity);
+
+  /** \brief queues a packet (producer side)
+   *  \return false if the shard queue is full
+   */
+  bool
+  enqueue(Packet&& packet)
+  {
+    return m_queue.push(std::move(packet));
+  }
+
+  /** \brief processes up to \p maxPackets queued packets (consumer side)
+   *  \return number of processed packets
+   */
+  size_t
+  processBatch(size_t maxPackets);
+
+  bool
+  hasPendingPackets() const
+  {
+    return !m_queue.empty();
+  }
+
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
+  }
+
+  const Pit&
+  getPit() const
+  {
+    return m_pit;
+  }
+
+  const Cs&
+  getCs() const
+  {
+    return m_cs;
+  }
+
+private:
+  void
+  processInterest(const Interest& interest);
+
+  void
+  processData(const Data& data);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief erases PIT entries whose Interest lifetime has passed at \p now
+   */
+  void
+  expirePitEntries(std::chrono::steady_clock::time_point now);
+
+public:
+  /** \brief maximum number of packets taken from the queue at once
+   */
+  static constexpr size_t BATCH_SIZE = 64;
+
+private:
+  const Fib& m_fib;
+  NameTree m_nameTree;
+  Pit m_pit;
+  Cs m_cs;
+  SpscRing<Packet> m_queue;
+  Counters m_counters;
+
+  using ExpiryQueue = std::multimap<std::chrono::steady_clock::time_point, weak_ptr<pit::Entry>>;
+  ExpiryQueue m_expiryQueue;
+};
+
+/** \brief dispatches packets to forwarding shards, each running on its own worker thread
+ *
+ *  One dispatcher thread (e.g. the thread that receives from faces) calls dispatchInterest
+ *  and dispatchData; each shard is drained by its own worker thread between start() and stop().
+ *
+ *  \note This only covers PIT, CS, and FIB processing for benchmarking purposes; see
+ *        ForwardingShard for what is left out.
+ */
+class ShardedForwarding : noncopyable
+{
+public:
+  ShardedForwarding(const Fib& fib, size_t nShards, size_t prefixLen = 1,
+                    size_t csCapacity = 65536, size_t queueCapacity = 4096);
+
+  ~ShardedForwarding();
+
+  size_t
+  getNShards() const
+  {
+    return m_shards.size();
+  }
+
+  const ForwardingShard&
+  getShard(size_t i) const
+  {
+    return *m_shards.at(i);
+  }
+
+  /** \brief starts one worker thread per shard
+   */
+  void
+  start();
+
+  /** \brief waits until all queued packets are processed, and stops worker threads
+   */
+  void
+  stop();
+
+  /** \brief queues an Interest to its shard, spinning while the shard queue is full
+   */
+  void
+  dispatchInterest(shared_ptr<const Interest> interest);
+
+  /** \brief queues a Data to its shard, spinning while the shard queue is full
+   */
+  void
+  dispatchData(shared_ptr<const Data> data);
+
+private:
+  void
+  dispatch(const Name& name, ForwardingShard::Packet&& packet);
+
+  void
+  runWorker(ForwardingShard& shard);
+
+private:
+  const size_t m_prefixLen;
+  std::vector<unique_ptr<ForwardingShard>> m_shards;
+  std::vector<std::thread> m_workers;
+  std::atomic<bool> m_isRunning;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_TESTS_OTHER_FW_FORWARDING_SHARDS_HPP
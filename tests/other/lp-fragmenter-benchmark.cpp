@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "face/lp-fragmenter.hpp"
+
+#include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
+
+#include <iostream>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+using face::LpFragmenter;
+
+class LpFragmenterBenchmarkFixture
+{
+protected:
+  LpFragmenterBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    // a Data packet whose wire encoding is approximately 64 KB
+    auto data = make_shared<Data>("/lp-fragmenter/benchmark/data");
+    std::vector<uint8_t> content(DATA_CONTENT_SIZE, 0xBB);
+    data->setContent(content.data(), content.size());
+    ndn::SignatureSha256WithRsa fakeSignature;
+    fakeSignature.setValue(ndn::encoding::makeEmptyBlock(tlv::SignatureValue));
+    data->setSignature(fakeSignature);
+
+    packet = lp::Packet(data->wireEncode());
+  }
+
+  static time::microseconds
+  timedRun(const std::function<void()>& f)
+  {
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = time::steady_clock::now();
+    f();
+    auto t2 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  void
+  run(size_t mtu, bool withSequence)
+  {
+    size_t nFrags = 0;
+    size_t nOctets = 0;
+    lp::Sequence sequence = 0;
+
+    time::microseconds d = timedRun([&] {
+      for (size_t i = 0; i < N_REPEAT; ++i) {
+        bool isOk = false;
+        std::vector<lp::Packet> frags;
+        if (withSequence) {
+          std::tie(isOk, frags) = fragmenter.fragmentPacket(packet, mtu, sequence);
+          sequence += frags.size();
+        }
+        else {
+          std::tie(isOk, frags) = fragmenter.fragmentPacket(packet, mtu);
+        }
+        BOOST_ASSERT(isOk);
+
+        nFrags += frags.size();
+        for (const lp::Packet& frag : frags) {
+          nOctets += frag.wireEncode().size();
+        }
+      }
+    });
+
+    std::cout << "mtu=" << mtu << (withSequence ? " with Sequence" : "")
+              << " packets=" << N_REPEAT << " fragments=" << nFrags
+              << " octets=" << nOctets << ": " << d
+              << " (" << (d.count() * 1000 / N_REPEAT) << " ns/packet)" << std::endl;
+  }
+
+protected:
+  static constexpr size_t DATA_CONTENT_SIZE = 65000;
+  static constexpr size_t N_REPEAT = 20000;
+
+  LpFragmenter fragmenter{{}};
+  lp::Packet packet;
+};
+
+BOOST_FIXTURE_TEST_SUITE(LpFragmenterBenchmark, LpFragmenterBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(Mtu1400)
+{
+  run(1400, false);
+  run(1400, true);
+}
+
+BOOST_AUTO_TEST_CASE(Mtu8800)
+{
+  run(8800, false);
+  run(8800, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -77,7 +77,7 @@ protected:
     }
   }
 
-private:
+protected:
   static void
   extendName(Name& name, size_t length)
   {
@@ -153,5 +153,52 @@ BOOST_FIXTURE_TEST_CASE(SimpleExchanges, PitFibBenchmarkFixture)
   std::cout << time::duration_cast<time::microseconds>(t2 - t1) << std::endl;
 }
 
+// This test case models Data matching many PIT entries, as happens with CanBePrefix Interests.
+// For each of nNames names of length nameLength, one CanBePrefix Interest is pending on every
+// prefix of the name, so that each Data matches nameLength PIT entries.
+BOOST_FIXTURE_TEST_CASE(CanBePrefixMatches, PitFibBenchmarkFixture)
+{
+  // number of distinct Data names
+  const size_t nNames = 2000;
+  // number of components in each Data name, also the number of matched PIT entries per Data
+  const size_t nameLength = 8;
+  // number of times each Data is matched against the PIT
+  const size_t nRepeats = 100;
+
+  for (size_t i = 0; i < nNames; ++i) {
+    Name name(to_string(i));
+    extendName(name, nameLength);
+    for (size_t len = 1; len <= nameLength; ++len) {
+      auto interest = make_shared<Interest>(name.getPrefix(len));
+      interest->setCanBePrefix(true);
+      interests.push_back(interest);
+      pitEntries.push_back(m_pit.insert(*interest).first);
+    }
+    data.push_back(make_shared<Data>(name));
+  }
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+  size_t nMatches = 0;
+  auto t1 = time::steady_clock::now();
+
+  for (size_t r = 0; r < nRepeats; ++r) {
+    for (const auto& d : data) {
+      nMatches += m_pit.findAllDataMatches(*d).size();
+    }
+  }
+
+  auto t2 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+  BOOST_CHECK_EQUAL(nMatches, nNames * nameLength * nRepeats);
+  std::cout << time::duration_cast<time::microseconds>(t2 - t1) << std::endl;
+}
+
 } // namespace tests
 } // namespace nfd
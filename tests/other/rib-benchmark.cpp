@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "rib/fib-updater.hpp"
+#include "rib/rib.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <iostream>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace rib {
+namespace tests {
+
+class RibBenchmarkFixture
+{
+protected:
+  RibBenchmarkFixture()
+    : m_keyChain("pib-memory:", "tpm-memory:")
+    , m_face(m_io, m_keyChain)
+    , m_controller(m_face, m_keyChain)
+    , m_fibUpdater(m_rib, m_controller)
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    // FIB updates are counted rather than sent, so that only the RIB is measured
+    m_fibUpdater.setLocalFibApplier([this] (const FibUpdate&) {
+      ++m_nFibUpdates;
+      return 200;
+    });
+  }
+
+  static time::microseconds
+  timedRun(const std::function<void()>& f)
+  {
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = time::steady_clock::now();
+    f();
+    auto t2 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  void
+  applyUpdate(RibUpdate::Action action, const Name& name, uint64_t faceId,
+              std::underlying_type<ndn::nfd::RouteFlags>::type flags = ndn::nfd::ROUTE_FLAGS_NONE)
+  {
+    Route route;
+    route.faceId = faceId;
+    route.origin = ndn::nfd::ROUTE_ORIGIN_APP;
+    route.flags = flags;
+
+    RibUpdate update;
+    update.setAction(action)
+          .setName(name)
+          .setRoute(route);
+
+    m_rib.beginApplyUpdate(update, nullptr, nullptr);
+  }
+
+  /** \brief registers routes on face 1 until the RIB has \p nRoutes routes,
+   *         spread under \p nBranches subtrees of /rib/benchmark
+   */
+  void
+  populate(size_t nRoutes, size_t nBranches)
+  {
+    for (size_t i = m_rib.size(); i < nRoutes; ++i) {
+      applyUpdate(RibUpdate::REGISTER, makeName(i, nBranches), 1);
+    }
+    BOOST_REQUIRE_EQUAL(m_rib.size(), nRoutes);
+  }
+
+  static Name
+  makeName(size_t i, size_t nBranches)
+  {
+    return Name("/rib/benchmark").appendNumber(i % nBranches).appendNumber(i);
+  }
+
+protected:
+  boost::asio::io_service m_io;
+  ndn::KeyChain m_keyChain;
+  ndn::util::DummyClientFace m_face;
+  ndn::nfd::Controller m_controller;
+  Rib m_rib;
+  FibUpdater m_fibUpdater;
+  size_t m_nFibUpdates = 0;
+};
+
+// Registering and unregistering one prefix in a large RIB should not depend on the RIB size.
+BOOST_FIXTURE_TEST_CASE(RegisterUnregister, RibBenchmarkFixture)
+{
+  const size_t nBranches = 100;
+  const size_t nProbes = 10000;
+
+  for (size_t nRoutes : {1000, 10000, 100000}) {
+    populate(nRoutes, nBranches);
+
+    time::microseconds d = timedRun([&] {
+      for (size_t i = 0; i < nProbes; ++i) {
+        Name name = makeName(i, nBranches).append("probe");
+        applyUpdate(RibUpdate::REGISTER, name, 2);
+        applyUpdate(RibUpdate::UNREGISTER, name, 2);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(m_rib.size(), nRoutes);
+    std::cout << "register-unregister " << nProbes << " in RIB of " << nRoutes << ": "
+              << d << std::endl;
+  }
+}
+
+// A new parent of many existing names must take them over as children.
+BOOST_FIXTURE_TEST_CASE(RegisterParent, RibBenchmarkFixture)
+{
+  const size_t nRoutes = 100000;
+  const size_t nBranches = 100;
+  const size_t nRepeats = 100;
+
+  populate(nRoutes, nBranches);
+
+  time::microseconds d = timedRun([&] {
+    for (size_t i = 0; i < nRepeats; ++i) {
+      Name name = Name("/rib/benchmark").appendNumber(i % nBranches);
+      applyUpdate(RibUpdate::REGISTER, name, 2);
+      applyUpdate(RibUpdate::UNREGISTER, name, 2);
+    }
+  });
+
+  std::cout << "register-unregister parent of " << (nRoutes / nBranches) << " names, "
+            << nRepeats << " times in RIB of " << nRoutes << ": " << d << std::endl;
+}
+
+// A CHILD_INHERIT route is propagated to its own subtree only.
+BOOST_FIXTURE_TEST_CASE(ChildInherit, RibBenchmarkFixture)
+{
+  const size_t nRoutes = 100000;
+  const size_t nBranches = 100;
+  const size_t nRepeats = 100;
+
+  populate(nRoutes, nBranches);
+
+  m_nFibUpdates = 0;
+  time::microseconds d = timedRun([&] {
+    for (size_t i = 0; i < nRepeats; ++i) {
+      Name name = Name("/rib/benchmark").appendNumber(i % nBranches);
+      applyUpdate(RibUpdate::REGISTER, name, 2, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+      applyUpdate(RibUpdate::UNREGISTER, name, 2);
+    }
+  });
+
+  // Each registration and unregistration updates the new name and each name under it
+  BOOST_CHECK_EQUAL(m_nFibUpdates, nRepeats * 2 * (nRoutes / nBranches + 1));
+  std::cout << "register-unregister CHILD_INHERIT over " << (nRoutes / nBranches) << " names, "
+            << nRepeats << " times in RIB of " << nRoutes << ": " << d << std::endl;
+}
+
+} // namespace tests
+} // namespace rib
+} // namespace nfd
@@ -0,0 +1,218 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "rib/rib.hpp"
+
+#include "tests/test-common.hpp"
+#include "fib-updates-common.hpp"
+
+namespace nfd {
+namespace rib {
+namespace tests {
+
+class BatchFixture : public FibUpdatesFixture
+{
+public:
+  BatchFixture()
+  {
+    rib.mockFibResponse = [this] (const RibUpdateBatch& batch) {
+      batchSizes.push_back(batch.size());
+      return true;
+    };
+    rib.wantMockFibResponseOnce = false;
+  }
+
+  /** \brief queues an update as if another update were in progress
+   */
+  void
+  queueUpdate(RibUpdate::Action action, const Name& name, const Route& route)
+  {
+    rib.m_isUpdateInProgress = true;
+    beginApplyUpdate(action, name, route);
+  }
+
+  /** \brief applies an update, along with all previously queued updates
+   */
+  void
+  applyUpdate(RibUpdate::Action action, const Name& name, const Route& route)
+  {
+    rib.m_isUpdateInProgress = false;
+    beginApplyUpdate(action, name, route);
+  }
+
+private:
+  void
+  beginApplyUpdate(RibUpdate::Action action, const Name& name, const Route& route)
+  {
+    RibUpdate update;
+    update.setAction(action)
+          .setName(name)
+          .setRoute(route);
+
+    rib.beginApplyUpdate(update,
+                         [this] { ++nSuccesses; },
+                         [this] (uint32_t, const std::string&) { ++nFailures; });
+  }
+
+public:
+  std::vector<size_t> batchSizes;
+  int nSuccesses = 0;
+  int nFailures = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestFibUpdates, BatchFixture)
+
+BOOST_AUTO_TEST_SUITE(Batch)
+
+BOOST_AUTO_TEST_CASE(MergeIndependentNames)
+{
+  queueUpdate(RibUpdate::REGISTER, "/a", createRoute(1, 0, 10));
+  queueUpdate(RibUpdate::REGISTER, "/b", createRoute(1, 0, 10));
+  applyUpdate(RibUpdate::REGISTER, "/c", createRoute(1, 0, 10));
+
+  BOOST_CHECK_EQUAL(batchSizes.size(), 1);
+  BOOST_CHECK_EQUAL(batchSizes.at(0), 3);
+  BOOST_CHECK_EQUAL(nSuccesses, 3);
+  BOOST_CHECK_EQUAL(rib.size(), 3);
+  BOOST_CHECK(rib.m_updateBatches.empty());
+}
+
+BOOST_AUTO_TEST_CASE(SplitRelatedNames)
+{
+  queueUpdate(RibUpdate::REGISTER, "/a", createRoute(1, 0, 10, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT));
+  queueUpdate(RibUpdate::REGISTER, "/a/b", createRoute(1, 0, 10));
+  queueUpdate(RibUpdate::REGISTER, "/c", createRoute(1, 0, 10));
+  queueUpdate(RibUpdate::REGISTER, "/c", createRoute(1, 255, 10));
+  applyUpdate(RibUpdate::REGISTER, "/d", createRoute(2, 0, 10));
+
+  // {/a}, {/a/b, /c origin 0}, {/c origin 255}, {/d on face 2}
+  std::vector<size_t> expectedSizes{1, 2, 1, 1};
+  BOOST_CHECK_EQUAL_COLLECTIONS(batchSizes.begin(), batchSizes.end(),
+                                expectedSizes.begin(), expectedSizes.end());
+  BOOST_CHECK_EQUAL(nSuccesses, 5);
+  BOOST_CHECK_EQUAL(rib.size(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(LastUpdateWins)
+{
+  queueUpdate(RibUpdate::REGISTER, "/a", createRoute(1, 0, 10));
+  applyUpdate(RibUpdate::REGISTER, "/a", createRoute(1, 0, 20));
+
+  BOOST_CHECK_EQUAL(batchSizes.size(), 1);
+  BOOST_CHECK_EQUAL(batchSizes.at(0), 1);
+  BOOST_CHECK_EQUAL(nSuccesses, 2);
+
+  Route* route = rib.find("/a", createRoute(1, 0));
+  BOOST_REQUIRE(route != nullptr);
+  BOOST_CHECK_EQUAL(route->cost, 20);
+}
+
+BOOST_AUTO_TEST_CASE(CancelRegisterUnregister)
+{
+  queueUpdate(RibUpdate::REGISTER, "/a", createRoute(1, 0, 10));
+  applyUpdate(RibUpdate::UNREGISTER, "/a", createRoute(1, 0));
+
+  // Neither the RIB nor the FIB is touched, but both updates succeed
+  BOOST_CHECK_EQUAL(batchSizes.size(), 0);
+  BOOST_CHECK_EQUAL(nSuccesses, 2);
+  BOOST_CHECK_EQUAL(rib.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ExistingRouteNotCancelled)
+{
+  applyUpdate(RibUpdate::REGISTER, "/a", createRoute(1, 0, 10));
+  queueUpdate(RibUpdate::REGISTER, "/a", createRoute(1, 0, 20));
+  applyUpdate(RibUpdate::UNREGISTER, "/a", createRoute(1, 0));
+
+  std::vector<size_t> expectedSizes{1, 1};
+  BOOST_CHECK_EQUAL_COLLECTIONS(batchSizes.begin(), batchSizes.end(),
+                                expectedSizes.begin(), expectedSizes.end());
+  BOOST_CHECK_EQUAL(nSuccesses, 3);
+  BOOST_CHECK_EQUAL(rib.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE(LocalFibApplier)
+
+class LocalFibApplierFixture : public BatchFixture
+{
+public:
+  LocalFibApplierFixture()
+  {
+    rib.mockFibResponse = nullptr;
+    fibUpdater.setLocalFibApplier([this] (const FibUpdate& update) {
+      appliedUpdates.push_back(update);
+      return update.faceId == nonExistentFaceId ? 410 : 200;
+    });
+  }
+
+public:
+  FibUpdater::FibUpdateList appliedUpdates;
+  uint64_t nonExistentFaceId = 0;
+};
+
+BOOST_FIXTURE_TEST_CASE(Success, LocalFibApplierFixture)
+{
+  queueUpdate(RibUpdate::REGISTER, "/a", createRoute(1, 0, 10, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT));
+  queueUpdate(RibUpdate::REGISTER, "/b", createRoute(1, 0, 20, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT));
+  applyUpdate(RibUpdate::REGISTER, "/a/b", createRoute(2, 0, 30));
+
+  appliedUpdates.sort(&compareNameFaceIdCostAction);
+  FibUpdater::FibUpdateList expected{
+    FibUpdate::createAddUpdate("/a", 1, 10),
+    FibUpdate::createAddUpdate("/a/b", 1, 10),
+    FibUpdate::createAddUpdate("/a/b", 2, 30),
+    FibUpdate::createAddUpdate("/b", 1, 20),
+  };
+  BOOST_CHECK_EQUAL_COLLECTIONS(appliedUpdates.begin(), appliedUpdates.end(),
+                                expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(nSuccesses, 3);
+  BOOST_CHECK_EQUAL(rib.size(), 3);
+
+  // No command Interests are sent
+  g_io.poll();
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(FaceNotFound, LocalFibApplierFixture)
+{
+  nonExistentFaceId = 1;
+  queueUpdate(RibUpdate::REGISTER, "/a", createRoute(1, 0, 10));
+  applyUpdate(RibUpdate::REGISTER, "/b", createRoute(1, 0, 10));
+
+  BOOST_CHECK_EQUAL(nSuccesses, 0);
+  BOOST_CHECK_EQUAL(nFailures, 2);
+  BOOST_CHECK_EQUAL(rib.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LocalFibApplier
+
+BOOST_AUTO_TEST_SUITE_END() // Batch
+
+BOOST_AUTO_TEST_SUITE_END() // TestFibUpdates
+
+} // namespace tests
+} // namespace rib
+} // namespace nfd
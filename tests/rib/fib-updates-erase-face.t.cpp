@@ -377,6 +377,42 @@ BOOST_AUTO_TEST_CASE(EraseFaceById)
   BOOST_CHECK_EQUAL(update->action, FibUpdate::ADD_NEXTHOP);
 }
 
+BOOST_AUTO_TEST_CASE(EraseFaceWithNestedRoutes)
+{
+  insertRoute("/", 1, 0, 5, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  insertRoute("/a", 2, 0, 10, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  insertRoute("/a/b", 2, 0, 20, 0);
+  insertRoute("/a/b", 2, 255, 30, 0);
+
+  BOOST_CHECK_EQUAL(rib.findRoutesWithFaceId(2).size(), 3);
+
+  // Clear updates generated from previous insertions
+  clearFibUpdates();
+
+  // All routes of face 2 are removed in one batch, which should generate 2 updates:
+  // to remove the inherited face 1 from /a and /a/b, whose entries are erased
+  destroyFace(2);
+
+  FibUpdater::FibUpdateList updates = getSortedFibUpdates();
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+
+  FibUpdater::FibUpdateList::const_iterator update = updates.begin();
+  BOOST_CHECK_EQUAL(update->name,  "/a");
+  BOOST_CHECK_EQUAL(update->faceId, 1);
+  BOOST_CHECK_EQUAL(update->action, FibUpdate::REMOVE_NEXTHOP);
+
+  ++update;
+  BOOST_CHECK_EQUAL(update->name,  "/a/b");
+  BOOST_CHECK_EQUAL(update->faceId, 1);
+  BOOST_CHECK_EQUAL(update->action, FibUpdate::REMOVE_NEXTHOP);
+
+  BOOST_CHECK_EQUAL(rib.size(), 1);
+  BOOST_CHECK(rib.find("/a") == rib.end());
+  BOOST_CHECK(rib.find("/a/b") == rib.end());
+  BOOST_CHECK_EQUAL(rib.findRoutesWithFaceId(2).size(), 0);
+  BOOST_CHECK(rib.m_updateBatches.empty());
+}
+
 BOOST_AUTO_TEST_CASE(RemoveNamespaceWithAncestorFace) // Bug #2757
 {
   uint64_t faceId = 263;
@@ -84,6 +84,10 @@ public:
            std::function<void(const std::string&)> failureCb) override
   {
     withdrawHistory.push_back({time::steady_clock::now(), rr.prefix});
+    if (shouldHoldWithdraw) {
+      heldWithdrawSuccess = successCb;
+      return;
+    }
     if (shouldSucceed) {
       successCb();
     }
@@ -106,6 +110,8 @@ public:
   };
 
   bool shouldSucceed = true;
+  bool shouldHoldWithdraw = false; ///< keep withdraw in flight until heldWithdrawSuccess is invoked
+  std::function<void()> heldWithdrawSuccess;
   std::vector<HistoryEntry> advertiseHistory;
   std::vector<HistoryEntry> withdrawHistory;
 };
@@ -298,6 +304,98 @@ BOOST_AUTO_TEST_CASE(ChangeDuringRetry)
   BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 0); // don't try to withdraw
 }
 
+BOOST_AUTO_TEST_CASE(CoalesceFlap)
+{
+  rib::Readvertise::PacingOptions options;
+  options.coalesceWindow = 1_s;
+  readvertise->setPacingOptions(options);
+  policy->decision = ReadvertiseAction{"/A", ndn::security::SigningInfo()};
+
+  // advertise and withdraw within the window cancel each other
+  this->insertRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->eraseRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(time::milliseconds(100), 20);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 0);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 0);
+  BOOST_CHECK_EQUAL(readvertise->getCounters().nCoalesced, 2);
+  BOOST_CHECK_EQUAL(readvertise->getCounters().nEmitted, 0);
+
+  // a change is sent at the end of the window
+  this->insertRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 0);
+  this->advanceClocks(time::milliseconds(100), 20);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 1);
+  BOOST_CHECK_EQUAL(readvertise->getCounters().nEmitted, 1);
+
+  // withdraw and advertise within the window cancel each other
+  this->eraseRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->insertRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(time::milliseconds(100), 20);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 1);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 0);
+  BOOST_CHECK_EQUAL(readvertise->getCounters().nCoalesced, 4);
+
+  // withdraw is sent at the end of the window
+  this->eraseRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(time::milliseconds(100), 20);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 1);
+  BOOST_CHECK_EQUAL(readvertise->getCounters().nEmitted, 2);
+}
+
+BOOST_AUTO_TEST_CASE(ReaddDuringWithdraw)
+{
+  rib::Readvertise::PacingOptions options;
+  options.coalesceWindow = 1_s;
+  readvertise->setPacingOptions(options);
+  policy->decision = ReadvertiseAction{"/A", ndn::security::SigningInfo()};
+
+  this->insertRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(time::milliseconds(100), 20);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 1);
+
+  destination->shouldHoldWithdraw = true;
+  this->eraseRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(time::milliseconds(100), 20);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 1);
+  BOOST_REQUIRE(destination->heldWithdrawSuccess != nullptr);
+
+  // re-added while withdraw is in flight, and the window expires before the response
+  this->insertRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(time::milliseconds(100), 20);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 1);
+
+  // withdraw succeeds: the prefix is advertised again
+  destination->shouldHoldWithdraw = false;
+  destination->heldWithdrawSuccess();
+  this->advanceClocks(time::milliseconds(100), 20);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 2);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(RateLimit)
+{
+  rib::Readvertise::PacingOptions options;
+  options.maxRate = 1.0;
+  options.maxBurst = 2;
+  readvertise->setPacingOptions(options);
+
+  for (int i = 0; i < 5; ++i) {
+    Name prefix("/P");
+    prefix.appendNumber(i);
+    policy->decision = ReadvertiseAction{prefix, ndn::security::SigningInfo()};
+    this->insertRoute(Name(prefix).append("1"), 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  }
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 2); // burst
+
+  this->advanceClocks(time::milliseconds(100), 10);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 3);
+
+  this->advanceClocks(time::milliseconds(100), 30);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 5);
+  BOOST_CHECK_EQUAL(readvertise->getCounters().nEmitted, 5);
+  BOOST_CHECK_EQUAL(readvertise->getCounters().nCoalesced, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestReadvertise
 BOOST_AUTO_TEST_SUITE_END() // Readvertise
 
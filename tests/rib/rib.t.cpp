@@ -97,6 +97,43 @@ BOOST_AUTO_TEST_CASE(Children)
   BOOST_CHECK_EQUAL((rib.find(name3)->second)->getParent()->getName(), name4);
 }
 
+BOOST_AUTO_TEST_CASE(FindChildren)
+{
+  rib::Rib rib;
+
+  rib.insert("/a/b", createRoute(1, 20));
+  rib.insert("/a/c/d", createRoute(2, 20));
+  rib.insert("/a/c/d/e", createRoute(3, 20));
+  rib.insert("/f", createRoute(4, 20));
+
+  // Name without an entry
+  auto children = rib.findChildren("/a");
+  BOOST_REQUIRE_EQUAL(children.size(), 2);
+  BOOST_CHECK_EQUAL(children.front()->getName(), "/a/b");
+  BOOST_CHECK_EQUAL(children.back()->getName(), "/a/c/d");
+
+  // Name with an entry
+  children = rib.findChildren("/a/c/d");
+  BOOST_REQUIRE_EQUAL(children.size(), 1);
+  BOOST_CHECK_EQUAL(children.front()->getName(), "/a/c/d/e");
+
+  BOOST_CHECK_EQUAL(rib.findChildren("/").size(), 3);
+  BOOST_CHECK_EQUAL(rib.findChildren("/a/b").size(), 0);
+  BOOST_CHECK_EQUAL(rib.findChildren("/g").size(), 0);
+
+  // Erasing an entry prunes names that no longer lead to any entry
+  rib.erase("/a/c/d", createRoute(2, 20));
+  children = rib.findChildren("/a/c");
+  BOOST_REQUIRE_EQUAL(children.size(), 1);
+  BOOST_CHECK_EQUAL(children.front()->getName(), "/a/c/d/e");
+  BOOST_CHECK(children.front()->getParent() == nullptr);
+
+  rib.erase("/a/c/d/e", createRoute(3, 20));
+  BOOST_CHECK_EQUAL(rib.findChildren("/a/c").size(), 0);
+  BOOST_CHECK(rib.findParent("/a/c/d/e/f") == nullptr);
+  BOOST_CHECK_EQUAL(rib.findChildren("/").size(), 2);
+}
+
 BOOST_AUTO_TEST_CASE(EraseFace)
 {
   rib::Rib rib;
@@ -0,0 +1,165 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "nfdc/batch.hpp"
+#include "nfdc/available-commands.hpp"
+
+#include "mock-nfd-mgmt-fixture.hpp"
+
+namespace nfd {
+namespace tools {
+namespace nfdc {
+namespace tests {
+
+class BatchFixture : public MockNfdMgmtFixture
+{
+protected:
+  BatchFixture()
+  {
+    registerCommands(parser);
+
+    face.onSendInterest.connect([this] (const Interest& interest) {
+      if (Name("/localhost/nfd/rib").isPrefixOf(interest.getName()) ||
+          Name("/localhost/nfd/strategy-choice").isPrefixOf(interest.getName())) {
+        ++nOutstanding;
+        maxOutstanding = std::max(maxOutstanding, nOutstanding);
+      }
+    });
+  }
+
+  void
+  executeBatch(const std::string& input, size_t window = BatchExecutor::DEFAULT_WINDOW)
+  {
+    std::string noun("batch"), verb;
+    CommandArguments ca;
+    Controller controller(face, m_keyChain);
+    ExecuteContext ctx{noun, verb, ca, 0, out, err, face, m_keyChain, controller};
+
+    BatchExecutor batch(ctx, parser, window);
+    std::istringstream is(input);
+    batch.execute(is);
+    exitCode = ctx.exitCode;
+  }
+
+  bool
+  respondFaceDataset(const Interest& interest)
+  {
+    if (!Name("/localhost/nfd/faces/list").isPrefixOf(interest.getName())) {
+      return false;
+    }
+
+    ndn::nfd::FaceStatus faceStatus;
+    faceStatus.setFaceId(10156)
+              .setLocalUri("tcp4://151.26.163.27:22967")
+              .setRemoteUri("tcp4://198.57.27.40:6363")
+              .setFacePersistency(ndn::nfd::FACE_PERSISTENCY_PERSISTENT);
+    this->sendDataset(interest.getName(), faceStatus);
+    return true;
+  }
+
+  /** \brief echo command parameters of a RibRegister or StrategyChoiceSet command
+   */
+  bool
+  respondCommand(const Interest& interest)
+  {
+    for (const char* prefix : {"/localhost/nfd/rib/register", "/localhost/nfd/rib/unregister",
+                               "/localhost/nfd/strategy-choice/set"}) {
+      auto req = parseCommand(interest, prefix);
+      if (req) {
+        --nOutstanding;
+        this->succeedCommand(interest, *req);
+        return true;
+      }
+    }
+    return false;
+  }
+
+protected:
+  CommandParser parser;
+  std::ostringstream out;
+  std::ostringstream err;
+  int exitCode = -1;
+
+  int nOutstanding = 0;
+  int maxOutstanding = 0;
+};
+
+BOOST_AUTO_TEST_SUITE(Nfdc)
+BOOST_FIXTURE_TEST_SUITE(TestBatch, BatchFixture)
+
+BOOST_AUTO_TEST_CASE(Window)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    BOOST_CHECK(this->respondFaceDataset(interest) || this->respondCommand(interest));
+  };
+
+  std::string input;
+  for (int i = 0; i < 20; ++i) {
+    input += "route add /P" + to_string(i) + " 10156\n";
+  }
+  this->executeBatch(input, 4);
+
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK_EQUAL(err.str(), "");
+  BOOST_CHECK_EQUAL(nOutstanding, 0);
+  BOOST_CHECK_GT(maxOutstanding, 1);
+  BOOST_CHECK_LE(maxOutstanding, 4);
+  BOOST_CHECK(out.str().find("route-add-accepted prefix=/P19 nexthop=10156 origin=static cost=0 "
+                             "flags=child-inherit expires=never\n") != std::string::npos);
+  BOOST_CHECK(out.str().find("batch-summary commands=20 succeeded=20 failed=0 ") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Errors)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    BOOST_CHECK(this->respondFaceDataset(interest) || this->respondCommand(interest));
+  };
+
+  this->executeBatch(R"TEXT(# comment
+
+route add /A 10156
+route add /B 23728
+route remove /C 10156 origin client
+strategy set /D /strategyP
+foo bar
+strategy unset /
+)TEXT");
+
+  BOOST_CHECK_EQUAL(exitCode, 1);
+  BOOST_CHECK_EQUAL(err.str(),
+                    "Line 4: Face not found\n"
+                    "Line 7: No such command: foo bar\n"
+                    "Line 8: Unsetting default strategy is prohibited\n");
+  BOOST_CHECK(out.str().find("route-removed prefix=/C nexthop=10156 origin=client\n") != std::string::npos);
+  BOOST_CHECK(out.str().find("strategy-set prefix=/D strategy=/strategyP\n") != std::string::npos);
+  BOOST_CHECK(out.str().find("batch-summary commands=6 succeeded=3 failed=3 ") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBatch
+BOOST_AUTO_TEST_SUITE_END() // Nfdc
+
+} // namespace tests
+} // namespace nfdc
+} // namespace tools
+} // namespace nfd
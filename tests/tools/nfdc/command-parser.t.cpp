@@ -85,6 +85,11 @@ BOOST_AUTO_TEST_CASE(Basic)
   CommandDefinition defHidden("hidden", "");
   parser.addCommand(defHidden, dummyExecute, AVAILABLE_IN_BATCH);
 
+  CommandDefinition defRun("run", "");
+  defRun
+    .addArg("file", ArgValueType::STRING, Required::YES, Positional::YES);
+  parser.addCommand(defRun, dummyExecute, AVAILABLE_IN_ONE_SHOT);
+
   BOOST_CHECK_EQUAL(parser.listCommands("", ParseMode::ONE_SHOT).size(), 4);
   BOOST_CHECK_EQUAL(parser.listCommands("", ParseMode::BATCH).size(), 3);
   BOOST_CHECK_EQUAL(parser.listCommands("route", ParseMode::ONE_SHOT).size(), 2);
@@ -121,6 +126,14 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK_EQUAL(verb, "list");
   BOOST_CHECK_EQUAL(ndn::any_cast<uint64_t>(ca.at("nexthop")), 400);
 
+  std::tie(noun, verb, ca, execute) = parser.parse({"run", "commands.txt"}, ParseMode::ONE_SHOT);
+  BOOST_CHECK_EQUAL(noun, "run");
+  BOOST_CHECK_EQUAL(verb, "");
+  BOOST_CHECK_EQUAL(ndn::any_cast<std::string>(ca.at("file")), "commands.txt");
+
+  std::tie(noun, verb, ca, execute) = parser.parse({"hidden"}, ParseMode::BATCH);
+  BOOST_CHECK_EQUAL(noun, "hidden");
+
   BOOST_CHECK_THROW(parser.parse({}, ParseMode::ONE_SHOT),
                     CommandParser::NoSuchCommandError);
   BOOST_CHECK_THROW(parser.parse({"bar"}, ParseMode::ONE_SHOT),
@@ -135,6 +148,8 @@ BOOST_AUTO_TEST_CASE(Basic)
                     CommandDefinition::Error);
   BOOST_CHECK_THROW(parser.parse({"hidden"}, ParseMode::ONE_SHOT),
                     CommandParser::NoSuchCommandError);
+  BOOST_CHECK_THROW(parser.parse({"run", "commands.txt"}, ParseMode::BATCH),
+                    CommandParser::NoSuchCommandError);
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestCommandParser
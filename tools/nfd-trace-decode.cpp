@@ -0,0 +1,263 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/packet-trace.hpp"
+#include "core/version.hpp"
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/variables_map.hpp>
+#include <boost/program_options/parsers.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace nfd {
+namespace trace_decode {
+
+using trace::Event;
+using trace::FileHeader;
+using trace::Record;
+
+/** \brief aggregated statistics of a packet trace
+ */
+class Summary
+{
+public:
+  void
+  add(const Record& record)
+  {
+    if (m_nRecords == 0) {
+      m_firstTimestamp = record.timestamp;
+    }
+    ++m_nRecords;
+    m_lastTimestamp = record.timestamp;
+
+    size_t event = std::min<size_t>(record.event, static_cast<size_t>(Event::EVENT_MAX));
+    ++m_events[event].count;
+    m_events[event].argSum += record.arg;
+    m_events[event].argMax = std::max(m_events[event].argMax, record.arg);
+
+    if (record.faceId != 0) {
+      ++m_faces[record.faceId][event];
+    }
+  }
+
+  void
+  print(std::ostream& os) const
+  {
+    os << "records: " << m_nRecords << "\n";
+    if (m_nRecords == 0) {
+      return;
+    }
+
+    double duration = (m_lastTimestamp - m_firstTimestamp) / 1e9;
+    os << "duration: " << std::fixed << std::setprecision(6) << duration << " s\n";
+
+    os << "\nevent,count,rate_per_s,mean_arg,max_arg\n";
+    for (size_t i = 0; i <= static_cast<size_t>(Event::EVENT_MAX); ++i) {
+      const EventStats& stats = m_events[i];
+      if (stats.count == 0) {
+        continue;
+      }
+      os << static_cast<Event>(i) << ',' << stats.count << ','
+         << (duration > 0 ? stats.count / duration : 0.0) << ','
+         << static_cast<double>(stats.argSum) / stats.count << ','
+         << stats.argMax << "\n";
+    }
+
+    os << "\nface";
+    for (Event event : FACE_EVENTS) {
+      os << ',' << event;
+    }
+    os << "\n";
+    for (const auto& face : m_faces) {
+      os << face.first;
+      for (Event event : FACE_EVENTS) {
+        auto it = face.second.find(static_cast<size_t>(event));
+        os << ',' << (it == face.second.end() ? 0 : it->second);
+      }
+      os << "\n";
+    }
+
+    uint64_t nSatisfied = m_events[static_cast<size_t>(Event::INTEREST_FINALIZE_SATISFIED)].count;
+    uint64_t nUnsatisfied = m_events[static_cast<size_t>(Event::INTEREST_FINALIZE_UNSATISFIED)].count;
+    if (nSatisfied + nUnsatisfied > 0) {
+      os << "\nsatisfaction_ratio: "
+         << static_cast<double>(nSatisfied) / (nSatisfied + nUnsatisfied) << "\n";
+    }
+  }
+
+private:
+  struct EventStats
+  {
+    uint64_t count = 0;
+    uint64_t argSum = 0;
+    uint32_t argMax = 0;
+  };
+
+  static constexpr Event FACE_EVENTS[] = {
+    Event::INCOMING_INTEREST, Event::OUTGOING_INTEREST,
+    Event::INCOMING_DATA, Event::OUTGOING_DATA,
+    Event::INCOMING_NACK, Event::OUTGOING_NACK,
+  };
+
+  uint64_t m_nRecords = 0;
+  uint64_t m_firstTimestamp = 0;
+  uint64_t m_lastTimestamp = 0;
+  EventStats m_events[static_cast<size_t>(Event::EVENT_MAX) + 1];
+  std::map<uint32_t, std::map<size_t, uint64_t>> m_faces;
+};
+
+constexpr Event Summary::FACE_EVENTS[];
+
+static void
+printCsv(std::ostream& os, const Record& record)
+{
+  os << record.timestamp << ','
+     << static_cast<Event>(record.event) << ','
+     << record.faceId << ','
+     << std::hex << std::setw(16) << std::setfill('0') << record.nameHash
+     << std::dec << std::setfill(' ') << ','
+     << record.nonce << ','
+     << record.arg << "\n";
+}
+
+static void
+usage(std::ostream& os, const boost::program_options::options_description& desc,
+      const char* programName)
+{
+  os << "Usage: " << programName << " [options] <trace-file>\n"
+     << "\n"
+     << "Decode a binary packet trace written by a forwarder built with --with-packet-trace.\n"
+     << "\n"
+     << desc;
+}
+
+static int
+main(int argc, char* argv[])
+{
+  namespace po = boost::program_options;
+
+  std::string filename;
+  po::options_description visibleOptions("Options");
+  visibleOptions.add_options()
+    ("help,h", "print this message and exit")
+    ("version,V", "show version information and exit")
+    ("summary,s", "print summary statistics instead of CSV records")
+    ("csv-and-summary,a", "print CSV records followed by summary statistics")
+    ;
+  po::options_description hiddenOptions;
+  hiddenOptions.add_options()
+    ("trace-file", po::value<std::string>(&filename));
+  po::positional_options_description positional;
+  positional.add("trace-file", 1);
+
+  po::options_description allOptions;
+  allOptions.add(visibleOptions).add(hiddenOptions);
+
+  po::variables_map options;
+  try {
+    po::store(po::command_line_parser(argc, argv).options(allOptions).positional(positional).run(),
+              options);
+    po::notify(options);
+  }
+  catch (const po::error& e) {
+    std::cerr << "ERROR: " << e.what() << "\n\n";
+    usage(std::cerr, visibleOptions, argv[0]);
+    return 2;
+  }
+
+  if (options.count("help") > 0) {
+    usage(std::cout, visibleOptions, argv[0]);
+    return 0;
+  }
+
+  if (options.count("version") > 0) {
+    std::cout << NFD_VERSION_BUILD_STRING << std::endl;
+    return 0;
+  }
+
+  if (filename.empty()) {
+    usage(std::cerr, visibleOptions, argv[0]);
+    return 2;
+  }
+
+  std::ifstream is(filename, std::ios::binary);
+  if (!is) {
+    std::cerr << "ERROR: cannot open " << filename << std::endl;
+    return 1;
+  }
+
+  FileHeader header;
+  if (!is.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      std::memcmp(header.magic, trace::FILE_MAGIC, sizeof(header.magic)) != 0) {
+    std::cerr << "ERROR: " << filename << " is not a packet trace" << std::endl;
+    return 1;
+  }
+  if (header.version != trace::FILE_VERSION || header.recordSize != sizeof(Record)) {
+    std::cerr << "ERROR: unsupported packet trace version " << header.version
+              << " (record size " << header.recordSize << ")" << std::endl;
+    return 1;
+  }
+
+  bool wantCsv = options.count("summary") == 0 || options.count("csv-and-summary") > 0;
+  bool wantSummary = options.count("summary") > 0 || options.count("csv-and-summary") > 0;
+
+  if (wantCsv) {
+    std::cout << "timestamp_ns,event,face,name_hash,nonce,arg\n";
+  }
+
+  Summary summary;
+  Record record;
+  while (is.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+    if (wantCsv) {
+      printCsv(std::cout, record);
+    }
+    summary.add(record);
+  }
+  if (is.gcount() != 0) {
+    std::cerr << "WARNING: trailing partial record ignored" << std::endl;
+  }
+
+  if (wantSummary) {
+    if (wantCsv) {
+      std::cout << "\n";
+    }
+    summary.print(std::cout);
+  }
+  return 0;
+}
+
+} // namespace trace_decode
+} // namespace nfd
+
+int
+main(int argc, char* argv[])
+{
+  return nfd::trace_decode::main(argc, argv);
+}
@@ -24,6 +24,7 @@
  */
 
 #include "available-commands.hpp"
+#include "batch.hpp"
 #include "cs-module.hpp"
 #include "face-module.hpp"
 #include "rib-module.hpp"
@@ -42,6 +43,7 @@ registerCommands(CommandParser& parser)
   RibModule::registerCommands(parser);
   CsModule::registerCommands(parser);
   StrategyChoiceModule::registerCommands(parser);
+  BatchExecutor::registerCommands(parser);
 }
 
 } // namespace nfdc
@@ -0,0 +1,349 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "batch.hpp"
+#include "format-helpers.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace nfd {
+namespace tools {
+namespace nfdc {
+
+const size_t BatchExecutor::DEFAULT_WINDOW = 32;
+
+void
+BatchExecutor::registerCommands(CommandParser& parser)
+{
+  CommandDefinition defBatch("batch", "");
+  defBatch
+    .setTitle("execute commands from a file")
+    .addArg("file", ArgValueType::STRING, Required::YES, Positional::YES)
+    .addArg("window", ArgValueType::UNSIGNED, Required::NO, Positional::NO);
+  parser.addCommand(defBatch, bind(&BatchExecutor::run, _1, std::cref(parser)),
+                    AVAILABLE_IN_ONE_SHOT | AVAILABLE_IN_HELP);
+}
+
+void
+BatchExecutor::run(ExecuteContext& ctx, const CommandParser& parser)
+{
+  auto file = ctx.args.get<std::string>("file");
+  auto window = ctx.args.get<uint64_t>("window", DEFAULT_WINDOW);
+
+  BatchExecutor batch(ctx, parser, static_cast<size_t>(window));
+  if (file == "-") {
+    batch.execute(std::cin);
+    return;
+  }
+
+  std::ifstream is(file);
+  if (!is) {
+    ctx.exitCode = 2;
+    ctx.err << "Cannot open batch file " << file << '\n';
+    return;
+  }
+  batch.execute(is);
+}
+
+BatchExecutor::BatchExecutor(ExecuteContext& ctx, const CommandParser& parser, size_t window)
+  : m_ctx(ctx)
+  , m_parser(parser)
+  , m_window(std::max<size_t>(window, 1))
+{
+}
+
+void
+BatchExecutor::execute(std::istream& is)
+{
+  auto startTime = time::steady_clock::now();
+
+  std::string line;
+  size_t lineNo = 0;
+  while (std::getline(is, line)) {
+    ++lineNo;
+
+    std::vector<std::string> tokens;
+    std::istringstream iss(line);
+    std::string token;
+    while (iss >> token) {
+      tokens.push_back(token);
+    }
+    if (tokens.empty() || tokens.front().front() == '#') {
+      continue;
+    }
+    ++m_nCommands;
+
+    std::string noun, verb;
+    CommandArguments args;
+    ExecuteCommand execute;
+    try {
+      std::tie(noun, verb, args, execute) = m_parser.parse(tokens, ParseMode::BATCH);
+    }
+    catch (const std::invalid_argument& e) {
+      this->reportFailure(lineNo, e.what());
+      continue;
+    }
+
+    if (!this->startPipelined(lineNo, noun, verb, args)) {
+      this->drain();
+      this->executeSequential(lineNo, noun, verb, args, execute);
+    }
+  }
+  this->drain();
+
+  auto elapsed = time::steady_clock::now() - startTime;
+  m_ctx.out << "batch-summary ";
+  text::ItemAttributes ia;
+  m_ctx.out << ia("commands") << m_nCommands
+            << ia("succeeded") << m_nSucceeded
+            << ia("failed") << m_nFailed
+            << ia("elapsed") << text::formatDuration<time::milliseconds>(elapsed);
+  auto elapsedUs = time::duration_cast<time::microseconds>(elapsed).count();
+  if (elapsedUs > 0) {
+    m_ctx.out << ia("rate") << m_nCommands * 1000000 / elapsedUs << "/s";
+  }
+  m_ctx.out << '\n';
+
+  m_ctx.exitCode = m_nFailed > 0 ? 1 : 0;
+}
+
+bool
+BatchExecutor::startPipelined(size_t lineNo, const std::string& noun, const std::string& verb,
+                              const CommandArguments& args)
+{
+  if (noun == "route" && (verb == "add" || verb == "remove")) {
+    // a FaceUri nexthop needs canonization and a face query, which cannot be pipelined
+    const uint64_t* faceId = ndn::any_cast<uint64_t>(&args.at("nexthop"));
+    if (faceId == nullptr) {
+      return false;
+    }
+    auto prefix = args.get<Name>("prefix");
+    auto origin = args.get<RouteOrigin>("origin", ndn::nfd::ROUTE_ORIGIN_STATIC);
+
+    if (!this->isKnownFace(lineNo, *faceId)) {
+      return true;
+    }
+
+    ControlParameters params;
+    params
+      .setName(prefix)
+      .setFaceId(*faceId)
+      .setOrigin(origin);
+
+    if (verb == "remove") {
+      this->startCommand<ndn::nfd::RibUnregisterCommand>(lineNo, params, "removing route",
+        [this] (const ControlParameters& resp) {
+          m_ctx.out << "route-removed ";
+          text::ItemAttributes ia;
+          m_ctx.out << ia("prefix") << resp.getName()
+                    << ia("nexthop") << resp.getFaceId()
+                    << ia("origin") << resp.getOrigin()
+                    << '\n';
+        });
+      return true;
+    }
+
+    bool wantChildInherit = !args.get<bool>("no-inherit", false);
+    bool wantCapture = args.get<bool>("capture", false);
+    auto expiresMillis = args.getOptional<uint64_t>("expires");
+    params
+      .setCost(args.get<uint64_t>("cost", 0))
+      .setFlags((wantChildInherit ? ndn::nfd::ROUTE_FLAG_CHILD_INHERIT : ndn::nfd::ROUTE_FLAGS_NONE) |
+                (wantCapture ? ndn::nfd::ROUTE_FLAG_CAPTURE : ndn::nfd::ROUTE_FLAGS_NONE));
+    if (expiresMillis) {
+      params.setExpirationPeriod(time::milliseconds(*expiresMillis));
+    }
+
+    this->startCommand<ndn::nfd::RibRegisterCommand>(lineNo, params, "adding route",
+      [this] (const ControlParameters& resp) {
+        m_ctx.out << "route-add-accepted ";
+        text::ItemAttributes ia;
+        m_ctx.out << ia("prefix") << resp.getName()
+                  << ia("nexthop") << resp.getFaceId()
+                  << ia("origin") << resp.getOrigin()
+                  << ia("cost") << resp.getCost()
+                  << ia("flags") << static_cast<ndn::nfd::RouteFlags>(resp.getFlags());
+        if (resp.hasExpirationPeriod()) {
+          m_ctx.out << ia("expires") << text::formatDuration<time::milliseconds>(resp.getExpirationPeriod()) << "\n";
+        }
+        else {
+          m_ctx.out << ia("expires") << "never\n";
+        }
+      });
+    return true;
+  }
+
+  if (noun == "strategy" && verb == "set") {
+    ControlParameters params;
+    params
+      .setName(args.get<Name>("prefix"))
+      .setStrategy(args.get<Name>("strategy"));
+
+    this->startCommand<ndn::nfd::StrategyChoiceSetCommand>(lineNo, params, "setting strategy",
+      [this] (const ControlParameters& resp) {
+        m_ctx.out << "strategy-set ";
+        text::ItemAttributes ia;
+        m_ctx.out << ia("prefix") << resp.getName()
+                  << ia("strategy") << resp.getStrategy() << '\n';
+      });
+    return true;
+  }
+
+  if (noun == "strategy" && verb == "unset") {
+    auto prefix = args.get<Name>("prefix");
+    if (prefix.empty()) {
+      this->reportFailure(lineNo, "Unsetting default strategy is prohibited");
+      return true;
+    }
+
+    this->startCommand<ndn::nfd::StrategyChoiceUnsetCommand>(lineNo,
+      ControlParameters().setName(prefix), "unsetting strategy",
+      [this] (const ControlParameters& resp) {
+        m_ctx.out << "strategy-unset ";
+        text::ItemAttributes ia;
+        m_ctx.out << ia("prefix") << resp.getName() << '\n';
+      });
+    return true;
+  }
+
+  return false;
+}
+
+template<typename Command>
+void
+BatchExecutor::startCommand(size_t lineNo, const ControlParameters& params, const std::string& commandName,
+                            const std::function<void(const ControlParameters&)>& printResult)
+{
+  this->processEventsUntil([this] { return m_nInFlight < m_window; });
+
+  ++m_nInFlight;
+  m_ctx.controller.start<Command>(
+    params,
+    [this, printResult] (const ControlParameters& resp) {
+      --m_nInFlight;
+      ++m_nSucceeded;
+      printResult(resp);
+    },
+    [this, lineNo, commandName] (const ControlResponse& resp) {
+      --m_nInFlight;
+      this->reportFailure(lineNo, "Error " + to_string(resp.getCode()) + " when " + commandName +
+                                  ": " + resp.getText());
+    },
+    m_ctx.makeCommandOptions());
+}
+
+bool
+BatchExecutor::isKnownFace(size_t lineNo, uint64_t faceId)
+{
+  if (m_knownFaces.count(faceId) > 0) {
+    return true;
+  }
+
+  // the face may have been created after the face list was last fetched
+  this->drain();
+
+  bool isFetched = false;
+  m_ctx.controller.fetch<ndn::nfd::FaceDataset>(
+    [this, &isFetched] (const std::vector<ndn::nfd::FaceStatus>& result) {
+      isFetched = true;
+      m_knownFaces.clear();
+      for (const auto& faceStatus : result) {
+        m_knownFaces.insert(faceStatus.getFaceId());
+      }
+    },
+    [this, lineNo] (uint32_t code, const std::string& reason) {
+      this->reportFailure(lineNo, "Error " + to_string(code) + " when querying face: " + reason);
+    },
+    m_ctx.makeCommandOptions());
+  m_ctx.face.processEvents();
+
+  if (!isFetched) {
+    return false;
+  }
+  if (m_knownFaces.count(faceId) == 0) {
+    this->reportFailure(lineNo, "Face not found");
+    return false;
+  }
+  return true;
+}
+
+void
+BatchExecutor::executeSequential(size_t lineNo, const std::string& noun, const std::string& verb,
+                                 const CommandArguments& args, const ExecuteCommand& execute)
+{
+  ExecuteContext ctx{noun, verb, args, 0, m_ctx.out, m_ctx.err,
+                     m_ctx.face, m_ctx.keyChain, m_ctx.controller};
+  try {
+    execute(ctx);
+  }
+  catch (const std::exception& e) {
+    ctx.exitCode = 1;
+    ctx.err << e.what() << '\n';
+  }
+
+  if (ctx.exitCode == 0) {
+    ++m_nSucceeded;
+  }
+  else {
+    ++m_nFailed;
+    m_ctx.err << "Line " << lineNo << ": " << noun << ' ' << verb << " exited with code "
+              << ctx.exitCode << '\n';
+  }
+
+  // the command may have created or destroyed faces
+  m_knownFaces.clear();
+}
+
+void
+BatchExecutor::processEventsUntil(const std::function<bool()>& isDone)
+{
+  auto& io = m_ctx.face.getIoService();
+  while (!isDone()) {
+    if (io.stopped()) {
+      io.reset();
+    }
+    if (io.run_one() == 0) {
+      break;
+    }
+  }
+}
+
+void
+BatchExecutor::drain()
+{
+  this->processEventsUntil([this] { return m_nInFlight == 0; });
+}
+
+void
+BatchExecutor::reportFailure(size_t lineNo, const std::string& reason)
+{
+  ++m_nFailed;
+  m_ctx.err << "Line " << lineNo << ": " << reason << '\n';
+}
+
+} // namespace nfdc
+} // namespace tools
+} // namespace nfd
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef NFD_TOOLS_NFDC_BATCH_HPP
+#define NFD_TOOLS_NFDC_BATCH_HPP
+
+#include "command-parser.hpp"
+
+namespace nfd {
+namespace tools {
+namespace nfdc {
+
+/** \brief executes a sequence of commands over one face
+ *
+ *  Each input line contains one command, written as it would be on the command line without
+ *  the leading 'nfdc'. Empty lines and lines starting with '#' are ignored.
+ *
+ *  'route add', 'route remove', 'strategy set', and 'strategy unset' with a FaceId nexthop are
+ *  pipelined: up to \p window such control commands are outstanding at any time, and their
+ *  results may be reported out of order. Any other command is executed on its own, after all
+ *  outstanding commands have completed, so that it observes their effects.
+ */
+class BatchExecutor : noncopyable
+{
+public:
+  /** \brief registers the 'batch' command
+   */
+  static void
+  registerCommands(CommandParser& parser);
+
+  /** \brief the 'batch' command
+   */
+  static void
+  run(ExecuteContext& ctx, const CommandParser& parser);
+
+  BatchExecutor(ExecuteContext& ctx, const CommandParser& parser, size_t window);
+
+  /** \brief execute commands read from \p is
+   *
+   *  Each command prints its own result. A summary with total throughput is printed at the end,
+   *  and ctx.exitCode is set to 1 if any command failed.
+   */
+  void
+  execute(std::istream& is);
+
+public:
+  static const size_t DEFAULT_WINDOW;
+
+private:
+  /** \brief start a command without waiting for its response
+   *  \retval false the command cannot be pipelined
+   */
+  bool
+  startPipelined(size_t lineNo, const std::string& noun, const std::string& verb,
+                 const CommandArguments& args);
+
+  template<typename Command>
+  void
+  startCommand(size_t lineNo, const ControlParameters& params, const std::string& commandName,
+               const std::function<void(const ControlParameters&)>& printResult);
+
+  /** \brief determine whether a face exists
+   *
+   *  The face list is fetched when \p faceId is not among known faces, after all outstanding
+   *  commands have completed.
+   */
+  bool
+  isKnownFace(size_t lineNo, uint64_t faceId);
+
+  void
+  executeSequential(size_t lineNo, const std::string& noun, const std::string& verb,
+                    const CommandArguments& args, const ExecuteCommand& execute);
+
+  /** \brief process events until \p isDone returns true or no operation is outstanding
+   */
+  void
+  processEventsUntil(const std::function<bool()>& isDone);
+
+  /** \brief wait for all outstanding commands to complete
+   */
+  void
+  drain();
+
+  void
+  reportFailure(size_t lineNo, const std::string& reason);
+
+private:
+  ExecuteContext& m_ctx;
+  const CommandParser& m_parser;
+  size_t m_window;
+
+  size_t m_nInFlight = 0;
+  size_t m_nCommands = 0;
+  size_t m_nSucceeded = 0;
+  size_t m_nFailed = 0;
+
+  std::set<uint64_t> m_knownFaces;
+};
+
+} // namespace nfdc
+} // namespace tools
+} // namespace nfd
+
+#endif // NFD_TOOLS_NFDC_BATCH_HPP
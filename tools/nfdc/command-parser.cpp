@@ -110,14 +110,22 @@ CommandParser::listCommands(const std::string& noun, ParseMode mode) const
 std::tuple<std::string, std::string, CommandArguments, ExecuteCommand>
 CommandParser::parse(const std::vector<std::string>& tokens, ParseMode mode) const
 {
-  BOOST_ASSERT(mode == ParseMode::ONE_SHOT);
-
   const std::string& noun = tokens.size() > 0 ? tokens[0] : "";
   const std::string& verb = tokens.size() > 1 ? tokens[1] : "";
 
   NDN_LOG_TRACE("parse mode=" << mode << " noun=" << noun << " verb=" << verb);
 
+  size_t nConsumed = std::min<size_t>(2, tokens.size());
   auto i = m_commands.find({noun, verb});
+  if (i == m_commands.end() && !verb.empty()) {
+    // a command without verb takes its arguments right after the noun,
+    // but an alias with empty verb (e.g. 'route' for 'route list') does not
+    i = m_commands.find({noun, ""});
+    if (i != m_commands.end() && !i->second->def.getVerb().empty()) {
+      i = m_commands.end();
+    }
+    nConsumed = 1;
+  }
   if (i == m_commands.end() || (i->second->modes & static_cast<AvailableIn>(mode)) == 0) {
     BOOST_THROW_EXCEPTION(NoSuchCommandError(noun, verb));
   }
@@ -125,7 +133,6 @@ CommandParser::parse(const std::vector<std::string>& tokens, ParseMode mode) con
   const CommandDefinition& def = i->second->def;
   NDN_LOG_TRACE("found command noun=" << def.getNoun() << " verb=" << def.getVerb());
 
-  size_t nConsumed = std::min<size_t>(2, tokens.size());
   return std::make_tuple(def.getNoun(), def.getVerb(), def.parse(tokens, nConsumed), i->second->execute);
 }
 
@@ -97,7 +97,7 @@ public:
 
   /** \brief parse a command line
    *  \param tokens command line
-   *  \param mode parser mode, must be ParseMode::ONE_SHOT, other modes are not implemented
+   *  \param mode parser mode
    *  \throw NoSuchCommandError command not found
    *  \throw CommandDefinition::Error command arguments are invalid
    *  \return noun, verb, arguments, execute function